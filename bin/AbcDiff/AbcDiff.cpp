@@ -39,6 +39,7 @@
 #include <Alembic/AbcCoreOgawa/All.h>
 #include <Alembic/AbcCoreLayer/Util.h>
 #include <Alembic/AbcGeom/All.h>
+#include <Alembic/Util/TaskPool.h>
 
 // util which compares the property headers and returns if they are the same
 bool headerCmp(const Alembic::Abc::PropertyHeader * iHeaderA,
@@ -216,6 +217,260 @@ void copyObject(Alembic::Abc::IObject & iIn, Alembic::Abc::OObject & iOut)
     }
 }
 
+// returns whether any sample of the two scalar properties differs, the
+// properties have the same header
+bool scalarsDiffer(Alembic::Abc::IScalarProperty & iPropA,
+                   Alembic::Abc::IScalarProperty & iPropB)
+{
+    if (iPropA.getNumSamples() != iPropB.getNumSamples())
+    {
+        return true;
+    }
+
+    std::vector<std::string> sampStrVecA, sampStrVecB;
+    std::vector<std::wstring> sampWStrVecA, sampWStrVecB;
+    char sampA[4096];
+    char sampB[4096];
+    std::size_t numBytes = 0;
+
+    Alembic::Util::PlainOldDataType ptype = iPropB.getDataType().getPod();
+
+    if (ptype == Alembic::Util::kStringPOD)
+    {
+        sampStrVecA.resize(iPropB.getDataType().getExtent());
+        sampStrVecB.resize(iPropB.getDataType().getExtent());
+    }
+    else if (ptype == Alembic::Util::kWstringPOD)
+    {
+        sampWStrVecA.resize(iPropB.getDataType().getExtent());
+        sampWStrVecB.resize(iPropB.getDataType().getExtent());
+    }
+    else
+    {
+        memset(sampA, 0, 4096);
+        memset(sampB, 0, 4096);
+        numBytes = iPropB.getDataType().getNumBytes();
+    }
+
+    Alembic::Abc::index_t numSamples = iPropB.getNumSamples();
+    for (Alembic::Abc::index_t j = 0; j < numSamples; ++j)
+    {
+        if (ptype == Alembic::Util::kStringPOD)
+        {
+            iPropA.get(&sampStrVecA.front(), j);
+            iPropB.get(&sampStrVecB.front(), j);
+            if (sampStrVecA != sampStrVecB)
+            {
+                return true;
+            }
+        }
+        else if (ptype == Alembic::Util::kWstringPOD)
+        {
+            iPropA.get(&sampWStrVecA.front(), j);
+            iPropB.get(&sampWStrVecB.front(), j);
+            if (sampWStrVecA != sampWStrVecB)
+            {
+                return true;
+            }
+        }
+        else
+        {
+            iPropA.get(sampA, j);
+            iPropB.get(sampB, j);
+            if (memcmp(sampA, sampB, numBytes) != 0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// returns whether any sample of the two array properties differs, the
+// properties have the same header
+bool arraysDiffer(Alembic::Abc::IArrayProperty & iPropA,
+                  Alembic::Abc::IArrayProperty & iPropB)
+{
+    if (iPropA.getNumSamples() != iPropB.getNumSamples())
+    {
+        return true;
+    }
+
+    Alembic::Abc::index_t numSamples = iPropB.getNumSamples();
+    for (Alembic::Abc::index_t j = 0; j < numSamples; ++j)
+    {
+        // the dimensions are read without the data, and are checked first
+        // so most changed samples are found without reading their keys
+        Alembic::Abc::Dimensions dimsA, dimsB;
+        iPropA.getDimensions(dimsA, j);
+        iPropB.getDimensions(dimsB, j);
+        if (dimsA != dimsB)
+        {
+            return true;
+        }
+
+        // the digest stored with each sample, only compressed samples, which
+        // don't store one, are hashed from their stored bytes
+        Alembic::Abc::ArraySampleKey keyA, keyB;
+        iPropA.getKey(keyA, j);
+        iPropB.getKey(keyB, j);
+        if (keyA != keyB)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// what to write for a property of A, found up front so the diff is only
+// written for what changed
+struct PropDiff
+{
+    enum Action
+    {
+        // the same in B, nothing is written
+        kSame,
+
+        // missing from B
+        kPrune,
+
+        // different in B, B's property is copied
+        kCopy,
+
+        // a compound with the same header, its children say what to write
+        kWalk
+    };
+
+    Action action;
+
+    // one per property of the compound
+    std::vector< PropDiff > children;
+};
+
+// fills in oDiff for every property of iPropA, comparing sibling properties
+// in parallel
+void scanProps(Alembic::Abc::ICompoundProperty iPropA,
+               Alembic::Abc::ICompoundProperty iPropB,
+               PropDiff & oDiff)
+{
+    oDiff.action = PropDiff::kWalk;
+    oDiff.children.resize(iPropA.getNumProperties());
+    Alembic::Util::ParallelFor(0, oDiff.children.size(),
+        [&](std::size_t i)
+        {
+            PropDiff & diff = oDiff.children[i];
+            const Alembic::Abc::PropertyHeader & headerA =
+                iPropA.getPropertyHeader(i);
+            const Alembic::Abc::PropertyHeader * headerB =
+                iPropB.getPropertyHeader(headerA.getName());
+
+            diff.action = PropDiff::kSame;
+            if (!headerB)
+            {
+                diff.action = PropDiff::kPrune;
+            }
+            else if (!headerCmp(&headerA, headerB))
+            {
+                diff.action = PropDiff::kCopy;
+            }
+            else if (headerA.isCompound())
+            {
+                scanProps(
+                    Alembic::Abc::ICompoundProperty(iPropA, headerA.getName()),
+                    Alembic::Abc::ICompoundProperty(iPropB, headerA.getName()),
+                    diff);
+            }
+            else if (headerA.isScalar())
+            {
+                Alembic::Abc::IScalarProperty propA(iPropA, headerA.getName());
+                Alembic::Abc::IScalarProperty propB(iPropB, headerA.getName());
+                if (scalarsDiffer(propA, propB))
+                {
+                    diff.action = PropDiff::kCopy;
+                }
+            }
+            else if (headerA.isArray())
+            {
+                Alembic::Abc::IArrayProperty propA(iPropA, headerA.getName());
+                Alembic::Abc::IArrayProperty propB(iPropB, headerA.getName());
+                if (arraysDiffer(propA, propB))
+                {
+                    diff.action = PropDiff::kCopy;
+                }
+            }
+        });
+}
+
+// which parts of an object differ between the two archives, found up front
+// from the stored hashes so the diff is only written for what changed
+struct ObjectDiff
+{
+    bool propsDiffer;
+    bool childrenDiffer;
+
+    // filled in when the properties differ, and aren't copied wholesale
+    PropDiff props;
+
+    // one per child of A, empty when that child is the same in B or is
+    // missing from B
+    std::vector< Alembic::Util::shared_ptr< ObjectDiff > > children;
+};
+
+typedef Alembic::Util::shared_ptr< ObjectDiff > ObjectDiffPtr;
+
+// compares the hashes of iObjA and iObjB, and the properties whose hashes
+// differ, and recurses into the children whose hashes differ, scanning
+// sibling subtrees in parallel.
+// Returns an empty pointer if the two hierarchies are the same.
+ObjectDiffPtr scanObject(Alembic::Abc::IObject iObjA,
+                         Alembic::Abc::IObject iObjB)
+{
+    ObjectDiffPtr ret(new ObjectDiff());
+
+    Alembic::Util::Digest hashPropA, hashPropB;
+    iObjA.getPropertiesHash(hashPropA);
+    iObjB.getPropertiesHash(hashPropB);
+    ret->propsDiffer = (hashPropA != hashPropB);
+
+    Alembic::Util::Digest hashChildrenA, hashChildrenB;
+    iObjA.getChildrenHash(hashChildrenA);
+    iObjB.getChildrenHash(hashChildrenB);
+    ret->childrenDiffer = (hashChildrenA != hashChildrenB);
+
+    if (!ret->propsDiffer && !ret->childrenDiffer)
+    {
+        return ObjectDiffPtr();
+    }
+
+    // xforms are copied whole so there is nothing to compare
+    ret->props.action = PropDiff::kSame;
+    if (ret->propsDiffer && !Alembic::AbcGeom::IXform::matches(
+        iObjB.getProperties().getMetaData()))
+    {
+        scanProps(iObjA.getProperties(), iObjB.getProperties(), ret->props);
+    }
+
+    if (ret->childrenDiffer)
+    {
+        ret->children.resize(iObjA.getNumChildren());
+        Alembic::Util::ParallelFor(0, ret->children.size(),
+            [&](std::size_t i)
+            {
+                Alembic::Abc::ObjectHeader headerA = iObjA.getChildHeader(i);
+                if (iObjB.getChildHeader(headerA.getName()))
+                {
+                    Alembic::Abc::IObject childA(iObjA, headerA.getName());
+                    Alembic::Abc::IObject childB(iObjB, headerA.getName());
+                    ret->children[i] = scanObject(childA, childB);
+                }
+            });
+    }
+
+    return ret;
+}
+
 // class which walks the hierarchy, writes out hiearchy and properties
 // that are different in iInFileB from iInFileA, and prunes hierarchy and
 // properties which are in iInFileA but not iInFileB.
@@ -237,6 +492,10 @@ public:
         Alembic::AbcCoreFactory::IFactory factory;
         Alembic::AbcCoreFactory::IFactory::CoreType coreType;
 
+        // one stream per thread so the subtrees can be read in parallel
+        factory.setOgawaNumStreams(
+            Alembic::Util::TaskPool::getDefault().getNumThreads());
+
         Alembic::Abc::IArchive arc1 = factory.getArchive(m_inFileA, coreType);
         if (coreType != Alembic::AbcCoreFactory::IFactory::kOgawa)
         {
@@ -255,7 +514,11 @@ public:
 
         Alembic::Abc::IObject topA = arc1.getTop();
         Alembic::Abc::IObject topB = arc2.getTop();
-        walk(topA, topB);
+        ObjectDiffPtr diff = scanObject(topA, topB);
+        if (diff)
+        {
+            walk(topA, topB, *diff);
+        }
         if (m_outStack.empty())
         {
             printf("No differences detected, %s was not written.\n",
@@ -266,19 +529,20 @@ public:
 
 private:
 
+    // writes what scanProps found to differ, from the calling thread
     void walkProps(Alembic::Abc::ICompoundProperty & iPropA,
                    Alembic::Abc::ICompoundProperty & iPropB,
-                   Alembic::Abc::OCompoundProperty & oProp)
+                   Alembic::Abc::OCompoundProperty & oProp,
+                   const PropDiff & iDiff)
     {
         for (size_t i = 0; i < iPropA.getNumProperties(); ++i)
         {
+            const PropDiff & diff = iDiff.children[i];
             Alembic::Abc::PropertyHeader childAHeader =
                 iPropA.getPropertyHeader(i);
-            const Alembic::Abc::PropertyHeader * childBHeader =
-                iPropB.getPropertyHeader(childAHeader.getName());
 
             // prune this property
-            if (!childBHeader)
+            if (diff.action == PropDiff::kPrune)
             {
                 if (m_verbose)
                 {
@@ -292,11 +556,12 @@ private:
                 Alembic::AbcCoreLayer::SetPrune(md, true);
                 Alembic::Abc::OCompoundProperty pruneProp(oProp,
                     childAHeader.getName(), md);
-                continue;
             }
-
-            if (!headerCmp(&childAHeader, childBHeader))
+            else if (diff.action == PropDiff::kCopy)
             {
+                const Alembic::Abc::PropertyHeader * childBHeader =
+                    iPropB.getPropertyHeader(childAHeader.getName());
+
                 if (childBHeader->isArray())
                 {
                     Alembic::Abc::IArrayProperty inProp(iPropB,
@@ -317,13 +582,8 @@ private:
                         childBHeader->getName());
                     copyProps(inProp, outProp, m_verbose);
                 }
-
-                continue;
-            } // if childAHeader != *childBHeader
-
-
-            // headers are equal do more checks
-            if (childAHeader.isCompound())
+            }
+            else if (diff.action == PropDiff::kWalk)
             {
                 Alembic::Abc::ICompoundProperty childA(iPropA,
                     childAHeader.getName());
@@ -334,115 +594,14 @@ private:
                 Alembic::Abc::OCompoundProperty outProp(oProp,
                     childAHeader.getName());
 
-                walkProps(childA, childB, outProp);
-            }
-            else if (childAHeader.isScalar())
-            {
-                Alembic::Abc::IScalarProperty childA(iPropA,
-                    childAHeader.getName());
-                Alembic::Abc::IScalarProperty childB(iPropB,
-                    childAHeader.getName());
-                if (childA.getNumSamples() != childB.getNumSamples())
-                {
-                    copyStaticProp(childB, oProp, m_verbose);
-                    continue;
-                }
-
-                std::vector<std::string> sampStrVecA, sampStrVecB;
-                std::vector<std::wstring> sampWStrVecA, sampWStrVecB;
-                char sampA[4096];
-                char sampB[4096];
-                std::size_t numBytes = 0;
-
-                Alembic::Util::PlainOldDataType ptype =
-                    childB.getDataType().getPod();
-
-                if (ptype == Alembic::Util::kStringPOD)
-                {
-                    sampStrVecA.resize(childB.getDataType().getExtent());
-                    sampStrVecB.resize(childB.getDataType().getExtent());
-                }
-                else if (ptype == Alembic::Util::kWstringPOD)
-                {
-                    sampWStrVecA.resize(childB.getDataType().getExtent());
-                    sampWStrVecB.resize(childB.getDataType().getExtent());
-                }
-                else
-                {
-                    memset(sampA, 0, 4096);
-                    memset(sampB, 0, 4096);
-                    numBytes = childB.getDataType().getNumBytes();
-                }
-
-                Alembic::Abc::index_t j;
-                Alembic::Abc::index_t numSamples = childB.getNumSamples();
-                for (j = 0; j < numSamples; ++j)
-                {
-                    if (ptype == Alembic::Util::kStringPOD)
-                    {
-                        childA.get(&sampStrVecA.front(), j);
-                        childB.get(&sampStrVecB.front(), j);
-                        if (sampStrVecA != sampStrVecB)
-                        {
-                            copyStaticProp(childB, oProp, m_verbose);
-                            break;
-                        }
-                    }
-                    else if (ptype == Alembic::Util::kWstringPOD)
-                    {
-                        childA.get(&sampWStrVecA.front(), j);
-                        childB.get(&sampWStrVecB.front(), j);
-                        if (sampWStrVecA != sampWStrVecB)
-                        {
-                            copyStaticProp(childB, oProp, m_verbose);
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        childA.get(sampA, j);
-                        childB.get(sampB, j);
-
-                        if (memcmp(sampA, sampB, numBytes) != 0)
-                        {
-                            copyStaticProp(childB, oProp, m_verbose);
-                            break;
-                        }
-                    }
-                }
-            }
-            else if (childAHeader.isArray())
-            {
-                Alembic::Abc::IArrayProperty childA(iPropA,
-                    childAHeader.getName());
-                Alembic::Abc::IArrayProperty childB(iPropB,
-                    childAHeader.getName());
-
-                if (childA.getNumSamples() != childB.getNumSamples())
-                {
-                    copyArrayProp(childB, oProp, m_verbose);
-                    continue;
-                }
-
-                Alembic::Abc::index_t j;
-                Alembic::Abc::index_t numSamples = childB.getNumSamples();
-                for (j = 0; j < numSamples; ++j)
-                {
-                    Alembic::Abc::ArraySampleKey keyA, keyB;
-                    childA.getKey(keyA, j);
-                    childB.getKey(keyB, j);
-                    if (keyA != keyB)
-                    {
-                        copyArrayProp(childB, oProp, m_verbose);
-                        break;
-                    }
-                }
+                walkProps(childA, childB, outProp, diff);
             }
         }
     }
 
     void walkProps(Alembic::Abc::ICompoundProperty & iPropA,
-                   Alembic::Abc::ICompoundProperty & iPropB)
+                   Alembic::Abc::ICompoundProperty & iPropB,
+                   const PropDiff & iDiff)
     {
         if (Alembic::AbcGeom::IXform::matches(iPropB.getMetaData()))
         {
@@ -474,28 +633,22 @@ private:
 
         Alembic::Abc::OCompoundProperty prop =
             m_outStack.back().getProperties();
-        walkProps(iPropA, iPropB, prop);
+        walkProps(iPropA, iPropB, prop, iDiff);
     }
 
-    void walk(Alembic::Abc::IObject & iObjA, Alembic::Abc::IObject & iObjB)
+    void walk(Alembic::Abc::IObject & iObjA, Alembic::Abc::IObject & iObjB,
+              const ObjectDiff & iDiff)
     {
 
-        Alembic::Util::Digest hashPropA, hashPropB;
-        iObjA.getPropertiesHash(hashPropA);
-        iObjB.getPropertiesHash(hashPropB);
-
         // lets check our properties
-        if (hashPropA != hashPropB)
+        if (iDiff.propsDiffer)
         {
             Alembic::Abc::ICompoundProperty propA = iObjA.getProperties();
             Alembic::Abc::ICompoundProperty propB = iObjB.getProperties();
-            walkProps(propA, propB);
+            walkProps(propA, propB, iDiff.props);
         }
 
-        Alembic::Util::Digest hashChildrenA, hashChildrenB;
-        iObjA.getChildrenHash(hashChildrenA);
-        iObjB.getChildrenHash(hashChildrenB);
-        if (hashChildrenA == hashChildrenB)
+        if (!iDiff.childrenDiffer)
         {
             if (m_outStack.size() > 1 &&
                 m_outStack.back().getFullName() == iObjA.getFullName())
@@ -526,11 +679,12 @@ private:
                     printf("%s pruned.\n", headerA.getFullName().c_str());
                 }
             }
-            else
+            // only visit the children the scan found differences in
+            else if (iDiff.children[i])
             {
                 Alembic::Abc::IObject childA(iObjA, headerA.getName());
                 Alembic::Abc::IObject childB(iObjB, headerA.getName());
-                walk(childA, childB);
+                walk(childA, childB, *iDiff.children[i]);
             }
         }
 
@@ -0,0 +1,103 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+#include <Alembic/AbcCoreLayer/Flatten.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Alembic::Abc;
+
+int main( int argc, char *argv[] )
+{
+    if (argc < 3)
+    {
+        std::cerr << "USAGE: " << argv[0] << " outFile.abc inFile1.abc"
+            << " (inFile2.abc ...)" << std::endl;
+        std::cerr << "Writes the layered view of the input files into a single"
+            << " archive.  The first input file is the strongest layer."
+            << std::endl;
+        return -1;
+    }
+
+    std::string fileName = argv[1];
+    std::vector< std::string > files;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (fileName == argv[i])
+        {
+            std::cerr << "ERROR: " << fileName << " is also an input file"
+                << std::endl;
+            return 1;
+        }
+        files.push_back(argv[i]);
+    }
+
+    Alembic::AbcCoreFactory::IFactory factory;
+    factory.setPolicy(ErrorHandler::kThrowPolicy);
+    factory.setOgawaNumStreams(
+        Alembic::Util::TaskPool::getDefault().getNumThreads());
+    factory.setLayerCacheHierarchy(true);
+
+    Alembic::AbcCoreFactory::IFactory::CoreType coreType;
+    IArchive archive = factory.getArchive(files, coreType);
+    if (!archive.valid())
+    {
+        std::cerr << "ERROR: could not open the input files as Alembic"
+            << " archives" << std::endl;
+        return 1;
+    }
+
+    // keep the archive hints of the strongest layer
+    MetaData md = archive.getTop().getMetaData();
+    std::string userStr = md.get(kUserDescriptionKey);
+    if (!userStr.empty())
+    {
+        userStr = "AbcFlatten: " + userStr;
+    }
+
+    OArchive oArchive = CreateArchiveWithInfo(
+        Alembic::AbcCoreOgawa::WriteArchive(), fileName, "AbcFlatten",
+        userStr, md, ErrorHandler::kThrowPolicy);
+
+    Alembic::AbcCoreLayer::Flatten(archive.getPtr(), oArchive.getPtr());
+
+    return 0;
+}
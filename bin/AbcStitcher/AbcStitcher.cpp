@@ -1140,6 +1140,8 @@ int main( int argc, char *argv[] )
 
         Alembic::AbcCoreFactory::IFactory factory;
         factory.setPolicy(ErrorHandler::kThrowPolicy);
+        factory.setOgawaNumStreams(
+            Alembic::Util::TaskPool::getDefault().getNumThreads());
         Alembic::AbcCoreFactory::IFactory::CoreType coreType;
 
         for (int i = 1; i < argc; ++i)
@@ -146,6 +146,65 @@ void checkAcyclic(const TimeSamplingType & tsType,
     }
 }
 
+namespace
+{
+
+// a sample read ahead of being written, either exactly as it is stored or
+// decoded when the reader and writer can't pass stored bytes through
+struct ReadAheadSample
+{
+    RawArraySample raw;
+    bool isRaw;
+    ArraySamplePtr decoded;
+};
+
+// copies samples [iStart, iEnd) of reader onto writer, reading a bounded
+// window of samples in parallel and then writing that window in order
+void copyArraySamples(IArrayProperty & reader, OArrayProperty & writer,
+                      index_t iStart, index_t iEnd)
+{
+    Alembic::Util::TaskPool & pool = Alembic::Util::TaskPool::getDefault();
+    index_t window = static_cast<index_t>(pool.getNumThreads() * 4);
+
+    ArrayPropertyReaderPtr rawReader = reader.getPtr();
+    ArrayPropertyWriterPtr rawWriter = writer.getPtr();
+    std::vector< ReadAheadSample > samples;
+
+    for (index_t w = iStart; w < iEnd; w += window)
+    {
+        index_t wEnd = std::min(iEnd, w + window);
+        samples.clear();
+        samples.resize(wEnd - w);
+
+        Alembic::Util::ParallelFor(0, samples.size(),
+            [&](std::size_t i)
+            {
+                ReadAheadSample & samp = samples[i];
+                samp.isRaw = rawReader->getRawSample(w + i, samp.raw);
+                if (!samp.isRaw)
+                {
+                    reader.get(samp.decoded, w + i);
+                }
+            });
+
+        for (std::size_t i = 0; i < samples.size(); ++i)
+        {
+            ReadAheadSample & samp = samples[i];
+            if (samp.isRaw && !rawWriter->setRawSample(samp.raw))
+            {
+                reader.get(samp.decoded, w + i);
+                samp.isRaw = false;
+            }
+
+            if (!samp.isRaw)
+            {
+                writer.set(*samp.decoded);
+            }
+        }
+    }
+}
+
+}
 
 void stitchArrayProp(const PropertyHeader & propHeader,
                      const ICompoundPropertyVec & iCompoundProps,
@@ -210,11 +269,7 @@ void stitchArrayProp(const PropertyHeader & propHeader,
             }
         }
 
-        for (; k < numSamples; k++)
-        {
-            reader.get(dataPtr, k);
-            writer.set(*dataPtr);
-        }
+        copyArraySamples(reader, writer, k, numSamples);
     }
 
     // fill in any other empties
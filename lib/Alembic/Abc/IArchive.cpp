@@ -89,6 +89,30 @@ AbcA::ReadArraySampleCachePtr IArchive::getReadArraySampleCachePtr()
     return AbcA::ReadArraySampleCachePtr();
 }
 
+//-*****************************************************************************
+AbcA::ArraySampleAllocatorPtr IArchive::getArraySampleAllocator()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::getArraySampleAllocator" );
+
+    return m_archive->getArraySampleAllocator();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return AbcA::ArraySampleAllocatorPtr();
+}
+
+//-*****************************************************************************
+void IArchive::setArraySampleAllocator(
+    AbcA::ArraySampleAllocatorPtr iAllocator )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::setArraySampleAllocator" );
+
+    m_archive->setArraySampleAllocator( iAllocator );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 AbcA::TimeSamplingPtr IArchive::getTimeSampling( uint32_t iIndex )
 {
@@ -142,6 +166,19 @@ int32_t IArchive::getArchiveVersion( )
     return 0;
 }
 
+//-*****************************************************************************
+bool IArchive::refresh()
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArchive::refresh" );
+
+    return m_archive->refresh();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // Not all error handlers throw, so here is a default behavior.
+    return false;
+}
+
 //-*****************************************************************************
 void IArchive::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
 {
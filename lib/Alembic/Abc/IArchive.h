@@ -139,6 +139,15 @@ public:
     //! will be disabled if a NULL cache is passed here.
     void setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr );
 
+    //! Get the allocator array samples are read into, an empty pointer
+    //! means the heap.
+    AbcA::ArraySampleAllocatorPtr getArraySampleAllocator();
+
+    //! Set the allocator array samples read from now on are allocated with,
+    //! like an AbcA::ArraySampleArena per frame.  Not safe while reading
+    //! from other threads.
+    void setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iAllocator );
+
     //-*************************************************************************
     // ABC BASE MECHANISMS
     // These functions are used by Abc to deal with errors, rewrapping,
@@ -178,6 +187,12 @@ public:
     //! of this archive file.
     int32_t getArchiveVersion();
 
+    //! For an archive opened while it is still being written, picks up what
+    //! was written since and returns true if there was anything.  getTop
+    //! then returns the new hierarchy, IObjects gotten before stay as they
+    //! were.  See AbcCoreAbstract::ArchiveReader::refresh.
+    bool refresh();
+
     //! The unspecified-bool-type operator casts the object to "true"
     //! if it is valid, and "false" otherwise.
     ALEMBIC_OPERATOR_BOOL( valid() );
@@ -123,6 +123,21 @@ void IArrayProperty::get( AbcA::ArraySamplePtr& oSamp,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void IArrayProperty::get( AbcA::ArraySamplePtr& oSamp,
+                          const ISampleSelector &iSS,
+                          AbcA::ArraySampleAllocatorPtr iAllocator ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::get(allocator)" );
+
+    m_property->getSampleWithAllocator(
+        iSS.getIndex( m_property->getTimeSampling(),
+                      m_property->getNumSamples() ),
+        oSamp, iAllocator );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void IArrayProperty::getAs( void * oSample,
                             AbcA::PlainOldDataType iPod,
@@ -154,6 +169,50 @@ void IArrayProperty::getAs( void * oSample,
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+size_t IArrayProperty::getInto( void * oBuffer,
+                                size_t iCapacity,
+                                AbcA::PlainOldDataType iPod,
+                                const ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getInto()" );
+
+    return m_property->getInto( iSS.getIndex( m_property->getTimeSampling(),
+                                              m_property->getNumSamples() ),
+                                oBuffer, iCapacity, iPod );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    // for error handler that don't throw
+    return 0;
+}
+
+//-*****************************************************************************
+void IArrayProperty::getPacked( Util::PackedStrings & oStrings,
+                                const ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getPacked()" );
+
+    m_property->getPacked( iSS.getIndex( m_property->getTimeSampling(),
+                                         m_property->getNumSamples() ),
+                           oStrings );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IArrayProperty::getPacked( Util::PackedWstrings & oStrings,
+                                const ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IArrayProperty::getPacked()" );
+
+    m_property->getPacked( iSS.getIndex( m_property->getTimeSampling(),
+                                         m_property->getNumSamples() ),
+                           oStrings );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 bool IArrayProperty::getKey( AbcA::ArraySampleKey& oKey,
                              const ISampleSelector &iSS ) const
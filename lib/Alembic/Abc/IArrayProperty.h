@@ -128,6 +128,12 @@ public:
     void get( AbcA::ArraySamplePtr& oSample,
               const ISampleSelector &iSS = ISampleSelector() ) const;
 
+    //! Same as above, but the sample is allocated with iAllocator instead
+    //! of what the archive was set up with.
+    void get( AbcA::ArraySamplePtr& oSample,
+              const ISampleSelector &iSS,
+              AbcA::ArraySampleAllocatorPtr iAllocator ) const;
+
     //! Get a sample into the address of a datum as a particular POD type.
     void getAs( void *oSample, AbcA::PlainOldDataType iPod,
                 const ISampleSelector &iSS = ISampleSelector() );
@@ -137,6 +143,23 @@ public:
     void getAs( void *oSample,
                 const ISampleSelector &iSS = ISampleSelector() );
 
+    //! Reads a sample as iPod into oBuffer, which holds iCapacity PODs,
+    //! and returns the number of PODs in the sample.  Nothing is read
+    //! unless the sample fits, so a NULL oBuffer and zero iCapacity can be
+    //! used to query the size first.
+    size_t getInto( void *oBuffer, size_t iCapacity,
+                    AbcA::PlainOldDataType iPod,
+                    const ISampleSelector &iSS = ISampleSelector() ) const;
+
+    //! Reads a string sample into one packed buffer, which is much cheaper
+    //! than a std::string per element for big arrays.
+    void getPacked( Util::PackedStrings & oStrings,
+                    const ISampleSelector &iSS = ISampleSelector() ) const;
+
+    //! Same as above for wstring properties.
+    void getPacked( Util::PackedWstrings & oStrings,
+                    const ISampleSelector &iSS = ISampleSelector() ) const;
+
     //! Get a key from an address of a datum.
     //! ...
     bool getKey( AbcA::ArraySampleKey& oKey,
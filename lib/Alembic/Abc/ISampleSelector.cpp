@@ -36,13 +36,109 @@
 
 #include <Alembic/Abc/ISampleSelector.h>
 
+#include <vector>
+
 namespace Alembic {
 namespace Abc {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+// One slot per TimeSampling of an archive, each resolved against the most
+// samples the archive has for it.  Any property using that sampling has at
+// most that many, and as sample times only increase, the index for fewer
+// samples is the same one clamped to the last of them.  The slots are only
+// written when the cache is made, so they are read without locking.
+class ISampleSelector::IndexCache : Util::noncopyable
+{
+public:
+    IndexCache( const ISampleSelector & iSelector,
+                const AbcA::ArchiveReaderPtr & iArchive )
+    {
+        m_slots.resize( iArchive->getNumTimeSamplings() );
+        for ( std::size_t i = 0; i < m_slots.size(); ++i )
+        {
+            Slot & slot = m_slots[i];
+            slot.tsmp = iArchive->getTimeSampling( i );
+            slot.maxNumSamples =
+                iArchive->getMaxNumSamplesForTimeSamplingIndex( i );
+            slot.index = -1;
+
+            // older archives don't know how many samples there are
+            if ( slot.tsmp && slot.maxNumSamples != INDEX_UNKNOWN &&
+                 slot.maxNumSamples > 0 )
+            {
+                slot.index = iSelector.lookupIndex( slot.tsmp,
+                                                    slot.maxNumSamples );
+            }
+        }
+    }
+
+    // returns false if iTsmp isn't one of the archive's
+    bool getIndex( const AbcA::TimeSamplingPtr & iTsmp, index_t iNumSamples,
+                   index_t & oIndex ) const
+    {
+        for ( std::size_t i = 0; i < m_slots.size(); ++i )
+        {
+            const Slot & slot = m_slots[i];
+            if ( slot.tsmp == iTsmp )
+            {
+                if ( slot.index < 0 || iNumSamples < 1 ||
+                     iNumSamples > slot.maxNumSamples )
+                {
+                    return false;
+                }
+
+                oIndex = slot.index < iNumSamples ?
+                    slot.index : iNumSamples - 1;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    struct Slot
+    {
+        AbcA::TimeSamplingPtr tsmp;
+        index_t maxNumSamples;
+        index_t index;
+    };
+
+    std::vector< Slot > m_slots;
+};
+
+//-*****************************************************************************
+ISampleSelector::ISampleSelector( chrono_t iReqTime,
+                                  TimeIndexType iReqIdxType,
+                                  const AbcA::ArchiveReaderPtr & iArchive )
+  : m_requestedIndex( -1 ),
+    m_requestedTime( iReqTime ),
+    m_requestedTimeIndexType( iReqIdxType )
+{
+    if ( iArchive )
+    {
+        m_indexCache.reset( new IndexCache( *this, iArchive ) );
+    }
+}
+
 //-*****************************************************************************
 index_t ISampleSelector::getIndex( const AbcA::TimeSamplingPtr & iTsmp,
     index_t iNumSamples ) const
+{
+    index_t idx;
+    if ( m_indexCache && m_requestedIndex < 0 &&
+         m_indexCache->getIndex( iTsmp, iNumSamples, idx ) )
+    {
+        return idx;
+    }
+
+    return lookupIndex( iTsmp, iNumSamples );
+}
+
+//-*****************************************************************************
+index_t ISampleSelector::lookupIndex( const AbcA::TimeSamplingPtr & iTsmp,
+    index_t iNumSamples ) const
 {
     index_t retIdx;
 
@@ -67,6 +163,80 @@ index_t ISampleSelector::getIndex( const AbcA::TimeSamplingPtr & iTsmp,
     return retIdx < 0 ? 0 : ( retIdx < iNumSamples ? retIdx : iNumSamples-1 );
 }
 
+//-*****************************************************************************
+void ISampleSelector::getIndices( const AbcA::TimeSamplingPtr & iTsmp,
+                                  const std::vector< index_t > & iNumSamples,
+                                  std::vector< index_t > & oIndices ) const
+{
+    if ( m_requestedIndex >= 0 )
+    {
+        oIndices.assign( iNumSamples.size(), m_requestedIndex );
+    }
+    else if ( m_requestedTimeIndexType == kNearIndex )
+    {
+        iTsmp->getNearIndices( m_requestedTime, iNumSamples, oIndices );
+    }
+    else if ( m_requestedTimeIndexType == kFloorIndex )
+    {
+        iTsmp->getFloorIndices( m_requestedTime, iNumSamples, oIndices );
+    }
+    else
+    {
+        assert( m_requestedTimeIndexType == kCeilIndex );
+        iTsmp->getCeilIndices( m_requestedTime, iNumSamples, oIndices );
+    }
+
+    for ( size_t i = 0; i < oIndices.size(); ++i )
+    {
+        index_t & idx = oIndices[i];
+        idx = idx < 0 ? 0 :
+            ( idx < iNumSamples[i] ? idx : iNumSamples[i] - 1 );
+    }
+}
+
+//-*****************************************************************************
+chrono_t ISampleSelector::getInterpolationIndices(
+    const AbcA::TimeSamplingPtr & iTsmp, index_t iNumSamples,
+    index_t & oFloor, index_t & oCeil ) const
+{
+    if ( m_requestedIndex >= 0 || iNumSamples < 2 )
+    {
+        oFloor = getIndex( iTsmp, iNumSamples );
+        oCeil = oFloor;
+        return 0.0;
+    }
+
+    std::pair<index_t, chrono_t> floorIdx =
+        iTsmp->getFloorIndex( m_requestedTime, iNumSamples );
+    std::pair<index_t, chrono_t> ceilIdx =
+        iTsmp->getCeilIndex( m_requestedTime, iNumSamples );
+
+    oFloor = floorIdx.first;
+    oCeil = ceilIdx.first;
+
+    chrono_t span = ceilIdx.second - floorIdx.second;
+    if ( oFloor == oCeil || span <= 0.0 )
+    {
+        oCeil = oFloor;
+        return 0.0;
+    }
+
+    chrono_t alpha = ( m_requestedTime - floorIdx.second ) / span;
+
+    if ( alpha <= 0.0 )
+    {
+        oCeil = oFloor;
+        return 0.0;
+    }
+    else if ( alpha >= 1.0 )
+    {
+        oFloor = oCeil;
+        return 0.0;
+    }
+
+    return alpha;
+}
+
 
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Abc
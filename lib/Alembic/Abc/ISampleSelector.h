@@ -71,6 +71,15 @@ public:
         m_requestedTime( iReqTime ),
         m_requestedTimeIndexType( iReqIdxType ) {}
 
+    //! Resolves the requested time against each of iArchive's
+    //! TimeSamplings up front, so getIndex for a property of iArchive only
+    //! has to clamp that index to its number of samples, without a lookup
+    //! or a lock.  Copies share what was resolved and can be used from
+    //! several threads at the same time, so one built per frame can be
+    //! handed down a whole traversal.
+    ISampleSelector( chrono_t iReqTime, TimeIndexType iReqIdxType,
+                     const AbcA::ArchiveReaderPtr & iArchive );
+
     index_t getRequestedIndex() const { return m_requestedIndex; }
     chrono_t getRequestedTime() const { return m_requestedTime; }
     TimeIndexType getRequestedTimeIndexType() const
@@ -79,10 +88,31 @@ public:
     index_t getIndex( const AbcA::TimeSamplingPtr & iTsmp, index_t
         iNumSamples ) const;
 
+    //! The same as getIndex for each of iNumSamples, for many properties
+    //! that share iTsmp, with the requested time only looked up once.
+    void getIndices( const AbcA::TimeSamplingPtr & iTsmp,
+                     const std::vector< index_t > & iNumSamples,
+                     std::vector< index_t > & oIndices ) const;
+
+    //! Returns the samples on either side of the requested time, and how far
+    //! between them it falls, from 0 at oFloor to 1 at oCeil.
+    //! Index requests, and times on or outside of the first and last
+    //! samples, return the same index for both and 0.
+    chrono_t getInterpolationIndices( const AbcA::TimeSamplingPtr & iTsmp,
+                                      index_t iNumSamples,
+                                      index_t & oFloor,
+                                      index_t & oCeil ) const;
+
 private:
+    index_t lookupIndex( const AbcA::TimeSamplingPtr & iTsmp,
+                         index_t iNumSamples ) const;
+
     index_t m_requestedIndex;
     chrono_t m_requestedTime;
     TimeIndexType m_requestedTimeIndexType;
+
+    class IndexCache;
+    Util::shared_ptr< IndexCache > m_indexCache;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
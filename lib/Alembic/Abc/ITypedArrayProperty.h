@@ -198,6 +198,18 @@ public:
                                                   AbcA::ArraySample>( ptr );
     }
 
+    //! Get the typed sample, allocated with iAllocator instead of what
+    //! the archive was set up with.
+    void get( sample_ptr_type& iVal,
+              const ISampleSelector &iSS,
+              AbcA::ArraySampleAllocatorPtr iAllocator ) const
+    {
+        AbcA::ArraySamplePtr ptr;
+        IArrayProperty::get( ptr, iSS, iAllocator );
+        iVal = Alembic::Util::static_pointer_cast<sample_type,
+                                                  AbcA::ArraySample>( ptr );
+    }
+
     //! Return the typed sample by value.
     //! ...
     sample_ptr_type getValue( const ISampleSelector &iSS = ISampleSelector() ) const
@@ -206,6 +218,32 @@ public:
         get( ret, iSS );
         return ret;
     }
+
+    //! Return the typed sample by value, allocated with iAllocator.
+    sample_ptr_type getValue( const ISampleSelector &iSS,
+                              AbcA::ArraySampleAllocatorPtr iAllocator ) const
+    {
+        sample_ptr_type ret;
+        get( ret, iSS, iAllocator );
+        return ret;
+    }
+
+    //! Reads the sample into oBuffer, which holds iCapacity values, without
+    //! allocating a sample for it, and returns the number of values in the
+    //! sample.  oBuffer is only written to if the sample fits, so a first
+    //! call with a NULL oBuffer and zero iCapacity can size the buffer,
+    //! for instance a pinned staging buffer for a GPU upload.
+    size_t getInto( value_type * oBuffer, size_t iCapacity,
+                    const ISampleSelector &iSS = ISampleSelector() ) const
+    {
+        const AbcA::DataType & dataType = TRAITS::dataType();
+        size_t extent = dataType.getExtent();
+
+        size_t numPods = IArrayProperty::getInto( oBuffer,
+            iCapacity * extent, dataType.getPod(), iSS );
+
+        return ( numPods + extent - 1 ) / extent;
+    }
 };
 
 //-*****************************************************************************
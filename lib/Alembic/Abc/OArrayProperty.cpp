@@ -78,6 +78,26 @@ void OArrayProperty::set( const AbcA::ArraySample &iSamp )
     ALEMBIC_ABC_SAFE_CALL_END();
 }
 
+//-*****************************************************************************
+void OArrayProperty::setPacked( const Util::PackedStrings & iStrings )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::setPacked()" );
+
+    m_property->setPackedSample( iStrings );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void OArrayProperty::setPacked( const Util::PackedWstrings & iStrings )
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "OArrayProperty::setPacked()" );
+
+    m_property->setPackedSample( iStrings );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void OArrayProperty::setFromPrevious()
 {
@@ -111,6 +111,13 @@ public:
     //! ...
     void set( const AbcA::ArraySample &iSample );
 
+    //! Set a sample of a string property from packed strings, without a
+    //! std::string per element.  See ArrayPropertyWriter::setPackedSample.
+    void setPacked( const Util::PackedStrings & iStrings );
+
+    //! Same as above for wstring properties.
+    void setPacked( const Util::PackedWstrings & iStrings );
+
     //! Set a sample from the previous sample.
     //! ...
     void setFromPrevious( );
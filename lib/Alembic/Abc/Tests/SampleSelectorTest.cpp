@@ -0,0 +1,201 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+#include <Alembic/Util/TaskPool.h>
+
+#include <atomic>
+#include <sstream>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+//-*****************************************************************************
+// writes a property with iNumSamples samples for each of iSamplings, and
+// returns the archive's own TimeSamplings, in the same order, after reading
+// it back
+std::vector< AbcA::TimeSamplingPtr > writeSamplings(
+    const std::string & iName,
+    const std::vector< AbcA::TimeSamplingPtr > & iSamplings,
+    index_t iNumSamples,
+    IArchive & oArchive )
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        OObject obj( archive.getTop(), "obj" );
+        for ( size_t s = 0; s < iSamplings.size(); ++s )
+        {
+            std::ostringstream name;
+            name << "prop" << s;
+            OInt32Property prop( obj.getProperties(), name.str(),
+                                 iSamplings[s] );
+            for ( index_t i = 0; i < iNumSamples; ++i )
+            {
+                prop.set( ( Alembic::Util::int32_t ) i );
+            }
+        }
+    }
+
+    oArchive = IArchive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    IObject obj( oArchive.getTop(), "obj" );
+
+    std::vector< AbcA::TimeSamplingPtr > samplings;
+    for ( size_t s = 0; s < iSamplings.size(); ++s )
+    {
+        samplings.push_back(
+            obj.getProperties().getPropertyHeader( s ).getTimeSampling() );
+    }
+    return samplings;
+}
+
+//-*****************************************************************************
+void testCachedMatchesUncached()
+{
+    std::vector< chrono_t > times;
+    times.push_back( 0.0 );
+    times.push_back( 0.5 );
+    times.push_back( 2.0 );
+    times.push_back( 2.25 );
+
+    std::vector< AbcA::TimeSamplingPtr > written;
+    written.push_back( AbcA::TimeSamplingPtr( new AbcA::TimeSampling() ) );
+    written.push_back( AbcA::TimeSamplingPtr(
+        new AbcA::TimeSampling( 1.0 / 24.0, 0.5 ) ) );
+    written.push_back( AbcA::TimeSamplingPtr( new AbcA::TimeSampling(
+        AbcA::TimeSamplingType( 4, 3.0 ), times ) ) );
+    written.push_back( AbcA::TimeSamplingPtr( new AbcA::TimeSampling(
+        AbcA::TimeSamplingType( AbcA::TimeSamplingType::kAcyclic ),
+        times ) ) );
+
+    IArchive archive;
+    std::vector< AbcA::TimeSamplingPtr > samplings = writeSamplings(
+        "sampleSelectorCached.abc", written, ( index_t ) times.size(),
+        archive );
+
+    ISampleSelector::TimeIndexType types[3] = {
+        ISampleSelector::kFloorIndex,
+        ISampleSelector::kCeilIndex,
+        ISampleSelector::kNearIndex
+    };
+
+    for ( int t = 0; t < 3; ++t )
+    {
+        for ( chrono_t time = -1.0; time < 4.0; time += 0.1 )
+        {
+            ISampleSelector plain( time, types[t] );
+            ISampleSelector cached( time, types[t], archive.getPtr() );
+            ISampleSelector copied = cached;
+
+            for ( size_t s = 0; s < samplings.size(); ++s )
+            {
+                for ( index_t n = 1; n <= ( index_t ) times.size(); ++n )
+                {
+                    index_t expected = plain.getIndex( samplings[s], n );
+
+                    TESTING_ASSERT( cached.getIndex( samplings[s], n ) ==
+                                    expected );
+                    TESTING_ASSERT( copied.getIndex( samplings[s], n ) ==
+                                    expected );
+
+                    // samplings that aren't the archive's are looked up
+                    TESTING_ASSERT( cached.getIndex( written[s], n ) ==
+                                    plain.getIndex( written[s], n ) );
+                }
+
+                // more samples than the archive has are looked up too
+                if ( !samplings[s]->getTimeSamplingType().isAcyclic() )
+                {
+                    TESTING_ASSERT( cached.getIndex( samplings[s], 10 ) ==
+                                    plain.getIndex( samplings[s], 10 ) );
+                }
+            }
+        }
+    }
+
+    // a requested index isn't affected by caching
+    ISampleSelector byIndex( ( index_t ) 7 );
+    TESTING_ASSERT( byIndex.getIndex( samplings[1], 4 ) == 3 );
+    TESTING_ASSERT( byIndex.getIndex( samplings[1], 10 ) == 7 );
+}
+
+//-*****************************************************************************
+void testSharedAcrossThreads()
+{
+    std::vector< AbcA::TimeSamplingPtr > written;
+    for ( size_t i = 0; i < 64; ++i )
+    {
+        written.push_back( AbcA::TimeSamplingPtr(
+            new AbcA::TimeSampling( 1.0 / ( 24.0 + i ), 0.0 ) ) );
+    }
+
+    IArchive archive;
+    std::vector< AbcA::TimeSamplingPtr > samplings = writeSamplings(
+        "sampleSelectorShared.abc", written, 50, archive );
+
+    chrono_t frame = 1.3;
+    ISampleSelector shared( frame, ISampleSelector::kFloorIndex,
+                            archive.getPtr() );
+    ISampleSelector plain( frame, ISampleSelector::kFloorIndex );
+
+    std::atomic< size_t > mismatches( 0 );
+
+    Alembic::Util::ParallelFor( 0, 4096,
+        [&]( size_t i )
+        {
+            // every task works on its own copy, as a traversal would
+            ISampleSelector iss = shared;
+            const AbcA::TimeSamplingPtr & tsmp = samplings[i % 64];
+            index_t numSamples = 1 + ( i / 64 ) % 50;
+
+            if ( iss.getIndex( tsmp, numSamples ) !=
+                 plain.getIndex( tsmp, numSamples ) )
+            {
+                ++mismatches;
+            }
+        } );
+
+    TESTING_ASSERT( mismatches == 0 );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testCachedMatchesUncached();
+    testSharedAcrossThreads();
+    return 0;
+}
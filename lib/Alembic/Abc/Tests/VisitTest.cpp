@@ -0,0 +1,296 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+#include <Alembic/Util/TaskPool.h>
+
+#include <atomic>
+#include <sstream>
+
+namespace Abc = Alembic::Abc;
+using namespace Abc;
+
+//-*****************************************************************************
+void addChildren( OObject & iParent, size_t iDepth, uint32_t iTsIndex )
+{
+    if ( iDepth == 0 )
+    {
+        return;
+    }
+
+    for ( size_t i = 0; i < 4; ++i )
+    {
+        std::ostringstream name;
+        name << "child" << i;
+        OObject child( iParent, name.str() );
+
+        OCompoundProperty props = child.getProperties();
+        ODoubleProperty value( props, "value", iTsIndex );
+        for ( size_t s = 0; s < 10; ++s )
+        {
+            value.set( ( double ) s );
+        }
+
+        OCompoundProperty arb( props, "arb" );
+        OInt32Property count( arb, "count" );
+        count.set( ( int32_t ) i );
+
+        addChildren( child, iDepth - 1, iTsIndex );
+    }
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iArchiveName );
+    uint32_t tsIndex = archive.addTimeSampling(
+        AbcA::TimeSampling( 1.0, 0.0 ) );
+
+    OObject top = archive.getTop();
+    addChildren( top, 4, tsIndex );
+}
+
+//-*****************************************************************************
+// Writes the full name of each object and property and how many objects are
+// below each object.
+class PrintVisitor : public ArchiveVisitor
+{
+public:
+    PrintVisitor() : m_numObjects( 0 ) {}
+
+    virtual bool preVisit( const IObject & iObject, VisitContext & ioContext )
+    {
+        ++m_numObjects;
+        ioContext.out() << ioContext.getDepth() << " "
+                        << iObject.getFullName() << "\n";
+        return iObject.getName() != m_prune;
+    }
+
+    virtual bool visitProperty( const ICompoundProperty & iParent,
+                                const AbcA::PropertyHeader & iHeader,
+                                VisitContext & ioContext )
+    {
+        ioContext.out() << "  " << iParent.getName() << "/"
+                        << iHeader.getName() << "\n";
+        return true;
+    }
+
+    virtual void postVisit( const IObject & iObject, VisitContext & ioContext )
+    {
+        ioContext.out() << "end " << iObject.getFullName() << "\n";
+    }
+
+    std::string m_prune;
+    std::atomic< size_t > m_numObjects;
+};
+
+//-*****************************************************************************
+// What PrintVisitor writes, walked on this thread.
+void printSerial( const IObject & iObject, size_t iDepth,
+                  const std::string & iPrune, std::ostream & oOut );
+
+void printProperties( const ICompoundProperty & iParent, std::ostream & oOut )
+{
+    for ( size_t i = 0; i < iParent.getNumProperties(); ++i )
+    {
+        const AbcA::PropertyHeader & header = iParent.getPropertyHeader( i );
+        oOut << "  " << iParent.getName() << "/" << header.getName()
+             << "\n";
+        if ( header.isCompound() )
+        {
+            printProperties( ICompoundProperty( iParent, header.getName() ),
+                             oOut );
+        }
+    }
+}
+
+void printSerial( const IObject & iObject, size_t iDepth,
+                  const std::string & iPrune, std::ostream & oOut )
+{
+    oOut << iDepth << " " << iObject.getFullName() << "\n";
+    if ( iObject.getName() != iPrune )
+    {
+        printProperties( iObject.getProperties(), oOut );
+        for ( size_t i = 0; i < iObject.getNumChildren(); ++i )
+        {
+            printSerial( iObject.getChild( i ), iDepth + 1, iPrune, oOut );
+        }
+    }
+    oOut << "end " << iObject.getFullName() << "\n";
+}
+
+//-*****************************************************************************
+void testOrder( const std::string & iArchiveName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iArchiveName );
+    IObject top = archive.getTop();
+
+    std::ostringstream expected;
+    printSerial( top, 0, "", expected );
+
+    Alembic::Util::TaskPool onePool( 1 );
+    Alembic::Util::TaskPool fourPool( 4 );
+    Alembic::Util::TaskPool * pools[3] = {
+        &Alembic::Util::TaskPool::getDefault(), &onePool, &fourPool };
+
+    for ( size_t p = 0; p < 3; ++p )
+    {
+        for ( size_t i = 0; i < 4; ++i )
+        {
+            VisitOptions options;
+            options.setTaskPool( *pools[p] );
+
+            PrintVisitor visitor;
+            std::ostringstream out;
+            Visit( top, visitor, out, options );
+            TESTING_ASSERT( out.str() == expected.str() );
+
+            // the top and 4 + 16 + 64 + 256 children
+            TESTING_ASSERT( visitor.m_numObjects == 341 );
+        }
+    }
+
+    // pruned objects still get postVisit, but nothing below them is visited
+    std::ostringstream expectedPruned;
+    printSerial( top, 0, "child1", expectedPruned );
+
+    PrintVisitor pruned;
+    pruned.m_prune = "child1";
+    std::ostringstream out;
+    Visit( top, pruned, out );
+    TESTING_ASSERT( out.str() == expectedPruned.str() );
+    TESTING_ASSERT( pruned.m_numObjects < 341 );
+
+    // only the hooks for objects without properties
+    VisitOptions noProps;
+    noProps.setVisitProperties( false );
+    PrintVisitor objectsOnly;
+    std::ostringstream objectsOut;
+    Visit( top, objectsOnly, objectsOut, noProps );
+    TESTING_ASSERT( objectsOut.str().find( "/value" ) == std::string::npos );
+    TESTING_ASSERT( objectsOnly.m_numObjects == 341 );
+}
+
+//-*****************************************************************************
+// Counts the samples of the scalar properties in the time range.
+class SampleVisitor : public ArchiveVisitor
+{
+public:
+    SampleVisitor() : m_numSamples( 0 ) {}
+
+    virtual bool visitProperty( const ICompoundProperty & iParent,
+                                const AbcA::PropertyHeader & iHeader,
+                                VisitContext & ioContext )
+    {
+        if ( iHeader.isScalar() )
+        {
+            IScalarProperty prop( iParent, iHeader.getName() );
+            std::pair< index_t, index_t > range = ioContext.getSampleRange(
+                prop.getTimeSampling(), prop.getNumSamples() );
+            if ( range.second >= range.first )
+            {
+                m_numSamples += range.second - range.first + 1;
+            }
+        }
+
+        // don't go into arb
+        return false;
+    }
+
+    std::atomic< size_t > m_numSamples;
+};
+
+//-*****************************************************************************
+void testSampleRange( const std::string & iArchiveName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iArchiveName );
+
+    // 340 value properties with 10 samples each, the counts in arb are
+    // skipped
+    SampleVisitor all;
+    Visit( archive.getTop(), all );
+    TESTING_ASSERT( all.m_numSamples == 3400 );
+
+    // samples 2 through 5 are in effect from 2.5 to 5.0
+    VisitOptions options;
+    options.setTimeRange( 2.5, 5.0 );
+    SampleVisitor some;
+    Visit( archive.getTop(), some, options );
+    TESTING_ASSERT( some.m_numSamples == 340 * 4 );
+}
+
+//-*****************************************************************************
+// Throws from one object deep in the hierarchy.
+class ThrowVisitor : public ArchiveVisitor
+{
+public:
+    virtual bool preVisit( const IObject & iObject, VisitContext & ioContext )
+    {
+        if ( iObject.getFullName() == "/child2/child3/child0" )
+        {
+            ABCA_THROW( "Visit failed at " << iObject.getFullName() );
+        }
+        return true;
+    }
+};
+
+//-*****************************************************************************
+void testException( const std::string & iArchiveName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iArchiveName );
+
+    for ( size_t i = 0; i < 4; ++i )
+    {
+        ThrowVisitor visitor;
+        TESTING_ASSERT_THROW( Visit( archive.getTop(), visitor ),
+                              Alembic::Util::Exception );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string archiveName = "visit.abc";
+    writeArchive( archiveName );
+
+    testOrder( archiveName );
+    testSampleRange( archiveName );
+    testException( archiveName );
+
+    return 0;
+}
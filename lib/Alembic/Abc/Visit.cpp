@@ -0,0 +1,229 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/Visit.h>
+#include <Alembic/Abc/ISampleSelector.h>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+VisitOptions::VisitOptions()
+  : m_hasTimeRange( false )
+  , m_startTime( 0.0 )
+  , m_endTime( 0.0 )
+  , m_visitProperties( true )
+  , m_pool( &Util::TaskPool::getDefault() )
+{
+}
+
+//-*****************************************************************************
+void VisitOptions::setTimeRange( chrono_t iStart, chrono_t iEnd )
+{
+    m_hasTimeRange = true;
+    m_startTime = iStart;
+    m_endTime = iEnd;
+}
+
+//-*****************************************************************************
+std::ostream & VisitContext::out()
+{
+    if ( !m_out )
+    {
+        m_out.reset( new std::ostringstream() );
+    }
+
+    return *m_out;
+}
+
+//-*****************************************************************************
+std::pair< index_t, index_t >
+VisitContext::getSampleRange( const AbcA::TimeSamplingPtr & iTimeSampling,
+                              size_t iNumSamples ) const
+{
+    if ( iNumSamples == 0 )
+    {
+        return std::pair< index_t, index_t >( 0, -1 );
+    }
+
+    if ( !m_options.hasTimeRange() || !iTimeSampling )
+    {
+        return std::pair< index_t, index_t >( 0, iNumSamples - 1 );
+    }
+
+    index_t first = ISampleSelector( m_options.getStartTime(),
+        ISampleSelector::kFloorIndex ).getIndex( iTimeSampling, iNumSamples );
+    index_t last = ISampleSelector( m_options.getEndTime(),
+        ISampleSelector::kFloorIndex ).getIndex( iTimeSampling, iNumSamples );
+
+    return std::pair< index_t, index_t >( first, last );
+}
+
+//-*****************************************************************************
+ArchiveVisitor::~ArchiveVisitor()
+{
+}
+
+//-*****************************************************************************
+bool ArchiveVisitor::preVisit( const IObject & iObject,
+                               VisitContext & ioContext )
+{
+    return true;
+}
+
+//-*****************************************************************************
+bool ArchiveVisitor::visitProperty( const ICompoundProperty & iParent,
+                                    const AbcA::PropertyHeader & iHeader,
+                                    VisitContext & ioContext )
+{
+    return true;
+}
+
+//-*****************************************************************************
+void ArchiveVisitor::postVisit( const IObject & iObject,
+                                VisitContext & ioContext )
+{
+}
+
+//-*****************************************************************************
+namespace {
+
+// What the hooks of one object wrote, kept until the whole walk is done so
+// it can be written out in order.  The streams are only made by hooks that
+// write something.
+struct VisitNode
+{
+    Util::unique_ptr< std::ostringstream > out;
+    std::vector< VisitNode > children;
+    Util::unique_ptr< std::ostringstream > postOut;
+};
+
+void VisitProperties( const ICompoundProperty & iParent,
+                      ArchiveVisitor & iVisitor,
+                      VisitContext & ioContext )
+{
+    size_t numProps = iParent.getNumProperties();
+    for ( size_t i = 0; i < numProps; ++i )
+    {
+        const AbcA::PropertyHeader & header = iParent.getPropertyHeader( i );
+        if ( iVisitor.visitProperty( iParent, header, ioContext ) &&
+             header.isCompound() )
+        {
+            VisitProperties( ICompoundProperty( iParent, header.getName() ),
+                             iVisitor, ioContext );
+        }
+    }
+}
+
+void VisitObject( const IObject & iObject,
+                  size_t iDepth,
+                  ArchiveVisitor & iVisitor,
+                  const VisitOptions & iOptions,
+                  VisitNode & oNode )
+{
+    VisitContext context( oNode.out, iDepth, iOptions );
+    if ( iVisitor.preVisit( iObject, context ) )
+    {
+        if ( iOptions.getVisitProperties() )
+        {
+            VisitProperties( iObject.getProperties(), iVisitor, context );
+        }
+
+        size_t numChildren = iObject.getNumChildren();
+        oNode.children.resize( numChildren );
+
+        Util::ParallelFor( 0, numChildren,
+            [&]( size_t i )
+            {
+                VisitObject( iObject.getChild( i ), iDepth + 1, iVisitor,
+                             iOptions, oNode.children[i] );
+            }, iOptions.getTaskPool() );
+    }
+
+    VisitContext postContext( oNode.postOut, iDepth, iOptions );
+    iVisitor.postVisit( iObject, postContext );
+}
+
+// Writes out and frees what was kept for iNode and everything below it.
+void WriteNode( VisitNode & iNode, std::ostream & oOut )
+{
+    if ( iNode.out )
+    {
+        oOut << iNode.out->str();
+        iNode.out.reset();
+    }
+
+    for ( size_t i = 0; i < iNode.children.size(); ++i )
+    {
+        WriteNode( iNode.children[i], oOut );
+    }
+    std::vector< VisitNode >().swap( iNode.children );
+
+    if ( iNode.postOut )
+    {
+        oOut << iNode.postOut->str();
+        iNode.postOut.reset();
+    }
+}
+
+}
+
+//-*****************************************************************************
+void Visit( const IObject & iObject,
+            ArchiveVisitor & iVisitor,
+            std::ostream & oOut,
+            const VisitOptions & iOptions )
+{
+    ABCA_ASSERT( iObject.valid(), "Visit requires a valid object" );
+
+    VisitNode root;
+    VisitObject( iObject, 0, iVisitor, iOptions, root );
+    WriteNode( root, oOut );
+}
+
+//-*****************************************************************************
+void Visit( const IObject & iObject,
+            ArchiveVisitor & iVisitor,
+            const VisitOptions & iOptions )
+{
+    std::ostringstream unused;
+    Visit( iObject, iVisitor, unused, iOptions );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Abc
+} // End namespace Alembic
@@ -0,0 +1,172 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_Abc_Visit_h
+#define Alembic_Abc_Visit_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/TaskPool.h>
+#include <Alembic/Abc/Foundation.h>
+#include <Alembic/Abc/ICompoundProperty.h>
+#include <Alembic/Abc/IObject.h>
+
+#include <sstream>
+#include <utility>
+
+namespace Alembic {
+namespace Abc {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! How Visit walks a hierarchy.
+class ALEMBIC_EXPORT VisitOptions
+{
+public:
+    //! Visits every sample and property, on the default Util::TaskPool.
+    VisitOptions();
+
+    //! Only the samples in effect between iStart and iEnd are in the ranges
+    //! VisitContext::getSampleRange returns.
+    void setTimeRange( chrono_t iStart, chrono_t iEnd );
+    bool hasTimeRange() const { return m_hasTimeRange; }
+    chrono_t getStartTime() const { return m_startTime; }
+    chrono_t getEndTime() const { return m_endTime; }
+
+    //! Whether ArchiveVisitor::visitProperty is called, the default is true.
+    void setVisitProperties( bool iVisit ) { m_visitProperties = iVisit; }
+    bool getVisitProperties() const { return m_visitProperties; }
+
+    //! The pool the objects are visited on.  A pool with 1 thread visits
+    //! everything on the calling thread.
+    void setTaskPool( Util::TaskPool & iPool ) { m_pool = &iPool; }
+    Util::TaskPool & getTaskPool() const { return *m_pool; }
+
+private:
+    bool m_hasTimeRange;
+    chrono_t m_startTime;
+    chrono_t m_endTime;
+    bool m_visitProperties;
+    Util::TaskPool * m_pool;
+};
+
+//-*****************************************************************************
+//! Where a visit is, handed to each ArchiveVisitor hook.
+class ALEMBIC_EXPORT VisitContext
+{
+public:
+    //! Made by Visit for each hook it calls, ioOut is only made if out()
+    //! is used.
+    VisitContext( Util::unique_ptr< std::ostringstream > & ioOut,
+                  size_t iDepth, const VisitOptions & iOptions )
+      : m_out( ioOut ), m_depth( iDepth ), m_options( iOptions ) {}
+
+    //! What a hook writes here is written out by Visit in the order a
+    //! depth first walk on one thread would have written it.
+    std::ostream & out();
+
+    //! How far the object is below the object Visit started at, which is 0.
+    size_t getDepth() const { return m_depth; }
+
+    const VisitOptions & getOptions() const { return m_options; }
+
+    //! The first and last index of the samples of a property with
+    //! iNumSamples samples on iTimeSampling that are in effect, as floor
+    //! index lookups, somewhere in the time range of the options.  That is
+    //! every sample without a time range, and last is less than first when
+    //! there are no samples.
+    std::pair< index_t, index_t >
+    getSampleRange( const AbcA::TimeSamplingPtr & iTimeSampling,
+                    size_t iNumSamples ) const;
+
+private:
+    Util::unique_ptr< std::ostringstream > & m_out;
+    size_t m_depth;
+    const VisitOptions & m_options;
+};
+
+//-*****************************************************************************
+//! The hooks Visit calls.  Objects that aren't below each other are visited
+//! at the same time, so the hooks have to be safe to call from several
+//! threads, but the hooks for one object are called in order on one thread:
+//! preVisit, visitProperty for each property depth first, the hooks of its
+//! children, and then postVisit.
+class ALEMBIC_EXPORT ArchiveVisitor
+{
+public:
+    virtual ~ArchiveVisitor();
+
+    //! Called before anything below iObject.  Returning false skips its
+    //! properties and children.  The default returns true.
+    virtual bool preVisit( const IObject & iObject, VisitContext & ioContext );
+
+    //! Called for each property of an object, with iParent the compound
+    //! property it is in.  For a compound property, returning false skips
+    //! the properties in it.  The default returns true.
+    virtual bool visitProperty( const ICompoundProperty & iParent,
+                                const AbcA::PropertyHeader & iHeader,
+                                VisitContext & ioContext );
+
+    //! Called after everything below iObject, even when preVisit skipped
+    //! it.  The default does nothing.
+    virtual void postVisit( const IObject & iObject, VisitContext & ioContext );
+};
+
+//-*****************************************************************************
+//! Walks iObject and everything below it, calling the hooks of iVisitor.
+//! The children of each object are handed to the task pool of iOptions, and
+//! threads that are waiting on their own children run queued ones, so busy
+//! subtrees are spread over the pool.  What the hooks write to their
+//! VisitContext is then written to oOut in depth first order, so it doesn't
+//! depend on how many threads there are.  The first exception a hook throws
+//! is rethrown once the objects that were already started are done.
+ALEMBIC_EXPORT void Visit( const IObject & iObject,
+                           ArchiveVisitor & iVisitor,
+                           std::ostream & oOut,
+                           const VisitOptions & iOptions = VisitOptions() );
+
+//! Same as above, when the hooks don't write anything.
+ALEMBIC_EXPORT void Visit( const IObject & iObject,
+                           ArchiveVisitor & iVisitor,
+                           const VisitOptions & iOptions = VisitOptions() );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Abc
+} // End namespace Alembic
+
+#endif
@@ -46,6 +46,23 @@ ArchiveReader::~ArchiveReader()
     // Nothing
 }
 
+//-*****************************************************************************
+ArraySampleAllocatorPtr ArchiveReader::getArraySampleAllocator()
+{
+    return ArraySampleAllocatorPtr();
+}
+
+//-*****************************************************************************
+void ArchiveReader::setArraySampleAllocator( ArraySampleAllocatorPtr )
+{
+}
+
+//-*****************************************************************************
+bool ArchiveReader::refresh()
+{
+    return false;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
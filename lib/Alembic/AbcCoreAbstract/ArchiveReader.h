@@ -106,6 +106,16 @@ public:
     //! will be disabled if a NULL cache is passed here.
     virtual void setReadArraySampleCachePtr( ReadArraySampleCachePtr iPtr ) = 0;
 
+    //! Get the allocator array samples read from this archive are
+    //! allocated with.  An empty pointer, the default, means the heap.
+    virtual ArraySampleAllocatorPtr getArraySampleAllocator();
+
+    //! Set the allocator array samples read from this archive from now on
+    //! are allocated with, see ArraySampleAllocator.  Implementations that
+    //! don't support allocators ignore it, which is the default.  Not safe
+    //! to call while other threads are reading from the archive.
+    virtual void setArraySampleAllocator( ArraySampleAllocatorPtr iAllocator );
+
     //! Returns the TimeSampling at a given index.
     virtual TimeSamplingPtr getTimeSampling( uint32_t iIndex ) = 0;
 
@@ -126,6 +136,14 @@ public:
     //! Return self
     //! ...
     virtual ArchiveReaderPtr asArchivePtr() = 0;
+
+    //! For an archive that is still being written, picks up what was
+    //! committed to it since it was opened or last refreshed, and returns
+    //! true if anything was.  getTop then returns the new hierarchy, while
+    //! objects and properties gotten before stay valid and unchanged.
+    //! Not safe to call while other threads are reading from the archive.
+    //! The default does nothing and returns false.
+    virtual bool refresh();
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -139,8 +139,19 @@ public:
     virtual void setMaxNumSamplesForTimeSamplingIndex( uint32_t iIndex,
                                                        index_t iMaxIndex ) = 0;
 
+    //! Lets a library built on this one keep its own state with the
+    //! archive, as AbcGeom does for EnableChildBoundsPropagation.  Only a
+    //! weak reference is kept, whoever sets it decides how long it lives.
+    void setExtension( Alembic::Util::shared_ptr< void > iExtension )
+    { m_extension = iExtension; }
+
+    //! Returns what setExtension was given, if it is still alive.
+    Alembic::Util::shared_ptr< void > getExtension() const
+    { return m_extension.lock(); }
+
 private:
     int8_t m_compressionHint;
+    Alembic::Util::weak_ptr< void > m_extension;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -46,6 +46,86 @@ ArrayPropertyReader::~ArrayPropertyReader()
     // Nothing
 }
 
+//-*****************************************************************************
+void ArrayPropertyReader::getSampleWithAllocator( index_t iSampleIndex,
+    ArraySamplePtr & oSample, ArraySampleAllocatorPtr iAllocator )
+{
+    getSample( iSampleIndex, oSample );
+}
+
+//-*****************************************************************************
+size_t ArrayPropertyReader::getInto( index_t iSampleIndex, void *oBuffer,
+                                     size_t iCapacity, PlainOldDataType iPod )
+{
+    Dimensions dims;
+    getDimensions( iSampleIndex, dims );
+
+    size_t numPods = dims.numPoints() * getDataType().getExtent();
+    if ( oBuffer && numPods > 0 && numPods <= iCapacity )
+    {
+        getAs( iSampleIndex, oBuffer, iPod );
+    }
+
+    return numPods;
+}
+
+//-*****************************************************************************
+namespace {
+
+template < class PACKED >
+void PackSample( ArrayPropertyReader & iReader, index_t iSampleIndex,
+                 PlainOldDataType iPod, PACKED & oStrings )
+{
+    ABCA_ASSERT( iReader.getDataType().getPod() == iPod,
+        "Can't read " << PODName( iReader.getDataType().getPod() ) <<
+        " property " << iReader.getName() << " as packed " <<
+        PODName( iPod ) << "s" );
+
+    ArraySamplePtr samp;
+    iReader.getSample( iSampleIndex, samp );
+
+    typedef typename PACKED::string_type string_type;
+    const string_type * strs =
+        static_cast< const string_type * >( samp->getData() );
+    size_t numStrs = samp->size() * iReader.getDataType().getExtent();
+
+    size_t numChars = numStrs;
+    for ( size_t i = 0; i < numStrs; ++i )
+    {
+        numChars += strs[i].length();
+    }
+
+    oStrings.clear();
+    oStrings.reserve( numStrs, numChars );
+    for ( size_t i = 0; i < numStrs; ++i )
+    {
+        oStrings.push_back( strs[i] );
+    }
+}
+
+}
+
+//-*****************************************************************************
+void ArrayPropertyReader::getPacked( index_t iSampleIndex,
+                                     Util::PackedStrings & oStrings )
+{
+    PackSample( *this, iSampleIndex, kStringPOD, oStrings );
+}
+
+//-*****************************************************************************
+void ArrayPropertyReader::getPacked( index_t iSampleIndex,
+                                     Util::PackedWstrings & oStrings )
+{
+    PackSample( *this, iSampleIndex, kWstringPOD, oStrings );
+}
+
+//-*****************************************************************************
+bool ArrayPropertyReader::getRawSample( index_t iSampleIndex,
+                                        RawArraySample & oSample )
+{
+    return false;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
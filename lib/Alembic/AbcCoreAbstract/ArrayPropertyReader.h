@@ -93,6 +93,13 @@ public:
     virtual void getSample( index_t iSampleIndex,
                             ArraySamplePtr &oSample ) = 0;
 
+    //! Same as getSample, but the sample is allocated with iAllocator
+    //! instead of what the archive was set up with.  The default ignores
+    //! iAllocator and calls getSample.
+    virtual void getSampleWithAllocator( index_t iSampleIndex,
+                                         ArraySamplePtr &oSample,
+                                         ArraySampleAllocatorPtr iAllocator );
+
     //! Find the largest valid index that has a time less than or equal
     //! to the given time. Invalid to call this with zero samples.
     //! If the minimum sample time is greater than iTime, index
@@ -141,6 +148,33 @@ public:
     //! and std::wstring as core language-level primitives.
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         PlainOldDataType iPod ) = 0;
+
+    //! Reads the data for the requested sample as iPod into oBuffer, which
+    //! holds iCapacity PODs, and returns the number of PODs in the sample,
+    //! counting each component of the extent.  Nothing is read unless the
+    //! sample fits, so calling this with a NULL oBuffer and zero iCapacity
+    //! queries how big a buffer is needed.  As with getAs, strings and
+    //! wstrings are read into arrays of std::string or std::wstring.
+    //! Cores that can decode straight into oBuffer override this, the
+    //! default computes the count from getDimensions and calls getAs.
+    virtual size_t getInto( index_t iSample, void *oBuffer,
+                            size_t iCapacity, PlainOldDataType iPod );
+
+    //! Reads a string sample into oStrings as one packed buffer instead of
+    //! a std::string per element, which is much cheaper for big arrays.
+    //! Throws if this isn't a string property.  Cores that store strings
+    //! packed override this, the default unpacks getSample.
+    virtual void getPacked( index_t iSampleIndex,
+                            Util::PackedStrings & oStrings );
+
+    //! Same as above for wstring properties.
+    virtual void getPacked( index_t iSampleIndex,
+                            Util::PackedWstrings & oStrings );
+
+    //! Fills oSample with the sample as it is stored, without decoding it,
+    //! so it can be handed to ArrayPropertyWriter::setRawSample.
+    //! Returns false if the core doesn't support this, which is the default.
+    virtual bool getRawSample( index_t iSampleIndex, RawArraySample & oSample );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
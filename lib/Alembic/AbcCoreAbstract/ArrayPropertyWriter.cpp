@@ -46,6 +46,51 @@ ArrayPropertyWriter::~ArrayPropertyWriter()
     // Nothing
 }
 
+//-*****************************************************************************
+namespace {
+
+template < class PACKED >
+void UnpackSample( ArrayPropertyWriter & iWriter, PlainOldDataType iPod,
+                   const PACKED & iStrings )
+{
+    const DataType & dataType = iWriter.getDataType();
+    ABCA_ASSERT( dataType.getPod() == iPod,
+        "Can't set packed " << PODName( iPod ) << "s on " <<
+        PODName( dataType.getPod() ) << " property " << iWriter.getName() );
+
+    ABCA_ASSERT( iStrings.size() % dataType.getExtent() == 0,
+        "Packed sample of " << iStrings.size() << " strings isn't a "
+        "multiple of the extent of " << iWriter.getName() );
+
+    std::vector< typename PACKED::string_type > strs;
+    iStrings.getStrings( strs );
+
+    ArraySample samp( strs.empty() ? NULL : &strs.front(), dataType,
+        Dimensions( iStrings.size() / dataType.getExtent() ) );
+    iWriter.setSample( samp );
+}
+
+}
+
+//-*****************************************************************************
+void ArrayPropertyWriter::setPackedSample( const Util::PackedStrings & iStrings )
+{
+    UnpackSample( *this, kStringPOD, iStrings );
+}
+
+//-*****************************************************************************
+void
+ArrayPropertyWriter::setPackedSample( const Util::PackedWstrings & iStrings )
+{
+    UnpackSample( *this, kWstringPOD, iStrings );
+}
+
+//-*****************************************************************************
+bool ArrayPropertyWriter::setRawSample( const RawArraySample & iSamp )
+{
+    return false;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -88,6 +88,22 @@ public:
     //! currently set is more than the number of times provided in the Acyclic
     //! TimeSampling, an exception will be thrown.
     virtual void setTimeSamplingIndex( uint32_t iIndex ) = 0;
+
+    //! Sets the next sample of a string property from packed strings,
+    //! without making a std::string per element.  The sample is one
+    //! dimensional, with iStrings.size() / extent points.  Cores that store
+    //! strings packed override this, the default unpacks them and calls
+    //! setSample.
+    virtual void setPackedSample( const Util::PackedStrings & iStrings );
+
+    //! Same as above for wstring properties.
+    virtual void setPackedSample( const Util::PackedWstrings & iStrings );
+
+    //! Sets the next sample from one read by
+    //! ArrayPropertyReader::getRawSample, storing its bytes as they are.
+    //! Returns false, without setting anything, if the core doesn't
+    //! support this (the default) or iSamp is in a format it doesn't store.
+    virtual bool setRawSample( const RawArraySample & iSamp );
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -77,53 +77,53 @@ ArraySample::Key ArraySample::getKey() const
 
     case kStringPOD:
     {
-        std::vector <int8_t> v;
+        // hashed as if the strings were packed with a NULL after each one,
+        // which is how they are written
+        MurmurHash3 hash( sizeof( int8_t ) );
+        const std::string * strs = static_cast<const std::string*>( m_data );
+        const int8_t nullChar = 0;
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::string &str =
-                static_cast<const std::string*>( m_data )[j];
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
+            hash.Update( strs[j].data(), strs[j].length() );
+            hash.Update( &nullChar, 1 );
         }
-
-        int8_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int8_t), k.digest.words );
+        hash.Final( k.digest.words );
     }
     break;
 
     case kWstringPOD:
     {
-        std::vector <int32_t> v;
+        // each wchar_t is hashed as an int32_t, with a NULL after each string
+        MurmurHash3 hash( sizeof( int32_t ) );
+        const std::wstring * wstrs =
+            static_cast<const std::wstring*>( m_data );
+        const int32_t nullChar = 0;
         for ( size_t j = 0; j < numPods; ++j )
         {
-            const std::wstring &wstr =
-                static_cast<const std::wstring*>( m_data )[j];
-
+            const std::wstring &wstr = wstrs[j];
             size_t wlen = wstr.length();
-            for (size_t k = 0; k < wlen; ++k)
+
+            if ( sizeof( wchar_t ) == sizeof( int32_t ) )
+            {
+                hash.Update( wstr.data(), wlen * sizeof( int32_t ) );
+            }
+            else
             {
-                v.push_back(wstr[k]);
+                int32_t buf[64];
+                for ( size_t start = 0; start < wlen; start += 64 )
+                {
+                    size_t numChars = std::min( wlen - start, ( size_t ) 64 );
+                    for ( size_t c = 0; c < numChars; ++c )
+                    {
+                        buf[c] = wstr[start + c];
+                    }
+                    hash.Update( buf, numChars * sizeof( int32_t ) );
+                }
             }
 
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
+            hash.Update( &nullChar, sizeof( int32_t ) );
         }
-
-        int32_t * vptr = NULL;
-        if ( !v.empty() )
-            vptr = &(v.front());
-
-        MurmurHash3_x64_128( vptr, v.size(), sizeof(int32_t), k.digest.words );
+        hash.Final( k.digest.words );
     }
     break;
 
@@ -181,6 +181,60 @@ ArraySamplePtr AllocateArraySample( const DataType &iDtype,
     }
 }
 
+//-*****************************************************************************
+namespace {
+
+struct AllocatorDeleter
+{
+    AllocatorDeleter( ArraySampleAllocatorPtr iAllocator, size_t iNumBytes )
+      : allocator( iAllocator ), numBytes( iNumBytes ) {}
+
+    void operator()( void *memory ) const
+    {
+        ArraySample *arraySample = static_cast<ArraySample*>( memory );
+        if ( arraySample )
+        {
+            allocator->deallocate(
+                const_cast<void*>( arraySample->getData() ), numBytes );
+        }
+        delete arraySample;
+    }
+
+    ArraySampleAllocatorPtr allocator;
+    size_t numBytes;
+};
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+ArraySamplePtr AllocateArraySample( const DataType &iDtype,
+                                    const Dimensions &iDims,
+                                    ArraySampleAllocatorPtr iAllocator )
+{
+    PlainOldDataType pod = iDtype.getPod();
+    if ( !iAllocator || pod == kStringPOD || pod == kWstringPOD ||
+         pod == kUnknownPOD || pod == kNumPlainOldDataTypes )
+    {
+        return AllocateArraySample( iDtype, iDims );
+    }
+
+    size_t numBytes = iDtype.getNumBytes() * iDims.numPoints();
+    void * data = NULL;
+    if ( numBytes > 0 )
+    {
+        data = iAllocator->allocate( numBytes );
+    }
+
+    // nothing to allocate, or the allocator didn't have it
+    if ( data == NULL )
+    {
+        return AllocateArraySample( iDtype, iDims );
+    }
+
+    return ArraySamplePtr( new ArraySample( data, iDtype, iDims ),
+                           AllocatorDeleter( iAllocator, numBytes ) );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
@@ -40,6 +40,7 @@
 #include <Alembic/Util/Export.h>
 #include <Alembic/AbcCoreAbstract/Foundation.h>
 #include <Alembic/AbcCoreAbstract/ArraySampleKey.h>
+#include <Alembic/AbcCoreAbstract/ArraySampleAllocator.h>
 #include <Alembic/AbcCoreAbstract/DataType.h>
 
 namespace Alembic {
@@ -137,6 +138,25 @@ private:
 //! data. This greatly reduces the redundancy of this library's code.
 typedef Alembic::Util::shared_ptr<ArraySample> ArraySamplePtr;
 
+//-*****************************************************************************
+//! A sample exactly as it was stored by an archive core, used to copy samples
+//! between archives written by the same core without decoding and encoding
+//! them again.  The encoding is private to the core named by format.
+struct RawArraySample
+{
+    //! The core that stored the bytes, and how, writers refuse other formats.
+    std::string format;
+
+    //! The stored bytes.
+    std::vector< Util::uint8_t > data;
+
+    //! The stored key of the sample, as returned by getKey.  Writers trust
+    //! it to tell samples apart instead of hashing the bytes again.
+    ArraySampleKey key;
+
+    Dimensions dims;
+};
+
 //-*****************************************************************************
 //! When creating an actual buffer for reading an array sample into,
 //! we need to allocate an array of some number of bytes, and then delete
@@ -149,6 +169,14 @@ ALEMBIC_EXPORT ArraySamplePtr
 AllocateArraySample( const DataType &iDtype,
                      const Dimensions &iDims );
 
+//-*****************************************************************************
+//! Same as above, but the memory of numeric samples comes from iAllocator
+//! if it is set and has some.  The returned sample keeps iAllocator alive.
+ALEMBIC_EXPORT ArraySamplePtr
+AllocateArraySample( const DataType &iDtype,
+                     const Dimensions &iDims,
+                     ArraySampleAllocatorPtr iAllocator );
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
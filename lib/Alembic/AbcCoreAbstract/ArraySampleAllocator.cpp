@@ -0,0 +1,106 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/ArraySampleAllocator.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+ArraySampleAllocator::~ArraySampleAllocator()
+{
+    // Nothing
+}
+
+//-*****************************************************************************
+ArraySampleArena::ArraySampleArena( size_t iBlockSize )
+  : m_blockSize( iBlockSize < 4096 ? 4096 : iBlockSize )
+  , m_reserved( 0 )
+  , m_next( NULL )
+  , m_end( NULL )
+{
+}
+
+//-*****************************************************************************
+ArraySampleArena::~ArraySampleArena()
+{
+    for ( std::vector< char * >::iterator it = m_blocks.begin();
+          it != m_blocks.end(); ++it )
+    {
+        delete [] *it;
+    }
+}
+
+//-*****************************************************************************
+void * ArraySampleArena::allocate( size_t iNumBytes )
+{
+    // keep every allocation 16 byte aligned, new[] already is
+    size_t numBytes = ( iNumBytes + 15 ) & ~( size_t ) 15;
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    if ( numBytes >= m_blockSize / 4 )
+    {
+        char * block = new char[ numBytes ];
+        m_blocks.push_back( block );
+        m_reserved += numBytes;
+        return block;
+    }
+
+    if ( m_next == NULL || ( size_t )( m_end - m_next ) < numBytes )
+    {
+        m_next = new char[ m_blockSize ];
+        m_end = m_next + m_blockSize;
+        m_blocks.push_back( m_next );
+        m_reserved += m_blockSize;
+    }
+
+    char * ret = m_next;
+    m_next += numBytes;
+    return ret;
+}
+
+//-*****************************************************************************
+size_t ArraySampleArena::getNumBytesReserved()
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    return m_reserved;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
@@ -0,0 +1,118 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreAbstract_ArraySampleAllocator_h
+#define Alembic_AbcCoreAbstract_ArraySampleAllocator_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreAbstract {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! An ArraySampleAllocator provides the memory array samples are read into,
+//! instead of each one being a separate heap allocation.  It can be set on
+//! an archive reader, see ArchiveReader::setArraySampleAllocator, or passed
+//! to a single read, see ArrayPropertyReader::getSampleWithAllocator.
+//! It is only used for samples of numeric PODs, string samples are always
+//! allocated on the heap.
+//!
+//! Array samples keep their allocator alive, so it is safe to let go of one
+//! while samples from it are still in use.
+class ALEMBIC_EXPORT ArraySampleAllocator
+    : private Alembic::Util::noncopyable
+{
+public:
+    virtual ~ArraySampleAllocator();
+
+    //! Returns iNumBytes of memory aligned to at least 16 bytes, or NULL to
+    //! fall back to allocating the sample on the heap.  This is called from
+    //! every thread the archive is read from.
+    virtual void * allocate( size_t iNumBytes ) = 0;
+
+    //! Called with what allocate returned once the last ArraySamplePtr to
+    //! the sample is gone.  iNumBytes is what was asked for.
+    virtual void deallocate( void * iMemory, size_t iNumBytes ) = 0;
+};
+
+typedef Alembic::Util::shared_ptr< ArraySampleAllocator >
+    ArraySampleAllocatorPtr;
+
+//-*****************************************************************************
+//! An allocator for samples that all go away together, like everything
+//! read for a frame.  Memory is handed out from large blocks and nothing is
+//! given back until the arena, and every sample allocated from it, is gone.
+//! Samples of at least a quarter of the block size get a block of their own.
+class ALEMBIC_EXPORT ArraySampleArena : public ArraySampleAllocator
+{
+public:
+    explicit ArraySampleArena( size_t iBlockSize = 16 * 1024 * 1024 );
+
+    virtual ~ArraySampleArena();
+
+    virtual void * allocate( size_t iNumBytes );
+
+    //! Does nothing, the memory is released with the arena.
+    virtual void deallocate( void * iMemory, size_t iNumBytes ) {}
+
+    //! The total size of the blocks allocated so far.
+    size_t getNumBytesReserved();
+
+private:
+    size_t m_blockSize;
+
+    std::vector< char * > m_blocks;
+    size_t m_reserved;
+
+    // where the next allocation goes in the current block
+    char * m_next;
+    char * m_end;
+
+    Alembic::Util::mutex m_lock;
+};
+
+typedef Alembic::Util::shared_ptr< ArraySampleArena > ArraySampleArenaPtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreAbstract
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,196 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+
+#include "Assert.h"
+
+#include <cstring>
+#include <vector>
+#include <iostream>
+
+//-*****************************************************************************
+namespace AbcA = Alembic::AbcCoreAbstract;
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+// hands out what it is given, and keeps track of what comes back
+class CountingAllocator : public AbcA::ArraySampleAllocator
+{
+public:
+    CountingAllocator( bool iHasMemory = true )
+      : hasMemory( iHasMemory ), numAllocated( 0 ), numDeallocated( 0 ),
+        numBytes( 0 ) {}
+
+    virtual void * allocate( size_t iNumBytes )
+    {
+        if ( !hasMemory )
+        {
+            return NULL;
+        }
+
+        ++numAllocated;
+        numBytes += iNumBytes;
+        return new char[ iNumBytes ];
+    }
+
+    virtual void deallocate( void * iMemory, size_t iNumBytes )
+    {
+        ++numDeallocated;
+        numBytes -= iNumBytes;
+        delete [] static_cast< char * >( iMemory );
+    }
+
+    bool hasMemory;
+    size_t numAllocated;
+    size_t numDeallocated;
+    size_t numBytes;
+};
+
+//-*****************************************************************************
+void testAllocator()
+{
+    Alembic::Util::shared_ptr< CountingAllocator > counter(
+        new CountingAllocator() );
+
+    AbcA::DataType dtype( kFloat32POD, 3 );
+    AbcA::ArraySamplePtr samp = AbcA::AllocateArraySample( dtype,
+        AbcA::Dimensions( 10 ), counter );
+
+    TESTING_ASSERT( counter->numAllocated == 1 );
+    TESTING_ASSERT( counter->numBytes == 120 );
+    TESTING_ASSERT( samp->getDataType() == dtype );
+    TESTING_ASSERT( samp->size() == 10 );
+
+    float32_t * data = static_cast< float32_t * >(
+        const_cast< void * >( samp->getData() ) );
+    data[29] = 1.0f;
+
+    // the sample keeps the allocator around
+    AbcA::ArraySampleAllocatorPtr allocator = counter;
+    CountingAllocator * rawCounter = counter.get();
+    counter.reset();
+    allocator.reset();
+    TESTING_ASSERT( rawCounter->numDeallocated == 0 );
+
+    {
+        Alembic::Util::shared_ptr< CountingAllocator > other(
+            new CountingAllocator() );
+
+        // strings are always allocated on the heap
+        AbcA::ArraySamplePtr strSamp = AbcA::AllocateArraySample(
+            AbcA::DataType( kStringPOD ), AbcA::Dimensions( 4 ), other );
+        TESTING_ASSERT( strSamp->size() == 4 );
+        TESTING_ASSERT( other->numAllocated == 0 );
+
+        // and so is nothing
+        AbcA::ArraySamplePtr emptySamp = AbcA::AllocateArraySample(
+            AbcA::DataType( kInt32POD ), AbcA::Dimensions( 0 ), other );
+        TESTING_ASSERT( emptySamp->getData() == NULL );
+        TESTING_ASSERT( emptySamp->valid() );
+        TESTING_ASSERT( other->numAllocated == 0 );
+
+        AbcA::ArraySamplePtr intSamp = AbcA::AllocateArraySample(
+            AbcA::DataType( kInt32POD ), AbcA::Dimensions( 3 ), other );
+        TESTING_ASSERT( other->numAllocated == 1 );
+        TESTING_ASSERT( other->numBytes == 12 );
+        intSamp.reset();
+        TESTING_ASSERT( other->numDeallocated == 1 );
+        TESTING_ASSERT( other->numBytes == 0 );
+    }
+
+    // an allocator that is out of memory falls back to the heap
+    {
+        Alembic::Util::shared_ptr< CountingAllocator > empty(
+            new CountingAllocator( false ) );
+        AbcA::ArraySamplePtr heapSamp = AbcA::AllocateArraySample(
+            AbcA::DataType( kFloat64POD ), AbcA::Dimensions( 8 ), empty );
+        TESTING_ASSERT( heapSamp->getData() != NULL );
+        TESTING_ASSERT( heapSamp->size() == 8 );
+    }
+}
+
+//-*****************************************************************************
+void testArena()
+{
+    AbcA::ArraySampleArenaPtr arena( new AbcA::ArraySampleArena( 4096 ) );
+    TESTING_ASSERT( arena->getNumBytesReserved() == 0 );
+
+    std::vector< AbcA::ArraySamplePtr > samps;
+    for ( std::size_t i = 1; i < 20; ++i )
+    {
+        samps.push_back( AbcA::AllocateArraySample(
+            AbcA::DataType( kUint8POD ), AbcA::Dimensions( i ), arena ) );
+
+        std::size_t addr = reinterpret_cast< std::size_t >(
+            samps.back()->getData() );
+        TESTING_ASSERT( addr % 16 == 0 );
+        memset( const_cast< void * >( samps.back()->getData() ), 0xff, i );
+    }
+
+    // all of that fit in one block
+    TESTING_ASSERT( arena->getNumBytesReserved() == 4096 );
+
+    // big samples get their own
+    samps.push_back( AbcA::AllocateArraySample(
+        AbcA::DataType( kFloat64POD ), AbcA::Dimensions( 1000 ), arena ) );
+    TESTING_ASSERT( arena->getNumBytesReserved() == 4096 + 8000 );
+
+    // and a sample that doesn't fit in what is left of the block starts a
+    // new one
+    samps.push_back( AbcA::AllocateArraySample(
+        AbcA::DataType( kUint8POD ), AbcA::Dimensions( 1000 ), arena ) );
+    samps.push_back( AbcA::AllocateArraySample(
+        AbcA::DataType( kUint8POD ), AbcA::Dimensions( 1000 ), arena ) );
+    samps.push_back( AbcA::AllocateArraySample(
+        AbcA::DataType( kUint8POD ), AbcA::Dimensions( 1000 ), arena ) );
+    samps.push_back( AbcA::AllocateArraySample(
+        AbcA::DataType( kUint8POD ), AbcA::Dimensions( 1000 ), arena ) );
+    TESTING_ASSERT( arena->getNumBytesReserved() == 2 * 4096 + 8000 );
+
+    // the samples keep the arena until they are done with
+    arena.reset();
+    TESTING_ASSERT( samps.back()->size() == 1000 );
+    samps.clear();
+}
+
+//-*****************************************************************************
+int main( int, char** )
+{
+    testAllocator();
+    testArena();
+    return 0;
+}
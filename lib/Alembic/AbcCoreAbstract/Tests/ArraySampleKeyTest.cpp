@@ -0,0 +1,132 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/Util/Murmur3.h>
+
+#include "Assert.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+//-*****************************************************************************
+namespace AbcA = Alembic::AbcCoreAbstract;
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+// The digests are stored in archives and used to name BlobStore blobs, so
+// they must never change.
+void testKnownDigests()
+{
+    std::vector< uint8_t > bytes( 1000 );
+    for ( size_t i = 0; i < bytes.size(); ++i )
+    {
+        bytes[i] = ( uint8_t )( i * 7 + 3 );
+    }
+
+    uint64_t out[2];
+    MurmurHash3_x64_128( &bytes.front(), 37, 1, out );
+    TESTING_ASSERT( out[0] == 0x2c5b9ecfee19d335ULL &&
+                    out[1] == 0x58f7886b2cc2d93cULL );
+
+    MurmurHash3_x64_128( &bytes.front(), 1000, 1, out );
+    TESTING_ASSERT( out[0] == 0x0af789efbadcaa49ULL &&
+                    out[1] == 0x0bd8a1b9d9bb546bULL );
+
+    AbcA::ArraySample::Key key = AbcA::ArraySample( &bytes.front(),
+        AbcA::DataType( kUint8POD, 1 ), Dimensions( 16 ) ).getKey();
+    TESTING_ASSERT( key.numBytes == 16 );
+    TESTING_ASSERT( key.digest.words[0] == 0xc4b099c52f8f4ea1ULL &&
+                    key.digest.words[1] == 0x7d670219d92afe48ULL );
+
+    // strings are hashed as if packed with a NULL after each one
+    std::vector< std::string > strs;
+    strs.push_back( "one" );
+    strs.push_back( "" );
+    strs.push_back( "three" );
+    key = AbcA::ArraySample( &strs.front(), AbcA::DataType( kStringPOD, 1 ),
+                             Dimensions( strs.size() ) ).getKey();
+    TESTING_ASSERT( key.digest.words[0] == 0xcdf7b62b42268b8eULL &&
+                    key.digest.words[1] == 0xc2b055bfb991921fULL );
+
+    // and wstrings as int32_t
+    std::vector< std::wstring > wstrs;
+    wstrs.push_back( L"alpha" );
+    wstrs.push_back( L"beta" );
+    key = AbcA::ArraySample( &wstrs.front(), AbcA::DataType( kWstringPOD, 1 ),
+                             Dimensions( wstrs.size() ) ).getKey();
+    TESTING_ASSERT( key.digest.words[0] == 0xb145b758a7ef0f00ULL &&
+                    key.digest.words[1] == 0x19d07df115910752ULL );
+}
+
+//-*****************************************************************************
+void testIncrementalHash()
+{
+    std::vector< uint8_t > bytes( 200 );
+    for ( size_t i = 0; i < bytes.size(); ++i )
+    {
+        bytes[i] = ( uint8_t )( i * 13 + 1 );
+    }
+
+    for ( size_t len = 0; len <= bytes.size(); len += 7 )
+    {
+        uint64_t expected[2];
+        MurmurHash3_x64_128( &bytes.front(), len, 1, expected );
+
+        // any way of splitting it up hashes the same
+        for ( size_t step = 1; step < 40; step += 5 )
+        {
+            MurmurHash3 hash;
+            for ( size_t start = 0; start < len; start += step )
+            {
+                hash.Update( &bytes[start], std::min( step, len - start ) );
+            }
+
+            uint64_t out[2];
+            hash.Final( out );
+            TESTING_ASSERT( out[0] == expected[0] && out[1] == expected[1] );
+        }
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testKnownDigests();
+    testIncrementalHash();
+    return 0;
+}
@@ -557,6 +557,132 @@ void testAcyclicTime3()
     testTimeSampling<TIME>( tSamp, tSampTyp, numSamps );
 }
 
+//-*****************************************************************************
+// The floor index as found by searching every acyclic time.
+index_t acyclicFloor( const TimeVector & iTimes, chrono_t iTime,
+                      index_t iNumSamples )
+{
+    if ( iTime <= iTimes[0] )
+    {
+        return 0;
+    }
+
+    if ( iTime >= iTimes[iNumSamples - 1] )
+    {
+        return iNumSamples - 1;
+    }
+
+    index_t idx = 0;
+    while ( iTimes[idx + 1] <= iTime )
+    {
+        ++idx;
+    }
+
+    if ( iTimes[idx] != iTime &&
+         Imath::equalWithAbsError( iTime, iTimes[idx + 1], 1e-5 ) )
+    {
+        ++idx;
+    }
+
+    return idx;
+}
+
+//-*****************************************************************************
+void testAcyclicLookup()
+{
+    // very uneven, so most lookups don't land in the right bucket
+    TimeVector tvec;
+    chrono_t t = -3.0;
+    Imath::srand48( 17 );
+    for ( size_t i = 0; i < 200; ++i )
+    {
+        t += ( i % 50 < 45 ) ? Imath::drand48() * 0.01 + 1e-6 :
+            Imath::drand48() * 100.0;
+        tvec.push_back( t );
+    }
+
+    const AbcA::TimeSampling tSamp( AbcA::TimeSamplingType(
+        AbcA::TimeSamplingType::kAcyclic ), tvec );
+
+    std::cout << "Testing acyclic lookup" << std::endl;
+
+    for ( size_t i = 0; i < tvec.size(); ++i )
+    {
+        chrono_t times[5] = { tvec[i], tvec[i] - 1e-6, tvec[i] + 1e-6,
+                              tvec[i] - 1e-3, tvec[i] + 0.5 };
+
+        for ( size_t j = 0; j < 5; ++j )
+        {
+            for ( index_t n = 1; n <= ( index_t ) tvec.size(); n += 33 )
+            {
+                TESTING_ASSERT( tSamp.getFloorIndex( times[j], n ).first ==
+                                acyclicFloor( tvec, times[j], n ) );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void testBatchIndices( const AbcA::TimeSampling & iTimeSampling,
+                       chrono_t iStart, chrono_t iEnd )
+{
+    std::vector< index_t > numSamples;
+    numSamples.push_back( 0 );
+    numSamples.push_back( 1 );
+    numSamples.push_back( 2 );
+    numSamples.push_back( 7 );
+    numSamples.push_back( 30 );
+    numSamples.push_back( 31 );
+
+    std::vector< index_t > floors;
+    std::vector< index_t > ceils;
+    std::vector< index_t > nears;
+
+    for ( chrono_t t = iStart; t <= iEnd; t += ( iEnd - iStart ) / 97.0 )
+    {
+        iTimeSampling.getFloorIndices( t, numSamples, floors );
+        iTimeSampling.getCeilIndices( t, numSamples, ceils );
+        iTimeSampling.getNearIndices( t, numSamples, nears );
+
+        TESTING_ASSERT( floors.size() == numSamples.size() );
+        TESTING_ASSERT( floors[0] == 0 && nears[0] == 0 );
+
+        for ( size_t i = 1; i < numSamples.size(); ++i )
+        {
+            index_t n = numSamples[i];
+            TESTING_ASSERT( floors[i] ==
+                            iTimeSampling.getFloorIndex( t, n ).first );
+            TESTING_ASSERT( ceils[i] ==
+                            iTimeSampling.getCeilIndex( t, n ).first );
+            TESTING_ASSERT( nears[i] ==
+                            iTimeSampling.getNearIndex( t, n ).first );
+        }
+    }
+}
+
+//-*****************************************************************************
+void testBatchIndices()
+{
+    std::cout << "Testing batch indices" << std::endl;
+
+    testBatchIndices( AbcA::TimeSampling( 1.0 / 24.0, 1.0 ), 0.0, 3.0 );
+
+    TimeVector cyclic;
+    cyclic.push_back( 0.0 );
+    cyclic.push_back( 0.1 );
+    cyclic.push_back( 0.75 );
+    testBatchIndices( AbcA::TimeSampling( AbcA::TimeSamplingType( 3, 1.0 ),
+                                          cyclic ), -1.0, 12.0 );
+
+    TimeVector acyclic;
+    for ( size_t i = 0; i < 31; ++i )
+    {
+        acyclic.push_back( i * i * 0.01 );
+    }
+    testBatchIndices( AbcA::TimeSampling( AbcA::TimeSamplingType(
+        AbcA::TimeSamplingType::kAcyclic ), acyclic ), -1.0, 10.0 );
+}
+
 //-*****************************************************************************
 void testBadTypes()
 {
@@ -623,6 +749,9 @@ int main( int, char** )
     testUniformTime1<float>();
     testAcyclicTime1<float>();
 
+    testAcyclicLookup();
+    testBatchIndices();
+
     // make sure these bad types throw
     testBadTypes();
 
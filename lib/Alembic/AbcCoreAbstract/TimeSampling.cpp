@@ -58,6 +58,7 @@ TimeSampling::TimeSampling( const TimeSamplingType &iTimeSamplingType,
                             const std::vector< chrono_t > & iSampleTimes )
   : m_timeSamplingType( iTimeSamplingType )
   , m_sampleTimes( iSampleTimes )
+  , m_acyclicBucketScale( 0.0 )
 {
     init();
 }
@@ -65,6 +66,7 @@ TimeSampling::TimeSampling( const TimeSamplingType &iTimeSamplingType,
 TimeSampling::TimeSampling( chrono_t iTimePerCycle,
                             chrono_t iStartTime )
   : m_timeSamplingType( iTimePerCycle )
+  , m_acyclicBucketScale( 0.0 )
 {
     m_sampleTimes.resize(1);
     m_sampleTimes[0] = iStartTime;
@@ -104,11 +106,31 @@ void TimeSampling::init()
         }
     }
 
+    if ( m_timeSamplingType.isAcyclic() && numSamples > 1 )
+    {
+        m_acyclicBucketScale = ( chrono_t ) numSamples /
+            ( m_sampleTimes[numSamples - 1] - m_sampleTimes[0] );
+
+        m_acyclicBuckets.resize( numSamples );
+        size_t idx = 0;
+        for ( size_t i = 0; i < numSamples; ++i )
+        {
+            chrono_t bucketTime = m_sampleTimes[0] +
+                ( chrono_t ) i / m_acyclicBucketScale;
+
+            while ( idx < numSamples && m_sampleTimes[idx] <= bucketTime )
+            {
+                ++idx;
+            }
+            m_acyclicBuckets[i] = idx;
+        }
+    }
 }
 
 //-*****************************************************************************
 TimeSampling::TimeSampling()
   : m_timeSamplingType( TimeSamplingType() )
+  , m_acyclicBucketScale( 0.0 )
 {
     m_sampleTimes.resize(1);
     m_sampleTimes[0] = 0.0;
@@ -118,6 +140,8 @@ TimeSampling::TimeSampling()
 TimeSampling::TimeSampling( const TimeSampling & copy)
   : m_timeSamplingType( copy.m_timeSamplingType )
   , m_sampleTimes( copy.m_sampleTimes )
+  , m_acyclicBuckets( copy.m_acyclicBuckets )
+  , m_acyclicBucketScale( copy.m_acyclicBucketScale )
 {
     // nothing else
 }
@@ -127,6 +151,8 @@ TimeSampling & TimeSampling::operator=( const TimeSampling &copy )
 {
     m_timeSamplingType = copy.m_timeSamplingType;
     m_sampleTimes = copy.m_sampleTimes;
+    m_acyclicBuckets = copy.m_acyclicBuckets;
+    m_acyclicBucketScale = copy.m_acyclicBucketScale;
     return *this;
 }
 //-*****************************************************************************
@@ -180,28 +206,13 @@ TimeSampling::getFloorIndex( chrono_t iTime, index_t iNumSamples ) const
 
     if ( m_timeSamplingType.isAcyclic() )
     {
+        index_t hiIdx = getAcyclicUpperBound( iTime );
+        index_t loIdx = hiIdx - 1;
 
-        index_t loIdx = 0;
-        index_t hiIdx = m_sampleTimes.size() - 1;
-        index_t idx = hiIdx / 2;
-
-        while ( loIdx < idx && idx < hiIdx )
+        chrono_t loTime = m_sampleTimes[loIdx];
+        if ( iTime == loTime )
         {
-            chrono_t thisTime = m_sampleTimes[idx];
-            if ( iTime == thisTime )
-            {
-                return std::pair<index_t, chrono_t>( idx, thisTime );
-            }
-            else if ( iTime < thisTime )
-            {
-                hiIdx = idx;
-            }
-            // greater than
-            else
-            {
-                loIdx = idx;
-            }
-            idx = ( hiIdx + loIdx ) / 2;
+            return std::pair<index_t, chrono_t>( loIdx, loTime );
         }
 
         chrono_t hiTime = m_sampleTimes[hiIdx];
@@ -210,7 +221,7 @@ TimeSampling::getFloorIndex( chrono_t iTime, index_t iNumSamples ) const
         {
             return std::pair<index_t, chrono_t>( hiIdx, hiTime );
         }
-        return std::pair<index_t, chrono_t>( loIdx, m_sampleTimes[loIdx] );
+        return std::pair<index_t, chrono_t>( loIdx, loTime );
     }
     else if ( m_timeSamplingType.isUniform() )
     {
@@ -378,6 +389,133 @@ TimeSampling::getNearIndex( chrono_t iTime, index_t iNumSamples ) const
     return ceilPair;
 }
 
+//-*****************************************************************************
+index_t TimeSampling::getAcyclicUpperBound( chrono_t iTime ) const
+{
+    const index_t numTimes = ( index_t ) m_sampleTimes.size();
+
+    index_t bucket = ( index_t )
+        ( ( iTime - m_sampleTimes[0] ) * m_acyclicBucketScale );
+    bucket = std::max( ( index_t ) 0, std::min( bucket, numTimes - 1 ) );
+
+    // the bucket is only a guess, since it was found with floating point
+    // math, so walk to the exact answer from there
+    index_t idx = m_acyclicBuckets[bucket];
+    while ( idx > 0 && m_sampleTimes[idx - 1] > iTime )
+    {
+        --idx;
+    }
+
+    while ( idx < numTimes && m_sampleTimes[idx] <= iTime )
+    {
+        ++idx;
+    }
+
+    return idx;
+}
+
+//-*****************************************************************************
+void TimeSampling::getFloorIndices( chrono_t iTime,
+                                    const std::vector< index_t > & iNumSamples,
+                                    std::vector< index_t > & oIndices ) const
+{
+    getIndices( kFloor, iTime, iNumSamples, oIndices );
+}
+
+//-*****************************************************************************
+void TimeSampling::getCeilIndices( chrono_t iTime,
+                                   const std::vector< index_t > & iNumSamples,
+                                   std::vector< index_t > & oIndices ) const
+{
+    getIndices( kCeil, iTime, iNumSamples, oIndices );
+}
+
+//-*****************************************************************************
+void TimeSampling::getNearIndices( chrono_t iTime,
+                                   const std::vector< index_t > & iNumSamples,
+                                   std::vector< index_t > & oIndices ) const
+{
+    getIndices( kNear, iTime, iNumSamples, oIndices );
+}
+
+//-*****************************************************************************
+void TimeSampling::getIndices( IndexType iType, chrono_t iTime,
+                               const std::vector< index_t > & iNumSamples,
+                               std::vector< index_t > & oIndices ) const
+{
+    oIndices.resize( iNumSamples.size() );
+    if ( iNumSamples.empty() )
+    {
+        return;
+    }
+
+    index_t maxNumSamples = *std::max_element( iNumSamples.begin(),
+                                               iNumSamples.end() );
+
+    // acyclic sampling has no times past what is stored
+    if ( m_timeSamplingType.isAcyclic() )
+    {
+        maxNumSamples = std::min( maxNumSamples,
+                                  ( index_t ) m_sampleTimes.size() );
+    }
+
+    // The floor for the most samples is the floor for any property with
+    // more samples after it, and so is the time of the sample after that,
+    // the rest are at or near their last sample and are looked up directly.
+    std::pair<index_t, chrono_t> floorPair( 0, 0.0 );
+    chrono_t ceilTime = 0.0;
+    const chrono_t minTime = getSampleTime( 0 );
+
+    if ( maxNumSamples > 1 )
+    {
+        floorPair = getFloorIndex( iTime, maxNumSamples );
+        if ( floorPair.first < maxNumSamples - 1 )
+        {
+            ceilTime = getSampleTime( floorPair.first + 1 );
+        }
+    }
+
+    for ( size_t i = 0; i < iNumSamples.size(); ++i )
+    {
+        index_t numSamples = iNumSamples[i];
+
+        if ( numSamples < 1 )
+        {
+            oIndices[i] = 0;
+        }
+        else if ( floorPair.first >= numSamples - 1 || iTime <= minTime )
+        {
+            if ( iType == kFloor )
+            {
+                oIndices[i] = getFloorIndex( iTime, numSamples ).first;
+            }
+            else if ( iType == kCeil )
+            {
+                oIndices[i] = getCeilIndex( iTime, numSamples ).first;
+            }
+            else
+            {
+                oIndices[i] = getNearIndex( iTime, numSamples ).first;
+            }
+        }
+        else if ( iType == kFloor )
+        {
+            oIndices[i] = floorPair.first;
+        }
+        else if ( iType == kCeil )
+        {
+            oIndices[i] = Imath::equalWithAbsError( iTime, floorPair.second,
+                kCHRONO_EPSILON ) ? floorPair.first : floorPair.first + 1;
+        }
+        else
+        {
+            oIndices[i] = ( fabs( iTime - floorPair.second ) <=
+                fabs( ceilTime - iTime ) ) ?
+                floorPair.first : floorPair.first + 1;
+        }
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreAbstract
 } // End namespace Alembic
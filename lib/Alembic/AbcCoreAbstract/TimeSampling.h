@@ -123,6 +123,23 @@ public:
     std::pair<index_t, chrono_t> getNearIndex( chrono_t iTime,
         index_t iNumSamples ) const;
 
+    //! The same as calling getFloorIndex for each of iNumSamples, for
+    //! properties that share this TimeSampling but were written with a
+    //! different number of samples.  The search for iTime is only done once.
+    void getFloorIndices( chrono_t iTime,
+                          const std::vector< index_t > & iNumSamples,
+                          std::vector< index_t > & oIndices ) const;
+
+    //! getCeilIndex for each of iNumSamples, like getFloorIndices.
+    void getCeilIndices( chrono_t iTime,
+                         const std::vector< index_t > & iNumSamples,
+                         std::vector< index_t > & oIndices ) const;
+
+    //! getNearIndex for each of iNumSamples, like getFloorIndices.
+    void getNearIndices( chrono_t iTime,
+                         const std::vector< index_t > & iNumSamples,
+                         std::vector< index_t > & oIndices ) const;
+
 protected:
     //! A TimeSamplingType
     //! This is "Uniform", "Cyclic", or "Acyclic".
@@ -133,6 +150,23 @@ protected:
 private:
     // sanity checks the data coming in
     void init();
+
+    enum IndexType { kFloor, kCeil, kNear };
+
+    void getIndices( IndexType iType, chrono_t iTime,
+                     const std::vector< index_t > & iNumSamples,
+                     std::vector< index_t > & oIndices ) const;
+
+    // The index of the first acyclic sample after iTime, which has to be
+    // between the first and last sample times.
+    index_t getAcyclicUpperBound( chrono_t iTime ) const;
+
+    // For acyclic sampling, m_sampleTimes is split into as many buckets of
+    // equal time as there are times, and each bucket has the index of the
+    // first sample after its start, so a lookup only needs to look at the
+    // samples near that instead of searching all of them.
+    std::vector < index_t > m_acyclicBuckets;
+    chrono_t m_acyclicBucketScale;
 };
 
 typedef Alembic::Util::shared_ptr<TimeSampling> TimeSamplingPtr;
@@ -50,6 +50,7 @@ namespace ALEMBIC_VERSION_NS {
 IFactory::IFactory()
 {
     m_cacheHierarchy = true;
+    m_layerCacheHierarchy = false;
     m_numStreams = 1;
     m_readStrategy = kMemoryMappedFiles;
     m_policy = Alembic::Abc::ErrorHandler::kThrowPolicy;
@@ -128,7 +129,7 @@ Alembic::Abc::IArchive IFactory::getArchive(
 Alembic::Abc::IArchive IFactory::getArchive(
     const std::vector< std::string > & iFileNames, CoreType & oType )
 {
-    Alembic::AbcCoreLayer::ReadArchive layer;
+    Alembic::AbcCoreLayer::ReadArchive layer( m_layerCacheHierarchy );
 
     Alembic::AbcCoreLayer::ArchiveReaderPtrs archives;
 
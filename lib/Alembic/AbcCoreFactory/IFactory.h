@@ -99,6 +99,17 @@ public:
     //! Gets whether an HDF5 file will use the cached hierarchy
     bool getHDF5CacheHierarchy() const { return m_cacheHierarchy; }
 
+    //! When layering files, sets whether the layered hierarchy is worked out
+    //! once up front (in parallel) and cached, so traversing it later is just
+    //! lookups, the default value is false
+    void setLayerCacheHierarchy( bool iCacheHierarchy )
+    {
+        m_layerCacheHierarchy = iCacheHierarchy;
+    }
+
+    //! Gets whether layered files will cache the layered hierarchy
+    bool getLayerCacheHierarchy() const { return m_layerCacheHierarchy; }
+
     //! Set the array sample cache, the HDF5 implementation optionally uses this
     void setSampleCache(
         Alembic::AbcCoreAbstract::ReadArraySampleCachePtr iCachePtr )
@@ -151,6 +162,7 @@ public:
 
 private:
     bool m_cacheHierarchy;
+    bool m_layerCacheHierarchy;
     size_t m_numStreams;
     OgawaReadStrategy m_readStrategy;
     Alembic::AbcCoreAbstract::ReadArraySampleCachePtr m_cachePtr;
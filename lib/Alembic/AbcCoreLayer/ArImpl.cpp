@@ -45,7 +45,7 @@ namespace AbcCoreLayer {
 namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
-ArImpl::ArImpl( ArchiveReaderPtrs & iArchives )
+ArImpl::ArImpl( ArchiveReaderPtrs & iArchives, bool iCacheHierarchy )
 {
     m_archiveVersion = -1;
     m_header.reset( new AbcA::ObjectHeader() );
@@ -114,6 +114,19 @@ ArImpl::ArImpl( ArchiveReaderPtrs & iArchives )
         m_archiveVersion = std::max( m_archiveVersion,
                                      (*it)->getArchiveVersion() );
     }
+
+    if ( iCacheHierarchy )
+    {
+        std::vector< AbcA::ObjectReaderPtr > tops;
+        tops.reserve( m_archives.size() );
+        ArchiveReaderPtrs::iterator arItr = m_archives.begin();
+        for ( ; arItr != m_archives.end(); ++arItr )
+        {
+            tops.push_back( (*arItr)->getTop() );
+        }
+
+        m_hierarchy = BuildHierarchyCache( tops );
+    }
 }
 
 //-*****************************************************************************
@@ -200,6 +213,27 @@ void ArImpl::setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr )
     // don't even bother
 }
 
+//-*****************************************************************************
+AbcA::ArraySampleAllocatorPtr ArImpl::getArraySampleAllocator()
+{
+    if ( m_archives.empty() )
+    {
+        return AbcA::ArraySampleAllocatorPtr();
+    }
+
+    return m_archives[0]->getArraySampleAllocator();
+}
+
+//-*****************************************************************************
+void ArImpl::setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iAllocator )
+{
+    ArchiveReaderPtrs::iterator arItr = m_archives.begin();
+    for ( ; arItr != m_archives.end(); ++arItr )
+    {
+        ( *arItr )->setArraySampleAllocator( iAllocator );
+    }
+}
+
 //-*****************************************************************************
 Util::uint32_t ArImpl::getNumTimeSamplings()
 {
@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreLayer_ArImpl_h
 
 #include <Alembic/AbcCoreLayer/Foundation.h>
+#include <Alembic/AbcCoreLayer/HierarchyCache.h>
 
 namespace Alembic {
 namespace AbcCoreLayer {
@@ -54,7 +55,7 @@ class ArImpl
 private:
     friend class ReadArchive;
 
-    ArImpl( ArchiveReaderPtrs & iArchives );
+    ArImpl( ArchiveReaderPtrs & iArchives, bool iCacheHierarchy );
 
 
 public:
@@ -78,6 +79,12 @@ public:
 
     virtual void setReadArraySampleCachePtr( AbcA::ReadArraySampleCachePtr iPtr );
 
+    //! The allocator is set on every layer, since samples are read from them.
+    virtual AbcA::ArraySampleAllocatorPtr getArraySampleAllocator();
+
+    virtual void
+    setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iAllocator );
+
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
         Util::uint32_t iIndex );
 
@@ -85,6 +92,10 @@ public:
 
     virtual Util::int32_t getArchiveVersion();
 
+    //! The layered hierarchy built up front, or an empty pointer if this
+    //! archive wasn't asked to cache it.
+    ObjectNodePtr getHierarchyCache() const { return m_hierarchy; }
+
 private:
     std::string m_fileName;
 
@@ -99,6 +110,7 @@ private:
 
     Util::int32_t m_archiveVersion;
 
+    ObjectNodePtr m_hierarchy;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -48,10 +48,12 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 
 //-*****************************************************************************
-CprImpl::CprImpl( OrImplPtr iObject, CompoundReaderPtrs & iCompounds )
+CprImpl::CprImpl( OrImplPtr iObject, CompoundReaderPtrs & iCompounds,
+                  CompoundNodePtr iNode )
     : m_object( iObject )
     , m_parent( CprImplPtr() )
     , m_index( 0 )
+    , m_node( iNode )
 {
     ABCA_ASSERT( m_object, "Invalid object in CprImpl(Object)" );
     std::string empty;
@@ -70,6 +72,11 @@ CprImpl::CprImpl( CprImplPtr iParent, size_t iIndex )
     ABCA_ASSERT( m_parent, "Invalid compound in CprImpl(CprImplPtr, size_t)" );
     m_object = m_parent->m_object;
 
+    if ( m_parent->m_node )
+    {
+        m_node = m_parent->m_node->childCompounds[m_index];
+    }
+
     // get our compounds for the init
     CompoundReaderPtrs  & childVec = m_parent->m_children[m_index];
 
@@ -134,8 +141,11 @@ const AbcA::PropertyHeader & CprImpl::getPropertyHeader( size_t i )
     ABCA_ASSERT( i < m_children.size(),
         "Out of range index in CprImpl::getPropertyHeader: " << i );
 
-    return m_children[ i ][ m_childHeaderIndex[ i ].first ]->getPropertyHeader(
-        m_childHeaderIndex[ i ].second );
+    const CompoundMerge::HeaderIndexPair & headerIndex =
+        m_merge->childHeaderIndex[ i ];
+
+    return m_children[ i ][ headerIndex.first ]->getPropertyHeader(
+        headerIndex.second );
 }
 
 //-*****************************************************************************
@@ -143,13 +153,11 @@ const AbcA::PropertyHeader *
 CprImpl::getPropertyHeader( const std::string &iName )
 {
 
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    ChildNameMap::const_iterator itr = m_merge->childNameMap.find( iName );
 
-    if( itr !=  m_childNameMap.end() )
+    if( itr !=  m_merge->childNameMap.end() )
     {
-        return &( m_children[ itr->second ][
-            m_childHeaderIndex[ itr->second ].first ]->getPropertyHeader(
-                m_childHeaderIndex[ itr->second ].second ) );
+        return &( getPropertyHeader( itr->second ) );
     }
 
     return 0;
@@ -159,9 +167,9 @@ CprImpl::getPropertyHeader( const std::string &iName )
 AbcA::ScalarPropertyReaderPtr
 CprImpl::getScalarProperty( const std::string &iName )
 {
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    ChildNameMap::const_iterator itr = m_merge->childNameMap.find( iName );
 
-    if( itr != m_childNameMap.end() )
+    if( itr != m_merge->childNameMap.end() )
     {
         return m_children[ itr->second ].back()->getScalarProperty(
             itr->first );
@@ -174,9 +182,9 @@ CprImpl::getScalarProperty( const std::string &iName )
 AbcA::ArrayPropertyReaderPtr
 CprImpl::getArrayProperty( const std::string &iName )
 {
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    ChildNameMap::const_iterator itr = m_merge->childNameMap.find( iName );
 
-    if( itr != m_childNameMap.end() )
+    if( itr != m_merge->childNameMap.end() )
     {
         return m_children[ itr->second ].back()->getArrayProperty( itr->first );
     }
@@ -188,9 +196,9 @@ CprImpl::getArrayProperty( const std::string &iName )
 AbcA::CompoundPropertyReaderPtr
 CprImpl::getCompoundProperty( const std::string &iName )
 {
-    ChildNameMap::iterator itr = m_childNameMap.find( iName );
+    ChildNameMap::const_iterator itr = m_merge->childNameMap.find( iName );
 
-    if( itr != m_childNameMap.end() )
+    if( itr != m_merge->childNameMap.end() )
     {
         return CprImplPtr( new CprImpl( shared_from_this(), itr->second ) );
     }
@@ -201,102 +209,26 @@ CprImpl::getCompoundProperty( const std::string &iName )
 //-*****************************************************************************
 void CprImpl::init( CompoundReaderPtrs & iCompounds )
 {
-    CompoundReaderPtrs::iterator it = iCompounds.begin();
+    if ( m_node )
+    {
+        m_merge = m_node->merge;
+    }
+    else
+    {
+        Alembic::Util::shared_ptr< CompoundMerge > merge( new CompoundMerge() );
+        MergeCompounds( iCompounds, *merge );
+        m_merge = merge;
+    }
 
-    for ( ; it != iCompounds.end(); ++it )
+    m_children.resize( m_merge->children.size() );
+    for ( size_t i = 0; i < m_merge->children.size(); ++i )
     {
-        for ( size_t i = 0; i < (*it)->getNumProperties(); ++i )
+        const std::vector< size_t > & child = m_merge->children[i];
+
+        m_children[i].reserve( child.size() );
+        for ( size_t j = 0; j < child.size(); ++j )
         {
-            const AbcA::PropertyHeader & propHeader =
-                (*it)->getPropertyHeader( i );
-
-            // since pruning is more destructive, it trumps replace
-            bool shouldPrune =
-                ( propHeader.getMetaData().get( "prune" ) == "1" );
-
-            bool shouldReplace =
-                ( propHeader.getMetaData().get( "replace" ) == "1" );
-
-            ChildNameMap::iterator nameIt = m_childNameMap.find(
-                propHeader.getName() );
-
-            // brand new child, add it (if not a prune) and continue
-            if ( nameIt == m_childNameMap.end() )
-            {
-                // new prop that was marked for pruning, so skip
-                if ( shouldPrune )
-                {
-                    continue;
-                }
-
-                size_t index = m_childNameMap.size();
-                m_childNameMap[ propHeader.getName() ] = index;
-
-                m_children.resize( index + 1 );
-                m_children[ index ].push_back( *it );
-                m_childHeaderIndex.push_back( HeaderIndexPair( 0, i ) );
-                continue;
-            }
-            // prune
-            else if ( shouldPrune )
-            {
-                size_t index = nameIt->second;
-
-                // prune, time to clear out existing data
-                m_children.erase( m_children.begin() + index );
-                m_childHeaderIndex.erase( m_childHeaderIndex.begin() + index );
-                m_childNameMap.erase( nameIt );
-
-                // since we removed an element, update the indices in our map
-                for ( nameIt = m_childNameMap.begin();
-                      nameIt != m_childNameMap.end(); ++nameIt )
-                {
-                    if ( nameIt->second > index )
-                    {
-                        nameIt->second --;
-                    }
-                }
-
-            }
-            // only add this onto an existing one IF its a compound and the
-            // prop added previously is a compound
-            else if ( propHeader.isCompound() &&
-                      m_children[ nameIt->second ][ m_childHeaderIndex[
-                            nameIt->second ].first ]->getPropertyHeader(
-                                m_childHeaderIndex[ nameIt->second ].second
-                            ).isCompound() )
-            {
-                // add parent and index to the existing child element, and then
-                // update the MetaData
-                size_t index = nameIt->second;
-
-                if ( shouldReplace )
-                {
-                    m_children[ index ].clear();
-                }
-
-                m_children[ index ].push_back( *it );
-
-                // for special case sparse hiearchies we don't want empty meta data
-                // on a compound to override existing non empty metadata
-                if ( propHeader.getMetaData().size() != 0 )
-                {
-                    m_childHeaderIndex[ index ].first =
-                        m_children[ index ].size() - 1;
-                    m_childHeaderIndex[ index ].second = i;
-                }
-            }
-
-            // for cases where we have a simple property type, or the property
-            // type is different
-            else
-            {
-                size_t index = nameIt->second;
-                m_children[ index ].clear();
-                m_children[ index ].push_back( *it );
-                m_childHeaderIndex[ index ].first = 0;
-                m_childHeaderIndex[ index ].second = i;
-            }
+            m_children[i].push_back( iCompounds[ child[j] ] );
         }
     }
 }
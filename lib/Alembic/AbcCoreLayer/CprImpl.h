@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreLayer_CprImpl_h
 
 #include <Alembic/AbcCoreLayer/Foundation.h>
+#include <Alembic/AbcCoreLayer/HierarchyCache.h>
 
 namespace Alembic {
 namespace AbcCoreLayer {
@@ -53,7 +54,8 @@ class CprImpl
 public:
 
     CprImpl( OrImplPtr iObject,
-             CompoundReaderPtrs & iCompounds );
+             CompoundReaderPtrs & iCompounds,
+             CompoundNodePtr iNode = CompoundNodePtr() );
 
     CprImpl( CprImplPtr iParent, size_t iIndex );
 
@@ -102,19 +104,18 @@ private:
 
     // we need to own the PropertyHeader on the top compounds
     // (which have no parents), others we can get from
-    // m_children and m_childHeaderIndex below
+    // m_children and m_merge below
     PropertyHeaderPtr m_topHeader;
 
+    // our spot in the archives cached hierarchy, if it has one
+    CompoundNodePtr m_node;
+
+    // our layered properties, either from m_node or merged by init
+    CompoundMergePtr m_merge;
+
     // each child is made up of the original parent compound, array and scalar
     // properties will only have 1 entry, compounds could have more
     std::vector< CompoundReaderPtrs > m_children;
-
-    // so we don't have to copy property headers over, keep track of what
-    // index to use for the header from the appropriate parent in m_children
-    typedef std::pair< size_t, size_t > HeaderIndexPair;
-    std::vector< HeaderIndexPair > m_childHeaderIndex;
-
-    ChildNameMap m_childNameMap;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
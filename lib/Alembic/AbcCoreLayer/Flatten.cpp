@@ -0,0 +1,334 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreLayer/Flatten.h>
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// A property whose writer has been made, with the samples still to copy.
+struct FlatJob
+{
+    AbcA::ArrayPropertyReaderPtr iArray;
+    AbcA::ArrayPropertyWriterPtr oArray;
+    AbcA::ScalarPropertyReaderPtr iScalar;
+    AbcA::ScalarPropertyWriterPtr oScalar;
+
+    size_t numSamples;
+
+    // only the first sample of a constant property is read
+    size_t numToRead;
+    size_t next;
+
+    // the last raw array sample written, the key read with the next one
+    // tells us if it is a repeat
+    bool hasPrev;
+    AbcA::ArraySampleKey prevKey;
+    AbcA::Dimensions prevDims;
+};
+
+//-*****************************************************************************
+// One sample read ahead of being written.
+struct FlatSample
+{
+    FlatJob * job;
+    size_t index;
+
+    bool isRaw;
+    AbcA::RawArraySample raw;
+
+    // scalars, and arrays that couldn't be read raw
+    AbcA::ArraySamplePtr sample;
+};
+
+//-*****************************************************************************
+AbcA::MetaData cleanMetaData( const AbcA::MetaData & iMetaData )
+{
+    AbcA::MetaData md;
+    AbcA::MetaData::const_iterator it = iMetaData.begin();
+    for ( ; it != iMetaData.end(); ++it )
+    {
+        if ( it->first != "prune" && it->first != "replace" )
+        {
+            md.set( it->first, it->second );
+        }
+    }
+    return md;
+}
+
+//-*****************************************************************************
+void readSample( FlatSample & ioSample )
+{
+    FlatJob & job = *ioSample.job;
+    if ( job.iArray )
+    {
+        ioSample.isRaw = job.iArray->getRawSample( ioSample.index,
+                                                   ioSample.raw );
+        if ( !ioSample.isRaw )
+        {
+            job.iArray->getSample( ioSample.index, ioSample.sample );
+        }
+        return;
+    }
+
+    // also gives us std::string storage for the string types
+    ioSample.sample = AbcA::AllocateArraySample(
+        job.iScalar->getHeader().getDataType(), AbcA::Dimensions( 1 ) );
+    job.iScalar->getSample( ioSample.index,
+        const_cast< void * >( ioSample.sample->getData() ) );
+}
+
+//-*****************************************************************************
+void writeSample( FlatSample & ioSample )
+{
+    FlatJob & job = *ioSample.job;
+    if ( job.oScalar )
+    {
+        job.oScalar->setSample( ioSample.sample->getData() );
+        return;
+    }
+
+    if ( ioSample.isRaw )
+    {
+        const AbcA::RawArraySample & raw = ioSample.raw;
+        if ( job.hasPrev && raw.key == job.prevKey &&
+             raw.dims == job.prevDims )
+        {
+            job.oArray->setFromPreviousSample();
+            return;
+        }
+
+        if ( job.oArray->setRawSample( raw ) )
+        {
+            job.hasPrev = true;
+            job.prevKey = raw.key;
+            job.prevDims = raw.dims;
+            return;
+        }
+
+        job.iArray->getSample( ioSample.index, ioSample.sample );
+    }
+
+    job.oArray->setSample( *ioSample.sample );
+    job.hasPrev = false;
+}
+
+//-*****************************************************************************
+// Makes the writers for the whole hierarchy in order, and copies the samples
+// of the properties it has made writers for in bounded batches.  Each batch
+// is read in parallel on the default TaskPool, across as many properties
+// (and objects) as are waiting, and then written from the calling thread.
+class Flattener
+{
+public:
+    Flattener()
+      : m_batchSize(
+            4 * std::max< size_t >( 1,
+                Alembic::Util::TaskPool::getDefault().getNumThreads() ) )
+    {
+    }
+
+    void flattenObject( AbcA::ObjectReaderPtr iObject,
+                        AbcA::ObjectWriterPtr oObject )
+    {
+        flattenCompound( iObject->getProperties(), oObject->getProperties() );
+
+        for ( size_t i = 0; i < iObject->getNumChildren(); ++i )
+        {
+            AbcA::ObjectReaderPtr child = iObject->getChild( i );
+            const AbcA::ObjectHeader & header = child->getHeader();
+            flattenObject( child, oObject->createChild(
+                AbcA::ObjectHeader( header.getName(),
+                                    cleanMetaData( header.getMetaData() ) ) ) );
+        }
+    }
+
+    // copies whatever is still waiting
+    void flush()
+    {
+        while ( !m_jobs.empty() )
+        {
+            copyBatch();
+        }
+    }
+
+private:
+    void flattenCompound( AbcA::CompoundPropertyReaderPtr iProp,
+                          AbcA::CompoundPropertyWriterPtr oProp )
+    {
+        AbcA::ArchiveWriterPtr archive = oProp->getObject()->getArchive();
+
+        for ( size_t i = 0; i < iProp->getNumProperties(); ++i )
+        {
+            const AbcA::PropertyHeader & header =
+                iProp->getPropertyHeader( i );
+            const std::string & name = header.getName();
+            AbcA::MetaData md = cleanMetaData( header.getMetaData() );
+
+            if ( header.isCompound() )
+            {
+                flattenCompound( iProp->getCompoundProperty( name ),
+                                 oProp->createCompoundProperty( name, md ) );
+                continue;
+            }
+
+            Util::uint32_t tsIdx =
+                archive->addTimeSampling( *header.getTimeSampling() );
+
+            FlatJob job;
+            job.next = 0;
+            job.hasPrev = false;
+            if ( header.isArray() )
+            {
+                job.iArray = iProp->getArrayProperty( name );
+                job.oArray = oProp->createArrayProperty( name, md,
+                    header.getDataType(), tsIdx );
+                job.numSamples = job.iArray->getNumSamples();
+                job.numToRead = job.iArray->isConstant() ?
+                    std::min< size_t >( 1, job.numSamples ) : job.numSamples;
+            }
+            else
+            {
+                job.iScalar = iProp->getScalarProperty( name );
+                job.oScalar = oProp->createScalarProperty( name, md,
+                    header.getDataType(), tsIdx );
+                job.numSamples = job.iScalar->getNumSamples();
+                job.numToRead = job.iScalar->isConstant() ?
+                    std::min< size_t >( 1, job.numSamples ) : job.numSamples;
+            }
+            m_jobs.push_back( job );
+
+            if ( m_jobs.size() >= m_batchSize )
+            {
+                copyBatch();
+            }
+        }
+    }
+
+    // reads and writes up to m_batchSize samples, spread over the waiting
+    // properties, and lets go of the properties that are done
+    void copyBatch()
+    {
+        size_t perJob = std::max< size_t >( 1, m_batchSize / m_jobs.size() );
+
+        std::vector< FlatSample > batch;
+        for ( size_t i = 0; i < m_jobs.size(); ++i )
+        {
+            FlatJob & job = m_jobs[i];
+            size_t end = std::min( job.numToRead, job.next + perJob );
+            for ( size_t j = job.next; j < end; ++j )
+            {
+                FlatSample samp;
+                samp.job = &job;
+                samp.index = j;
+                samp.isRaw = false;
+                batch.push_back( samp );
+            }
+        }
+
+        Alembic::Util::ParallelFor( 0, batch.size(),
+            [&]( size_t i )
+            {
+                readSample( batch[i] );
+            } );
+
+        for ( size_t i = 0; i < batch.size(); ++i )
+        {
+            writeSample( batch[i] );
+            batch[i].job->next = batch[i].index + 1;
+
+            // release the bytes as we go
+            batch[i].raw = AbcA::RawArraySample();
+            batch[i].sample.reset();
+        }
+
+        std::vector< FlatJob > waiting;
+        for ( size_t i = 0; i < m_jobs.size(); ++i )
+        {
+            FlatJob & job = m_jobs[i];
+            if ( job.next < job.numToRead )
+            {
+                waiting.push_back( job );
+                continue;
+            }
+
+            // the rest of a constant property
+            for ( size_t j = job.numToRead; j < job.numSamples; ++j )
+            {
+                if ( job.oArray )
+                {
+                    job.oArray->setFromPreviousSample();
+                }
+                else
+                {
+                    job.oScalar->setFromPreviousSample();
+                }
+            }
+        }
+        m_jobs.swap( waiting );
+    }
+
+    size_t m_batchSize;
+    std::vector< FlatJob > m_jobs;
+};
+
+} // namespace
+
+//-*****************************************************************************
+void Flatten( AbcA::ArchiveReaderPtr iArchive,
+              AbcA::ArchiveWriterPtr oArchive )
+{
+    ABCA_ASSERT( iArchive && oArchive, "Invalid archive in Flatten" );
+
+    // keep the time samplings in the same order
+    for ( Util::uint32_t i = 1; i < iArchive->getNumTimeSamplings(); ++i )
+    {
+        oArchive->addTimeSampling( *iArchive->getTimeSampling( i ) );
+    }
+
+    Flattener flattener;
+    flattener.flattenObject( iArchive->getTop(), oArchive->getTop() );
+    flattener.flush();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
@@ -0,0 +1,69 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreLayer_Flatten_h
+#define Alembic_AbcCoreLayer_Flatten_h
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreLayer/Foundation.h>
+#include <Alembic/Util/Export.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//! Writes everything in iArchive, usually a layered archive from ReadArchive
+//! or IFactory::getArchive( files ), into oArchive as a single unlayered
+//! hierarchy.  Pruned objects and properties are left out, and the prune
+//! and replace markers are removed from the MetaData that is written.
+//! Array samples are handed over as they are stored (see
+//! ArrayPropertyReader::getRawSample) when both sides support it, so
+//! unchanged data isn't decompressed and compressed again, and the key read
+//! with each sample is used to write repeated samples as repeats.  Samples
+//! are copied in small batches, spread over as many properties and objects
+//! as are waiting, each read in parallel on the default TaskPool while
+//! oArchive is written to from the calling thread only.
+ALEMBIC_EXPORT void Flatten( AbcA::ArchiveReaderPtr iArchive,
+                             AbcA::ArchiveWriterPtr oArchive );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
+
+#endif //_Alembic_AbcCoreLayer_Flatten_h_
@@ -0,0 +1,313 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreLayer/HierarchyCache.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+void MergeObjects( const std::vector< AbcA::ObjectReaderPtr > & iObjects,
+                   ObjectMerge & oMerge )
+{
+    for ( size_t j = 0; j < iObjects.size(); ++j )
+    {
+        const AbcA::ObjectReaderPtr & obj = iObjects[j];
+        for ( size_t i = 0; i < obj->getNumChildren(); ++i )
+        {
+            const AbcA::ObjectHeader & objHeader = obj->getChildHeader( i );
+            bool shouldPrune =
+                ( objHeader.getMetaData().get( "prune" ) == "1" );
+
+            bool shouldReplace =
+                ( objHeader.getMetaData().get( "replace" ) == "1" );
+
+            ChildNameMap::iterator nameIt = oMerge.childNameMap.find(
+                objHeader.getName() );
+
+            size_t index = 0;
+
+            // brand new child, add it (if not pruning) and continue
+            if ( nameIt == oMerge.childNameMap.end() )
+            {
+                if ( !shouldPrune )
+                {
+                    index = oMerge.childNameMap.size();
+                    oMerge.childNameMap[ objHeader.getName() ] = index;
+                    ObjectHeaderPtr headerPtr(
+                        new AbcA::ObjectHeader( objHeader ) );
+                    oMerge.childHeaders.push_back( headerPtr );
+                    oMerge.children.resize( index + 1 );
+                    oMerge.children[ index ].push_back(
+                        ObjectMerge::SourceAndIndex( j, i ) );
+                }
+
+                continue;
+            }
+
+            index = nameIt->second;
+
+            // no prune, so add to existing data
+            if ( !shouldPrune )
+            {
+                if ( shouldReplace )
+                {
+                    oMerge.children[ index ].clear();
+                    oMerge.childHeaders[ index ]->getMetaData() =
+                        AbcA::MetaData();
+                }
+
+                // add parent and index to the existing child element, and then
+                // update the MetaData
+                oMerge.children[ index ].push_back(
+                    ObjectMerge::SourceAndIndex( j, i ) );
+
+                // update the found childs meta data
+                oMerge.childHeaders[ index ]->getMetaData().appendOnlyUnique(
+                    objHeader.getMetaData() );
+                continue;
+            }
+
+            // prune, time to clear out existing data
+            oMerge.children.erase( oMerge.children.begin() + index );
+            oMerge.childHeaders.erase( oMerge.childHeaders.begin() + index );
+            oMerge.childNameMap.erase( nameIt );
+
+            // since we removed an element, update the indices in our name map
+            for ( nameIt = oMerge.childNameMap.begin();
+                  nameIt != oMerge.childNameMap.end(); ++nameIt )
+            {
+                if ( nameIt->second > index )
+                {
+                    nameIt->second --;
+                }
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void MergeCompounds( const CompoundReaderPtrs & iCompounds,
+                     CompoundMerge & oMerge )
+{
+    for ( size_t j = 0; j < iCompounds.size(); ++j )
+    {
+        const AbcA::CompoundPropertyReaderPtr & cmpnd = iCompounds[j];
+        for ( size_t i = 0; i < cmpnd->getNumProperties(); ++i )
+        {
+            const AbcA::PropertyHeader & propHeader =
+                cmpnd->getPropertyHeader( i );
+
+            // since pruning is more destructive, it trumps replace
+            bool shouldPrune =
+                ( propHeader.getMetaData().get( "prune" ) == "1" );
+
+            bool shouldReplace =
+                ( propHeader.getMetaData().get( "replace" ) == "1" );
+
+            ChildNameMap::iterator nameIt = oMerge.childNameMap.find(
+                propHeader.getName() );
+
+            // brand new child, add it (if not a prune) and continue
+            if ( nameIt == oMerge.childNameMap.end() )
+            {
+                // new prop that was marked for pruning, so skip
+                if ( shouldPrune )
+                {
+                    continue;
+                }
+
+                size_t index = oMerge.childNameMap.size();
+                oMerge.childNameMap[ propHeader.getName() ] = index;
+
+                oMerge.children.resize( index + 1 );
+                oMerge.children[ index ].push_back( j );
+                oMerge.childHeaderIndex.push_back(
+                    CompoundMerge::HeaderIndexPair( 0, i ) );
+                continue;
+            }
+
+            size_t index = nameIt->second;
+            std::vector< size_t > & child = oMerge.children[ index ];
+            CompoundMerge::HeaderIndexPair & headerIndex =
+                oMerge.childHeaderIndex[ index ];
+
+            // prune
+            if ( shouldPrune )
+            {
+                // prune, time to clear out existing data
+                oMerge.children.erase( oMerge.children.begin() + index );
+                oMerge.childHeaderIndex.erase(
+                    oMerge.childHeaderIndex.begin() + index );
+                oMerge.childNameMap.erase( nameIt );
+
+                // since we removed an element, update the indices in our map
+                for ( nameIt = oMerge.childNameMap.begin();
+                      nameIt != oMerge.childNameMap.end(); ++nameIt )
+                {
+                    if ( nameIt->second > index )
+                    {
+                        nameIt->second --;
+                    }
+                }
+
+            }
+            // only add this onto an existing one IF its a compound and the
+            // prop added previously is a compound
+            else if ( propHeader.isCompound() &&
+                      iCompounds[ child[ headerIndex.first ] ]->
+                        getPropertyHeader( headerIndex.second ).isCompound() )
+            {
+                if ( shouldReplace )
+                {
+                    child.clear();
+                }
+
+                child.push_back( j );
+
+                // for special case sparse hiearchies we don't want empty meta
+                // data on a compound to override existing non empty metadata
+                if ( propHeader.getMetaData().size() != 0 )
+                {
+                    headerIndex.first = child.size() - 1;
+                    headerIndex.second = i;
+                }
+            }
+
+            // for cases where we have a simple property type, or the property
+            // type is different
+            else
+            {
+                child.clear();
+                child.push_back( j );
+                headerIndex.first = 0;
+                headerIndex.second = i;
+            }
+        }
+    }
+}
+
+namespace {
+
+//-*****************************************************************************
+CompoundNodePtr buildCompound( const CompoundReaderPtrs & iCompounds )
+{
+    Alembic::Util::shared_ptr< CompoundNode > node( new CompoundNode() );
+    Alembic::Util::shared_ptr< CompoundMerge > merge( new CompoundMerge() );
+    MergeCompounds( iCompounds, *merge );
+    node->merge = merge;
+
+    node->childCompounds.resize( merge->children.size() );
+    ChildNameMap::const_iterator it = merge->childNameMap.begin();
+    for ( ; it != merge->childNameMap.end(); ++it )
+    {
+        const std::vector< size_t > & child = merge->children[ it->second ];
+        const CompoundMerge::HeaderIndexPair & headerIndex =
+            merge->childHeaderIndex[ it->second ];
+
+        if ( !iCompounds[ child[ headerIndex.first ] ]->getPropertyHeader(
+                headerIndex.second ).isCompound() )
+        {
+            continue;
+        }
+
+        CompoundReaderPtrs childCompounds;
+        childCompounds.reserve( child.size() );
+        for ( size_t i = 0; i < child.size(); ++i )
+        {
+            childCompounds.push_back(
+                iCompounds[ child[i] ]->getCompoundProperty( it->first ) );
+        }
+
+        node->childCompounds[ it->second ] = buildCompound( childCompounds );
+    }
+
+    return node;
+}
+
+//-*****************************************************************************
+ObjectNodePtr buildObject( const std::vector< AbcA::ObjectReaderPtr > &
+                           iObjects )
+{
+    Alembic::Util::shared_ptr< ObjectNode > node( new ObjectNode() );
+    Alembic::Util::shared_ptr< ObjectMerge > merge( new ObjectMerge() );
+    MergeObjects( iObjects, *merge );
+    node->merge = merge;
+
+    // the top compounds of each layer are read in parallel
+    CompoundReaderPtrs compounds( iObjects.size() );
+    Alembic::Util::ParallelFor( 0, iObjects.size(),
+        [&]( size_t i )
+        {
+            compounds[i] = iObjects[i]->getProperties();
+        } );
+    node->properties = buildCompound( compounds );
+
+    // and then each child subtree, opening the layers that make it up
+    node->childNodes.resize( merge->children.size() );
+    Alembic::Util::ParallelFor( 0, merge->children.size(),
+        [&]( size_t i )
+        {
+            const std::vector< ObjectMerge::SourceAndIndex > & child =
+                merge->children[i];
+
+            std::vector< AbcA::ObjectReaderPtr > childObjects;
+            childObjects.reserve( child.size() );
+            for ( size_t j = 0; j < child.size(); ++j )
+            {
+                childObjects.push_back(
+                    iObjects[ child[j].first ]->getChild( child[j].second ) );
+            }
+
+            node->childNodes[i] = buildObject( childObjects );
+        } );
+
+    return node;
+}
+
+} // namespace
+
+//-*****************************************************************************
+ObjectNodePtr BuildHierarchyCache(
+    const std::vector< AbcA::ObjectReaderPtr > & iTops )
+{
+    return buildObject( iTops );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
@@ -0,0 +1,136 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreLayer_HierarchyCache_h
+#define Alembic_AbcCoreLayer_HierarchyCache_h
+
+#include <Alembic/AbcCoreLayer/Foundation.h>
+
+namespace Alembic {
+namespace AbcCoreLayer {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The result of layering the children of several objects together.
+//! Children are referred to by the position of the layered object they came
+//! from, and their index within it.
+struct ObjectMerge
+{
+    typedef std::pair< size_t, size_t > SourceAndIndex;
+
+    // all of our compounded child headers
+    std::vector< ObjectHeaderPtr > childHeaders;
+
+    ChildNameMap childNameMap;
+
+    // each child is made up of the original parent objects and the index
+    // in each of them where that child lives
+    std::vector< std::vector< SourceAndIndex > > children;
+};
+
+typedef Alembic::Util::shared_ptr< const ObjectMerge > ObjectMergePtr;
+
+//! Layers the children of iObjects, honoring prune and replace.
+void MergeObjects( const std::vector< AbcA::ObjectReaderPtr > & iObjects,
+                   ObjectMerge & oMerge );
+
+//-*****************************************************************************
+//! The result of layering the properties of several compounds together.
+struct CompoundMerge
+{
+    typedef std::pair< size_t, size_t > HeaderIndexPair;
+
+    ChildNameMap childNameMap;
+
+    // the positions of the layered compounds that make up each child,
+    // array and scalar properties will only have 1 entry
+    std::vector< std::vector< size_t > > children;
+
+    // which entry in children, and which index within that compound, has
+    // the header for each child
+    std::vector< HeaderIndexPair > childHeaderIndex;
+};
+
+typedef Alembic::Util::shared_ptr< const CompoundMerge > CompoundMergePtr;
+
+//! Layers the properties of iCompounds, honoring prune and replace.
+void MergeCompounds( const CompoundReaderPtrs & iCompounds,
+                     CompoundMerge & oMerge );
+
+//-*****************************************************************************
+class CompoundNode;
+typedef Alembic::Util::shared_ptr< const CompoundNode > CompoundNodePtr;
+
+class ObjectNode;
+typedef Alembic::Util::shared_ptr< const ObjectNode > ObjectNodePtr;
+
+//! A compound property in the precomputed layered hierarchy.
+class CompoundNode
+{
+public:
+    CompoundMergePtr merge;
+
+    // matches merge->children, empty for array and scalar properties
+    std::vector< CompoundNodePtr > childCompounds;
+};
+
+//! An object in the precomputed layered hierarchy.  An archive which caches
+//! its hierarchy builds the whole tree once, after which OrImpl and CprImpl
+//! just look up their merged children here instead of layering them again.
+class ObjectNode
+{
+public:
+    ObjectMergePtr merge;
+
+    // matches merge->children
+    std::vector< ObjectNodePtr > childNodes;
+
+    CompoundNodePtr properties;
+};
+
+//! Layers the entire hierarchy under iTops (in layering order) once.
+//! Sibling subtrees, and the layers at each level, are read in parallel.
+ObjectNodePtr BuildHierarchyCache(
+    const std::vector< AbcA::ObjectReaderPtr > & iTops );
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreLayer
+} // End namespace Alembic
+
+#endif //_Alembic_AbcCoreLayer_HierarchyCache_h_
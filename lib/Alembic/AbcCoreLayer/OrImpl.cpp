@@ -58,6 +58,7 @@ OrImpl::OrImpl( ArImplPtr iArchive,
               , m_header( iHeader )
 {
     ABCA_ASSERT( m_archive, "Invalid archive in OrImpl(Archive)" );
+    m_node = m_archive->getHierarchyCache();
     init( iTops );
 }
 
@@ -68,7 +69,12 @@ OrImpl::OrImpl( OrImplPtr iParent, size_t iIndex )
     ABCA_ASSERT( m_parent, "Invalid object in OrImpl(OrImplPtr, size_t)" );
 
     m_archive = m_parent->m_archive;
-    m_header = m_parent->m_childHeaders[m_index];
+    m_header = m_parent->m_merge->childHeaders[m_index];
+
+    if ( m_parent->m_node )
+    {
+        m_node = m_parent->m_node->childNodes[m_index];
+    }
 
     // get our objects for the init
     std::vector< ObjectAndIndex >  & childVec =
@@ -116,8 +122,14 @@ AbcA::CompoundPropertyReaderPtr OrImpl::getProperties()
     AbcA::CompoundPropertyReaderPtr ret = m_top.lock();
     if ( ! ret )
     {
+        CompoundNodePtr node;
+        if ( m_node )
+        {
+            node = m_node->properties;
+        }
+
         ret = Alembic::Util::shared_ptr<CprImpl>(
-            new CprImpl( shared_from_this(), m_properties ) );
+            new CprImpl( shared_from_this(), m_properties, node ) );
         m_top = ret;
     }
 
@@ -127,26 +139,27 @@ AbcA::CompoundPropertyReaderPtr OrImpl::getProperties()
 //-*****************************************************************************
 size_t OrImpl::getNumChildren()
 {
-    return m_childHeaders.size();
+    return m_merge->childHeaders.size();
 }
 
 //-*****************************************************************************
 const AbcA::ObjectHeader & OrImpl::getChildHeader( size_t i )
 {
-    ABCA_ASSERT( i < m_childHeaders.size(),
+    ABCA_ASSERT( i < m_merge->childHeaders.size(),
         "Out of range index in OrData::getChildHeader: " << i );
 
-    return *( m_childHeaders[i] );
+    return *( m_merge->childHeaders[i] );
 }
 
 //-*****************************************************************************
 const AbcA::ObjectHeader * OrImpl::getChildHeader( const std::string &iName )
 {
-    ChildNameMap::iterator findChildItr = m_childNameMap.find( iName );
+    ChildNameMap::const_iterator findChildItr =
+        m_merge->childNameMap.find( iName );
 
-    if( findChildItr != m_childNameMap.end() )
+    if( findChildItr != m_merge->childNameMap.end() )
     {
-        return m_childHeaders[ findChildItr->second ].get();
+        return m_merge->childHeaders[ findChildItr->second ].get();
     }
 
     return 0;
@@ -155,9 +168,10 @@ const AbcA::ObjectHeader * OrImpl::getChildHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::ObjectReaderPtr OrImpl::getChild( const std::string &iName )
 {
-    ChildNameMap::iterator findChildItr = m_childNameMap.find( iName );
+    ChildNameMap::const_iterator findChildItr =
+        m_merge->childNameMap.find( iName );
 
-    if( findChildItr != m_childNameMap.end() )
+    if( findChildItr != m_merge->childNameMap.end() )
     {
         Alembic::Util::scoped_lock l( m_lock );
 
@@ -178,7 +192,7 @@ AbcA::ObjectReaderPtr OrImpl::getChild( const std::string &iName )
 
 AbcA::ObjectReaderPtr OrImpl::getChild( size_t i )
 {
-    if ( i < m_childHeaders.size() )
+    if ( i < m_merge->childHeaders.size() )
     {
         Alembic::Util::scoped_lock l( m_lock );
 
@@ -245,7 +259,7 @@ bool OrImpl::getChildrenHash( Util::Digest & oDigest )
 }
 
 //-*****************************************************************************
-// This layers the children together, and creates
+// This layers the children together, unless the archive already did
 void OrImpl::init( std::vector< AbcA::ObjectReaderPtr > & iObjects )
 {
 
@@ -257,74 +271,31 @@ void OrImpl::init( std::vector< AbcA::ObjectReaderPtr > & iObjects )
     for ( ; it != iObjects.end(); ++it )
     {
         m_properties.push_back( (*it)->getProperties() );
-        for ( size_t i = 0; i < (*it)->getNumChildren(); ++i )
+    }
+
+    if ( m_node )
+    {
+        m_merge = m_node->merge;
+    }
+    else
+    {
+        Alembic::Util::shared_ptr< ObjectMerge > merge( new ObjectMerge() );
+        MergeObjects( iObjects, *merge );
+        m_merge = merge;
+    }
+
+    m_children.resize( m_merge->children.size() );
+    m_children_ptrs.resize( m_merge->children.size() );
+    for ( size_t i = 0; i < m_merge->children.size(); ++i )
+    {
+        const std::vector< ObjectMerge::SourceAndIndex > & child =
+            m_merge->children[i];
+
+        m_children[i].reserve( child.size() );
+        for ( size_t j = 0; j < child.size(); ++j )
         {
-            AbcA::ObjectHeader objHeader = (*it)->getChildHeader( i );
-            bool shouldPrune =
-                ( objHeader.getMetaData().get( "prune" ) == "1" );
-
-            bool shouldReplace =
-                ( objHeader.getMetaData().get( "replace" ) == "1" );
-
-            ChildNameMap::iterator nameIt = m_childNameMap.find(
-                objHeader.getName() );
-
-            size_t index = 0;
-
-            // brand new child, add it (if not pruning) and continue
-            if ( nameIt == m_childNameMap.end() )
-            {
-                if ( !shouldPrune )
-                {
-                    index = m_childNameMap.size();
-                    m_childNameMap[ objHeader.getName() ] = index;
-                    ObjectHeaderPtr headerPtr(
-                        new AbcA::ObjectHeader( objHeader ) );
-                    m_childHeaders.push_back( headerPtr );
-                    m_children.resize( index + 1 );
-                    m_children[ index ].push_back( ObjectAndIndex( *it, i ) );
-                    m_children_ptrs.resize( index + 1 );
-                }
-
-                continue;
-            }
-
-            index = nameIt->second;
-
-            // no prune, so add to existing data
-            if ( !shouldPrune )
-            {
-                if ( shouldReplace )
-                {
-                    m_children[ index ].clear();
-                    m_childHeaders[ index ]->getMetaData() = AbcA::MetaData();
-                }
-
-                // add parent and index to the existing child element, and then
-                // update the MetaData
-                m_children[ index ].push_back( ObjectAndIndex( *it, i ) );
-
-                // update the found childs meta data
-                m_childHeaders[ index ]->getMetaData().appendOnlyUnique(
-                    objHeader.getMetaData() );
-                continue;
-            }
-
-            // prune, time to clear out existing data
-            m_children.erase( m_children.begin() + index );
-            m_children_ptrs.erase( m_children_ptrs.begin() + index );
-            m_childHeaders.erase( m_childHeaders.begin() + index );
-            m_childNameMap.erase( nameIt );
-
-            // since we removed an element, update the indices in our name map
-            for ( nameIt = m_childNameMap.begin();
-                  nameIt != m_childNameMap.end(); ++nameIt )
-            {
-                if ( nameIt->second > index )
-                {
-                    nameIt->second --;
-                }
-            }
+            m_children[i].push_back( ObjectAndIndex(
+                iObjects[ child[j].first ], child[j].second ) );
         }
     }
 }
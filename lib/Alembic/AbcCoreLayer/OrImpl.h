@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreLayer/Foundation.h>
 #include <Alembic/AbcCoreLayer/ArImpl.h>
+#include <Alembic/AbcCoreLayer/HierarchyCache.h>
 
 namespace Alembic {
 namespace AbcCoreLayer {
@@ -106,8 +107,11 @@ private:
     // this objects header
     ObjectHeaderPtr m_header;
 
-    // all of our compounded child headers
-    std::vector< ObjectHeaderPtr > m_childHeaders;
+    // our spot in the archives cached hierarchy, if it has one
+    ObjectNodePtr m_node;
+
+    // our layered children, either from m_node or merged by init
+    ObjectMergePtr m_merge;
 
     // each child is made up of the original parent objects and the index
     // in each of them where that child lives
@@ -118,8 +122,6 @@ private:
     // all of our top properties, will be combined into m_top
     std::vector< AbcA::CompoundPropertyReaderPtr > m_properties;
     Alembic::Util::weak_ptr< AbcA::CompoundPropertyReader > m_top;
-
-    ChildNameMap m_childNameMap;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
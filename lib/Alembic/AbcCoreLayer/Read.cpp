@@ -43,7 +43,13 @@ namespace AbcCoreLayer {
 namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
-ReadArchive::ReadArchive()
+ReadArchive::ReadArchive() : m_cacheHierarchy( false )
+{
+}
+
+//-*****************************************************************************
+ReadArchive::ReadArchive( bool iCacheHierarchy )
+    : m_cacheHierarchy( iCacheHierarchy )
 {
 }
 
@@ -52,7 +58,7 @@ Alembic::AbcCoreAbstract::ArchiveReaderPtr
 ReadArchive::operator()( ArchiveReaderPtrs & iArchives ) const
 {
     AbcA::ArchiveReaderPtr archivePtr = Alembic::Util::shared_ptr<ArImpl>(
-        new ArImpl( iArchives ) );
+        new ArImpl( iArchives, m_cacheHierarchy ) );
 
     return archivePtr;
 }
@@ -53,9 +53,19 @@ class ALEMBIC_EXPORT ReadArchive
 public:
     ReadArchive();
 
+    //! When iCacheHierarchy is true the layered object and property
+    //! hierarchy is worked out once, in parallel, when the archive is opened.
+    //! Objects and properties then just look up their layered children
+    //! instead of layering them again every time they are read.  This makes
+    //! opening slower and is worthwhile when the hierarchy is traversed.
+    explicit ReadArchive( bool iCacheHierarchy );
+
     // open the file
     Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()(ArchiveReaderPtrs & ) const;
+
+private:
+    bool m_cacheHierarchy;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
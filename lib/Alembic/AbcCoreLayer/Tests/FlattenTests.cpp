@@ -0,0 +1,352 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Abc/All.h>
+#include <Alembic/AbcCoreLayer/Flatten.h>
+#include <Alembic/AbcCoreLayer/Util.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/AbcCoreFactory/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <cstring>
+
+using namespace Alembic::Abc;
+
+//-*****************************************************************************
+void compareProperties( ICompoundProperty iLayered, ICompoundProperty iFlat )
+{
+    TESTING_ASSERT( iLayered.getNumProperties() == iFlat.getNumProperties() );
+    for ( size_t i = 0; i < iLayered.getNumProperties(); ++i )
+    {
+        const PropertyHeader & header = iLayered.getPropertyHeader( i );
+        const PropertyHeader * flatHeader =
+            iFlat.getPropertyHeader( header.getName() );
+        TESTING_ASSERT( flatHeader != NULL );
+        TESTING_ASSERT( flatHeader->getPropertyType() ==
+                        header.getPropertyType() );
+        TESTING_ASSERT( flatHeader->getDataType() == header.getDataType() );
+        TESTING_ASSERT( flatHeader->getMetaData().get( "prune" ).empty() );
+        TESTING_ASSERT( flatHeader->getMetaData().get( "replace" ).empty() );
+
+        if ( header.isCompound() )
+        {
+            TESTING_ASSERT( flatHeader->getMetaData().serialize() ==
+                            header.getMetaData().serialize() );
+            compareProperties( ICompoundProperty( iLayered, header.getName() ),
+                               ICompoundProperty( iFlat, header.getName() ) );
+            continue;
+        }
+
+        TESTING_ASSERT( *flatHeader->getTimeSampling() ==
+                        *header.getTimeSampling() );
+
+        if ( header.isArray() )
+        {
+            AbcA::ArrayPropertyReaderPtr layered =
+                iLayered.getPtr()->getArrayProperty( header.getName() );
+            AbcA::ArrayPropertyReaderPtr flat =
+                iFlat.getPtr()->getArrayProperty( header.getName() );
+            TESTING_ASSERT( layered->getNumSamples() == flat->getNumSamples() );
+            TESTING_ASSERT( layered->isConstant() == flat->isConstant() );
+
+            for ( size_t j = 0; j < layered->getNumSamples(); ++j )
+            {
+                AbcA::ArraySamplePtr a, b;
+                layered->getSample( j, a );
+                flat->getSample( j, b );
+                TESTING_ASSERT( a->getKey() == b->getKey() );
+                TESTING_ASSERT( a->getDimensions() == b->getDimensions() );
+            }
+        }
+        else
+        {
+            AbcA::ScalarPropertyReaderPtr layered =
+                iLayered.getPtr()->getScalarProperty( header.getName() );
+            AbcA::ScalarPropertyReaderPtr flat =
+                iFlat.getPtr()->getScalarProperty( header.getName() );
+            TESTING_ASSERT( layered->getNumSamples() == flat->getNumSamples() );
+            TESTING_ASSERT( layered->isConstant() == flat->isConstant() );
+
+            AbcA::DataType dataType = header.getDataType();
+            for ( size_t j = 0; j < layered->getNumSamples(); ++j )
+            {
+                AbcA::ArraySamplePtr a = AbcA::AllocateArraySample(
+                    dataType, AbcA::Dimensions( 1 ) );
+                AbcA::ArraySamplePtr b = AbcA::AllocateArraySample(
+                    dataType, AbcA::Dimensions( 1 ) );
+                layered->getSample( j, const_cast< void * >( a->getData() ) );
+                flat->getSample( j, const_cast< void * >( b->getData() ) );
+                TESTING_ASSERT( a->getKey() == b->getKey() );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void compareObjects( IObject iLayered, IObject iFlat )
+{
+    TESTING_ASSERT( iFlat.getMetaData().get( "prune" ).empty() );
+    TESTING_ASSERT( iFlat.getMetaData().get( "replace" ).empty() );
+
+    compareProperties( iLayered.getProperties(), iFlat.getProperties() );
+
+    TESTING_ASSERT( iLayered.getNumChildren() == iFlat.getNumChildren() );
+    for ( size_t i = 0; i < iLayered.getNumChildren(); ++i )
+    {
+        const std::string & name = iLayered.getChildHeader( i ).getName();
+        TESTING_ASSERT( iFlat.getChildHeader( name ) != NULL );
+        compareObjects( iLayered.getChild( i ), iFlat.getChild( name ) );
+    }
+}
+
+//-*****************************************************************************
+void flattenTest()
+{
+    std::string fileName = "flattenLayer1.abc";
+    std::string fileName2 = "flattenLayer2.abc";
+    std::string flatName = "flattenFlat.abc";
+
+    std::vector< Alembic::Util::int32_t > vals( 6 );
+    for ( size_t i = 0; i < vals.size(); ++i )
+    {
+        vals[i] = i * 3;
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), fileName );
+        Alembic::Util::uint32_t tsIdx =
+            archive.addTimeSampling( TimeSampling( 1.0 / 24.0, 2.0 ) );
+
+        OObject a( archive.getTop(), "a" );
+        OInt32ArrayProperty arr( a.getProperties(), "arr", tsIdx );
+        arr.set( Int32ArraySample( vals ) );
+        arr.set( Int32ArraySample( vals ) );
+        arr.set( Int32ArraySample( &vals.front(), 3 ) );
+
+        OStringProperty str( a.getProperties(), "str", tsIdx );
+        str.set( "first" );
+        str.set( "second" );
+        str.set( "second" );
+
+        OCompoundProperty comp( a.getProperties(), "comp" );
+        ODoubleProperty dbl( comp, "dbl" );
+        dbl.set( 1.5 );
+
+        OObject ab( a, "b" );
+        OObject c( archive.getTop(), "c" );
+        OInt32Property cInt( c.getProperties(), "cInt" );
+        cInt.set( 7 );
+
+        OObject d( archive.getTop(), "d" );
+        OObject dd( d, "dd" );
+        OInt32Property dInt( d.getProperties(), "dInt" );
+        dInt.set( 8 );
+    }
+
+    {
+        MetaData pruneMd;
+        Alembic::AbcCoreLayer::SetPrune( pruneMd, true );
+
+        MetaData replaceMd;
+        Alembic::AbcCoreLayer::SetReplace( replaceMd, true );
+        replaceMd.set( "cool", "guy" );
+
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), fileName2 );
+        Alembic::Util::uint32_t tsIdx =
+            archive.addTimeSampling( TimeSampling( 1.0 / 30.0, 0.0 ) );
+
+        OObject a( archive.getTop(), "a" );
+        OFloatArrayProperty extra( a.getProperties(), "extra", tsIdx );
+        std::vector< float > fvals( 4, 2.5f );
+        extra.set( FloatArraySample( fvals ) );
+        extra.set( FloatArraySample( fvals ) );
+
+        OCompoundProperty comp( a.getProperties(), "comp", pruneMd );
+        OObject c( archive.getTop(), "c", pruneMd );
+
+        OObject d( archive.getTop(), "d", replaceMd );
+        OInt32Property dInt2( d.getProperties(), "dInt2" );
+        dInt2.set( 9 );
+
+        OObject e( archive.getTop(), "e" );
+    }
+
+    std::vector< std::string > files;
+    files.push_back( fileName2 );
+    files.push_back( fileName );
+
+    Alembic::AbcCoreFactory::IFactory factory;
+    IArchive layered = factory.getArchive( files );
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), flatName );
+        Alembic::AbcCoreLayer::Flatten( layered.getPtr(), archive.getPtr() );
+    }
+
+    IArchive flat( Alembic::AbcCoreOgawa::ReadArchive(), flatName );
+    // the layers each have the identity sampling, which is only written once
+    TESTING_ASSERT( layered.getNumTimeSamplings() == 4 );
+    TESTING_ASSERT( flat.getNumTimeSamplings() == 3 );
+    for ( uint32_t i = 0; i < layered.getNumTimeSamplings(); ++i )
+    {
+        bool found = false;
+        for ( uint32_t j = 0; j < flat.getNumTimeSamplings(); ++j )
+        {
+            found = found || ( *flat.getTimeSampling( j ) ==
+                               *layered.getTimeSampling( i ) );
+        }
+        TESTING_ASSERT( found );
+    }
+    compareObjects( layered.getTop(), flat.getTop() );
+
+    // a, d, e
+    IObject top = flat.getTop();
+    TESTING_ASSERT( top.getNumChildren() == 3 );
+    TESTING_ASSERT( !top.getChild( "c" ).valid() );
+
+    IObject a = top.getChild( "a" );
+    TESTING_ASSERT( a.getProperties().getNumProperties() == 3 );
+    TESTING_ASSERT( a.getProperties().getPropertyHeader( "comp" ) == NULL );
+    TESTING_ASSERT( a.getNumChildren() == 1 );
+
+    IInt32ArrayProperty arr( a.getProperties(), "arr" );
+    TESTING_ASSERT( arr.getNumSamples() == 3 );
+    TESTING_ASSERT( arr.getValue( 2 )->size() == 3 );
+    TESTING_ASSERT( arr.getValue( 1 )->get()[5] == 15 );
+
+    IStringProperty str( a.getProperties(), "str" );
+    TESTING_ASSERT( str.getNumSamples() == 3 );
+    TESTING_ASSERT( str.getValue( 0 ) == "first" );
+    TESTING_ASSERT( str.getValue( 2 ) == "second" );
+
+    IFloatArrayProperty extra( a.getProperties(), "extra" );
+    TESTING_ASSERT( extra.isConstant() );
+    TESTING_ASSERT( extra.getTimeSampling()->getTimeSamplingType()
+                    .getTimePerCycle() == 1.0 / 30.0 );
+
+    IObject d = top.getChild( "d" );
+    TESTING_ASSERT( d.getNumChildren() == 0 );
+    TESTING_ASSERT( d.getMetaData().get( "cool" ) == "guy" );
+    TESTING_ASSERT( d.getProperties().getNumProperties() == 1 );
+    TESTING_ASSERT( IInt32Property( d.getProperties(), "dInt2" ).getValue()
+                    == 9 );
+}
+
+//-*****************************************************************************
+// [8-byte uncompressed size][zstd frame], as written by the compressing
+// writers
+void makeCompressedSample( const std::vector< Alembic::Util::int32_t > & iVals,
+                           AbcA::RawArraySample & oRaw )
+{
+    Alembic::AbcCoreOgawa::CompressArraySample( AbcA::ArraySample(
+        &iVals.front(), AbcA::DataType( Alembic::Util::kInt32POD ),
+        AbcA::Dimensions( iVals.size() ) ), oRaw );
+}
+
+//-*****************************************************************************
+void flattenCompressedTest()
+{
+    std::string fileName = "flattenCompressed.abc";
+    std::string flatName = "flattenCompressedFlat.abc";
+
+    // Noise of the same size, so the stored bytes start the same way.
+    std::vector< Alembic::Util::int32_t > first( 1000 );
+    std::vector< Alembic::Util::int32_t > second( 1000 );
+    Alembic::Util::uint32_t seed = 3;
+    for ( size_t i = 0; i < first.size(); ++i )
+    {
+        seed = seed * 1664525 + 1013904223;
+        first[i] = seed;
+        seed = seed * 1664525 + 1013904223;
+        second[i] = seed;
+    }
+
+    AbcA::RawArraySample rawFirst, rawSecond;
+    makeCompressedSample( first, rawFirst );
+    makeCompressedSample( second, rawSecond );
+    TESTING_ASSERT( memcmp( &rawFirst.data.front(), &rawSecond.data.front(),
+                            16 ) == 0 );
+
+    // a changed sample of the same size, then a real repeat
+    std::vector< const std::vector< Alembic::Util::int32_t > * > vals;
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), fileName );
+        AbcA::ArrayPropertyWriterPtr arr =
+            archive.getTop().getProperties().getPtr()->createArrayProperty(
+                "arr", MetaData(), AbcA::DataType( Alembic::Util::kInt32POD ),
+                0 );
+        TESTING_ASSERT( arr->setRawSample( rawFirst ) );
+        TESTING_ASSERT( arr->setRawSample( rawSecond ) );
+        TESTING_ASSERT( arr->setRawSample( rawSecond ) );
+    }
+    vals.push_back( &first );
+    vals.push_back( &second );
+    vals.push_back( &second );
+
+    std::vector< std::string > files;
+    files.push_back( fileName );
+
+    Alembic::AbcCoreFactory::IFactory factory;
+    IArchive layered = factory.getArchive( files );
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), flatName );
+        Alembic::AbcCoreLayer::Flatten( layered.getPtr(), archive.getPtr() );
+    }
+
+    IArchive flat( Alembic::AbcCoreOgawa::ReadArchive(), flatName );
+    AbcA::ArrayPropertyReaderPtr arr =
+        flat.getTop().getProperties().getPtr()->getArrayProperty( "arr" );
+    TESTING_ASSERT( arr->getNumSamples() == vals.size() );
+
+    for ( size_t i = 0; i < vals.size(); ++i )
+    {
+        AbcA::ArraySamplePtr samp;
+        arr->getSample( i, samp );
+        TESTING_ASSERT( samp->size() == vals[i]->size() );
+        TESTING_ASSERT( memcmp( samp->getData(), &vals[i]->front(),
+                                vals[i]->size() * 4 ) == 0 );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    flattenTest();
+    flattenCompressedTest();
+    return 0;
+}
@@ -334,6 +334,67 @@ void pruneAndAddTest()
     }
 }
 
+//-*****************************************************************************
+void compareProperties( ICompoundProperty iA, ICompoundProperty iB )
+{
+    TESTING_ASSERT( iA.getNumProperties() == iB.getNumProperties() );
+    for ( std::size_t i = 0; i < iA.getNumProperties(); ++i )
+    {
+        const PropertyHeader & header = iA.getPropertyHeader( i );
+        TESTING_ASSERT( header.getName() ==
+                        iB.getPropertyHeader( i ).getName() );
+        TESTING_ASSERT( header.getMetaData().serialize() ==
+            iB.getPropertyHeader( i ).getMetaData().serialize() );
+
+        if ( header.isCompound() )
+        {
+            compareProperties( ICompoundProperty( iA, header.getName() ),
+                               ICompoundProperty( iB, header.getName() ) );
+        }
+    }
+}
+
+//-*****************************************************************************
+void compareObjects( IObject iA, IObject iB )
+{
+    TESTING_ASSERT( iA.getNumChildren() == iB.getNumChildren() );
+    compareProperties( iA.getProperties(), iB.getProperties() );
+
+    for ( std::size_t i = 0; i < iA.getNumChildren(); ++i )
+    {
+        const ObjectHeader & header = iA.getChildHeader( i );
+        TESTING_ASSERT( header.getName() == iB.getChildHeader( i ).getName() );
+        TESTING_ASSERT( header.getMetaData().serialize() ==
+            iB.getChildHeader( i ).getMetaData().serialize() );
+
+        // by name on one side and by index on the other
+        compareObjects( iA.getChild( header.getName() ), iB.getChild( i ) );
+    }
+}
+
+//-*****************************************************************************
+void cachedHierarchyTest()
+{
+    // reuses the files written by the tests above
+    const char * layers[][2] = {
+        { "objectLayer2.abc", "objectLayer1.abc" },
+        { "objectPrune2.abc", "objectPrune1.abc" },
+        { "objectReplace2.abc", "objectReplace1.abc" } };
+
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+        std::vector< std::string > files( layers[i], layers[i] + 2 );
+
+        Alembic::AbcCoreFactory::IFactory factory;
+        IArchive archive = factory.getArchive( files );
+
+        factory.setLayerCacheHierarchy( true );
+        IArchive cached = factory.getArchive( files );
+
+        compareObjects( archive.getTop(), cached.getTop() );
+    }
+}
+
 //-*****************************************************************************
 int main( int argc, char *argv[] )
 {
@@ -342,5 +403,6 @@ int main( int argc, char *argv[] )
     replaceTest();
     hashTest();
     pruneAndAddTest();
+    cachedHierarchyTest();
     return 0;
 }
@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_All_h
 
 #include <Alembic/Util/Export.h>
+#include <Alembic/AbcCoreOgawa/BlobStore.h>
 #include <Alembic/AbcCoreOgawa/ReadWrite.h>
 
 #endif
@@ -38,6 +38,8 @@
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
 #include <Alembic/AbcCoreOgawa/OrImpl.h>
+#include <cstring>
+#include <limits>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -101,17 +103,35 @@ bool AprImpl::isConstant()
 
 //-*****************************************************************************
 void AprImpl::getSample( index_t iSampleIndex, AbcA::ArraySamplePtr &oSample )
+{
+    getSampleWithAllocator( iSampleIndex, oSample,
+                            AbcA::ArraySampleAllocatorPtr() );
+}
+
+//-*****************************************************************************
+void AprImpl::getSampleWithAllocator( index_t iSampleIndex,
+                                      AbcA::ArraySamplePtr &oSample,
+                                      AbcA::ArraySampleAllocatorPtr iAllocator )
 {
     size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
 
-    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
-        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+    Alembic::Util::shared_ptr< ArImpl > archive =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader > (
+            getObject()->getArchive() );
+
+    StreamIDPtr streamId = archive->getStreamID();
 
     std::size_t id = streamId->getID();
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
-    Ogawa::IDataPtr data = m_group->getData(index, id);
+    Ogawa::IDataPtr data = getSampleData(index, id);
 
-    ReadArraySample( dims, data, id, m_header->header.getDataType(), oSample );
+    if ( !iAllocator )
+    {
+        iAllocator = archive->getArraySampleAllocator();
+    }
+
+    ReadArraySample( dims, data, id, m_header->header.getDataType(),
+                     m_header->isCompressed, oSample, iAllocator );
 }
 
 //-*****************************************************************************
@@ -149,20 +169,101 @@ bool AprImpl::getKey( index_t iSampleIndex, AbcA::ArraySampleKey & oKey )
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
     std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
+
+    // what is in the BlobStore, since the key of zstd compressed data is
+    // made from all of it
+    Ogawa::IDataPtr data = getSampleData( index, id );
 
     if ( data )
     {
-        if ( data->getSize() >= 16 )
+        ReadArraySampleKey( data, id, oKey.readPOD, m_header->isCompressed,
+                            oKey );
+        return true;
+    }
+
+    return false;
+}
+
+//-*****************************************************************************
+bool AprImpl::getRawSample( index_t iSampleIndex,
+                            AbcA::RawArraySample & oSample )
+{
+    // * 2 for Array properties (since we also write the dimensions)
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr data = getSampleData( index, id );
+    if ( !data )
+    {
+        return false;
+    }
+
+    oSample.format = m_header->isCompressed ? "OgawaZstd" : "Ogawa";
+    oSample.data.resize( data->getSize() );
+    if ( !oSample.data.empty() )
+    {
+        data->read( oSample.data.size(), &oSample.data.front(), 0, id );
+    }
+
+    // the key from the bytes just read, compressed samples are hashed once
+    // here and samples stored after their key only have it copied
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    oSample.key.origPOD = dataType.getPod();
+    oSample.key.readPOD = dataType.getPod();
+    if ( m_header->isCompressed )
+    {
+        GetArraySampleKey( oSample.data.empty() ? NULL :
+                           &oSample.data.front(), oSample.data.size(),
+                           dataType.getPod(), true, oSample.key );
+    }
+    else
+    {
+        oSample.key.numBytes = 0;
+        oSample.key.digest = Util::Digest();
+        if ( oSample.data.size() >= 16 )
         {
-            oKey.numBytes = data->getSize() - 16;
-            data->read( 16, oKey.digest.d, 0, id );
+            oSample.key.numBytes = oSample.data.size() - 16;
+            memcpy( oSample.key.digest.d, &oSample.data.front(), 16 );
         }
+    }
 
-        return true;
+    Ogawa::IDataPtr dims = m_group->getData( index + 1, id );
+    ReadArrayDimensions( dims, data, id, dataType, m_header->isCompressed,
+                         oSample.dims );
+
+    return true;
+}
+
+//-*****************************************************************************
+Ogawa::IDataPtr AprImpl::getSampleData( size_t iIndex,
+                                        std::size_t iThreadId )
+{
+    Ogawa::IDataPtr data = m_group->getData( iIndex, iThreadId );
+    if ( !m_header->isExternal || !data || data->getSize() == 0 )
+    {
+        return data;
     }
 
-    return false;
+    ABCA_ASSERT( data->getSize() == 24,
+        "Invalid reference to an externally stored sample for: " <<
+        m_header->header.getName() );
+
+    Util::Digest digest;
+    data->read( 16, digest.d, 0, iThreadId );
+
+    BlobStorePtr store = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getBlobStore();
+    ABCA_ASSERT( store, "No BlobStore to read the samples of: " <<
+                 m_header->header.getName() );
+
+    BlobStore::BlobPtr blob = store->get( digest );
+    ABCA_ASSERT( blob, "Could not find the externally stored sample: " <<
+                 store->getPath( digest ) );
+
+    return Ogawa::IDataPtr( new Ogawa::IData( blob ) );
 }
 
 //-*****************************************************************************
@@ -182,9 +283,10 @@ void AprImpl::getDimensions( index_t iSampleIndex,
 
     std::size_t id = streamId->getID();
     Ogawa::IDataPtr dims = m_group->getData(index + 1, id);
-    Ogawa::IDataPtr data = m_group->getData(index, id);
+    Ogawa::IDataPtr data = getSampleData(index, id);
 
-    ReadTDRDimensions( dims, data, id, m_header->header.getDataType(), oDim );
+    ReadArrayDimensions( dims, data, id, m_header->header.getDataType(),
+                         m_header->isCompressed, oDim );
 
 }
 
@@ -198,8 +300,80 @@ void AprImpl::getAs( index_t iSampleIndex, void *iIntoLocation,
         AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
 
     std::size_t id = streamId->getID();
-    Ogawa::IDataPtr data = m_group->getData( index, id );
-    ReadData( iIntoLocation, data, id, m_header->header.getDataType(), iPod );
+    Ogawa::IDataPtr data = getSampleData( index, id );
+    if ( !data )
+    {
+        return;
+    }
+
+    // the caller sized iIntoLocation from getDimensions
+    ReadArrayDataInto( iIntoLocation, std::numeric_limits< size_t >::max(),
+                       data, id, m_header->header.getDataType(), iPod,
+                       m_header->isCompressed );
+}
+
+//-*****************************************************************************
+size_t AprImpl::getInto( index_t iSampleIndex, void *oBuffer,
+                         size_t iCapacity,
+                         Alembic::Util::PlainOldDataType iPod )
+{
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr data = getSampleData( index, id );
+    if ( !data )
+    {
+        return 0;
+    }
+
+    return ReadArrayDataInto( oBuffer, iCapacity, data, id,
+                              m_header->header.getDataType(), iPod,
+                              m_header->isCompressed );
+}
+
+//-*****************************************************************************
+template < class PACKED >
+void AprImpl::readPacked( index_t iSampleIndex,
+                          Alembic::Util::PlainOldDataType iPod,
+                          PACKED & oStrings )
+{
+    ABCA_ASSERT( m_header->header.getDataType().getPod() == iPod,
+        "Can't read " <<
+        Alembic::Util::PODName( m_header->header.getDataType().getPod() ) <<
+        " property " << m_header->header.getName() << " as packed " <<
+        Alembic::Util::PODName( iPod ) << "s" );
+
+    size_t index = m_header->verifyIndex( iSampleIndex ) * 2;
+
+    StreamIDPtr streamId = Alembic::Util::dynamic_pointer_cast< ArImpl,
+        AbcA::ArchiveReader > ( getObject()->getArchive() )->getStreamID();
+
+    std::size_t id = streamId->getID();
+    Ogawa::IDataPtr data = getSampleData( index, id );
+    if ( !data )
+    {
+        oStrings.clear();
+        return;
+    }
+
+    ReadPackedStrings( data, id, m_header->isCompressed, oStrings );
+}
+
+//-*****************************************************************************
+void AprImpl::getPacked( index_t iSampleIndex,
+                         Alembic::Util::PackedStrings & oStrings )
+{
+    readPacked( iSampleIndex, Alembic::Util::kStringPOD, oStrings );
+}
+
+//-*****************************************************************************
+void AprImpl::getPacked( index_t iSampleIndex,
+                         Alembic::Util::PackedWstrings & oStrings )
+{
+    readPacked( iSampleIndex, Alembic::Util::kWstringPOD, oStrings );
 }
 
 } // End namespace ALEMBIC_VERSION_NS
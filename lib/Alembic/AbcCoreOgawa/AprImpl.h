@@ -64,6 +64,9 @@ public:
     virtual bool isConstant();
     virtual void getSample( index_t iSampleIndex,
                             AbcA::ArraySamplePtr &oSample );
+    virtual void getSampleWithAllocator( index_t iSampleIndex,
+        AbcA::ArraySamplePtr &oSample,
+        AbcA::ArraySampleAllocatorPtr iAllocator );
     virtual std::pair<index_t, chrono_t> getFloorIndex( chrono_t iTime );
     virtual std::pair<index_t, chrono_t> getCeilIndex( chrono_t iTime );
     virtual std::pair<index_t, chrono_t> getNearIndex( chrono_t iTime );
@@ -73,9 +76,25 @@ public:
     virtual bool isScalarLike();
     virtual void getAs( index_t iSample, void *iIntoLocation,
                         Alembic::Util::PlainOldDataType iPod );
+    virtual size_t getInto( index_t iSample, void *oBuffer, size_t iCapacity,
+                            Alembic::Util::PlainOldDataType iPod );
+    virtual bool getRawSample( index_t iSampleIndex,
+                               AbcA::RawArraySample & oSample );
+    virtual void getPacked( index_t iSampleIndex,
+                            Alembic::Util::PackedStrings & oStrings );
+    virtual void getPacked( index_t iSampleIndex,
+                            Alembic::Util::PackedWstrings & oStrings );
 
 private:
 
+    template < class PACKED >
+    void readPacked( index_t iSampleIndex,
+                     Alembic::Util::PlainOldDataType iPod,
+                     PACKED & oStrings );
+
+    // The data at iIndex of m_group, or what it refers to in the BlobStore
+    Ogawa::IDataPtr getSampleData( size_t iIndex, std::size_t iThreadId );
+
     // Parent compound property writer. It must exist.
     AbcA::CompoundPropertyReaderPtr m_parent;
 
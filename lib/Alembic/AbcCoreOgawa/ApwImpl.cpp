@@ -36,7 +36,10 @@
 
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
+#include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadWrite.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -62,6 +65,47 @@ ApwImpl::ApwImpl( AbcA::CompoundPropertyWriterPtr iParent,
 }
 
 
+//-*****************************************************************************
+void ApwImpl::adoptSamples( Ogawa::IGroupPtr iExisting )
+{
+    std::vector< WrittenSampleIDPtr > samples;
+    std::vector< AbcA::Dimensions > dims;
+    ReadWrittenSamples( iExisting, m_group, m_header, samples, dims );
+    CopyExistingChildren( iExisting, m_group );
+
+    if ( !samples.empty() )
+    {
+        m_previousWrittenSampleID = samples.back();
+        m_dims = dims.back();
+    }
+
+    m_hash = HashWrittenSamples( m_header, samples, dims );
+
+    if ( m_header->isExternal )
+    {
+        m_blobStore = Alembic::Util::dynamic_pointer_cast< AwImpl,
+            AbcA::ArchiveWriter >( getObject()->getArchive() )->getBlobStore();
+        ABCA_ASSERT( m_blobStore, "No BlobStore to add the samples of: " <<
+                     m_header->header.getName() );
+    }
+}
+
+//-*****************************************************************************
+Util::uint64_t
+ApwImpl::writeCheckpoint( std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    Util::uint32_t numSamples = GetNumMaxSamples( m_header );
+    if ( m_header->timeSamplingIndex < ioMaxSamples.size() &&
+         ioMaxSamples[m_header->timeSamplingIndex] < numSamples )
+    {
+        ioMaxSamples[m_header->timeSamplingIndex] = numSamples;
+    }
+
+    // samples are written as soon as they are set, so these already agree
+    // with m_header which our parent writes out with its checkpoint
+    return m_group->writeDetachedGroup( m_group->getChildPositions() );
+}
+
 //-*****************************************************************************
 ApwImpl::~ApwImpl()
 {
@@ -70,13 +114,7 @@ ApwImpl::~ApwImpl()
     index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
             m_header->timeSamplingIndex );
 
-    Util::uint32_t numSamples = m_header->nextSampleIndex;
-
-    // a constant property, we wrote the same sample over and over
-    if ( m_header->lastChangedIndex == 0 && m_header->nextSampleIndex > 0 )
-    {
-        numSamples = 1;
-    }
+    Util::uint32_t numSamples = GetNumMaxSamples( m_header );
 
     if ( maxSamples < numSamples )
     {
@@ -143,9 +181,162 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         ", does not match the DataType of the Array property: " <<
         m_header->header.getDataType() );
 
+    // all of the samples of a compressed property are
+    if ( m_header->isCompressed )
+    {
+        AbcA::RawArraySample raw;
+        CompressArraySample( iSamp, raw );
+        writeSample( raw.key, raw.dims, NULL, &raw );
+        return;
+    }
+
     // The Key helps us analyze the sample.
-     AbcA::ArraySample::Key key = iSamp.getKey();
+    AbcA::ArraySample::Key key = iSamp.getKey();
+
+    writeSample( key, iSamp.getDimensions(), &iSamp, NULL );
+}
+
+//-*****************************************************************************
+bool ApwImpl::setRawSample( const AbcA::RawArraySample & iSamp )
+{
+    bool compressed = ( iSamp.format == "OgawaZstd" );
+    if ( ( !compressed && iSamp.format != "Ogawa" ) ||
+         iSamp.key.origPOD != m_header->header.getDataType().getPod() )
+    {
+        return false;
+    }
+
+    // The first sample decides whether the property is compressed, samples
+    // stored the other way have to be set from their decoded data.
+    if ( m_header->nextSampleIndex > 0 &&
+         compressed != m_header->isCompressed )
+    {
+        return false;
+    }
+    m_header->isCompressed = compressed;
+
+    ABCA_ASSERT(
+        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
+        || m_header->header.getTimeSampling()->getNumStoredTimes() >
+        m_header->nextSampleIndex,
+        "Can not write more samples than we have times for when using "
+        "Acyclic sampling." );
+
+    // the key getRawSample, or CompressArraySample, filled in is a hash of
+    // all of the data, so it is trusted to tell samples apart
+    AbcA::ArraySample::Key key = iSamp.key;
+    writeSample( key, iSamp.dims, NULL, &iSamp );
+    return true;
+}
+
+//-*****************************************************************************
+AbcA::Dimensions ApwImpl::checkPackedSample( Util::PlainOldDataType iPod,
+                                             std::size_t iNumStrings )
+{
+    const AbcA::DataType & dataType = m_header->header.getDataType();
 
+    ABCA_ASSERT(
+        !m_header->header.getTimeSampling()->getTimeSamplingType().isAcyclic()
+        || m_header->header.getTimeSampling()->getNumStoredTimes() >
+        m_header->nextSampleIndex,
+        "Can not write more samples than we have times for when using "
+        "Acyclic sampling." );
+
+    ABCA_ASSERT( dataType.getPod() == iPod,
+        "Packed " << Util::PODName( iPod ) << "s do not match the DataType "
+        "of the Array property: " << dataType );
+
+    ABCA_ASSERT( iNumStrings % dataType.getExtent() == 0,
+        "Packed sample of " << iNumStrings << " strings isn't a multiple of "
+        "the extent of the Array property: " << dataType );
+
+    return AbcA::Dimensions( iNumStrings / dataType.getExtent() );
+}
+
+//-*****************************************************************************
+void ApwImpl::setPackedSample( const Util::PackedStrings & iStrings )
+{
+    AbcA::Dimensions dims = checkPackedSample( Util::kStringPOD,
+                                               iStrings.size() );
+
+    const char * chars = iStrings.data();
+    std::size_t numChars = iStrings.numChars();
+
+    ABCA_ASSERT( ( std::size_t ) std::count( chars, chars + numChars, 0 ) ==
+                 iStrings.size(),
+                 "Illegal NULL character found in string data " );
+
+    if ( m_header->isCompressed )
+    {
+        AbcA::RawArraySample raw;
+        CompressRawSample( chars, numChars, Util::kStringPOD, dims, raw );
+        writeSample( raw.key, dims, NULL, &raw );
+        return;
+    }
+
+    // the same key getKey makes for the unpacked strings
+    AbcA::ArraySample::Key key;
+    key.numBytes = m_header->header.getDataType().getNumBytes() *
+        dims.numPoints();
+    key.origPOD = Util::kStringPOD;
+    key.readPOD = Util::kStringPOD;
+    Util::MurmurHash3_x64_128( chars, numChars, sizeof( Util::int8_t ),
+                               key.digest.words );
+
+    // an empty sample still needs a non NULL pointer to pick packed data
+    writeSample( key, dims, NULL, NULL, chars ? chars : "", numChars );
+}
+
+//-*****************************************************************************
+void ApwImpl::setPackedSample( const Util::PackedWstrings & iStrings )
+{
+    AbcA::Dimensions dims = checkPackedSample( Util::kWstringPOD,
+                                               iStrings.size() );
+
+    const wchar_t * chars = iStrings.data();
+    std::size_t numChars = iStrings.numChars();
+
+    ABCA_ASSERT( ( std::size_t ) std::count( chars, chars + numChars, 0 ) ==
+                 iStrings.size(),
+                 "Illegal NULL character found in wstring data" );
+
+    // stored as 32 bit characters
+    std::vector< Util::int32_t > stored( chars, chars + numChars );
+    const void * packed = stored.empty() ? NULL : &stored.front();
+    std::size_t numBytes = stored.size() * sizeof( Util::int32_t );
+
+    if ( m_header->isCompressed )
+    {
+        AbcA::RawArraySample raw;
+        CompressRawSample( packed, numBytes, Util::kWstringPOD, dims, raw );
+        writeSample( raw.key, dims, NULL, &raw );
+        return;
+    }
+
+    AbcA::ArraySample::Key key;
+    key.numBytes = m_header->header.getDataType().getNumBytes() *
+        dims.numPoints();
+    key.origPOD = Util::kWstringPOD;
+    key.readPOD = Util::kWstringPOD;
+    Util::MurmurHash3_x64_128( packed, numBytes, sizeof( Util::int32_t ),
+                               key.digest.words );
+
+    writeSample( key, dims, NULL, NULL, packed ? packed : "", numBytes );
+}
+
+//-*****************************************************************************
+void ApwImpl::writeSample( AbcA::ArraySample::Key & ioKey,
+                           const AbcA::Dimensions & iDims,
+                           const AbcA::ArraySample * iSamp,
+                           const AbcA::RawArraySample * iRaw,
+                           const void * iPacked,
+                           std::size_t iPackedBytes )
+{
+    // before anything changes, so the checkpoint only sees whole samples
+    CheckpointIfNeeded( getObject()->getArchive() );
+
+    const AbcA::DataType & dataType = m_header->header.getDataType();
+    AbcA::ArraySample::Key & key = ioKey;
      // mask out the non-string POD since Ogawa can safely share the same data
      // even if it originated from a different POD
      // the non-fixed sizes of our strings (plus added null characters) makes
@@ -172,8 +363,7 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
             {
                 assert( smpI > 0 );
                 CopyWrittenData( m_group, m_previousWrittenSampleID );
-                WriteDimensions( m_group, m_dims,
-                                 iSamp.getDataType().getPod() );
+                WriteDimensions( m_group, m_dims, dataType.getPod() );
             }
         }
 
@@ -181,13 +371,41 @@ void ApwImpl::setSample( const AbcA::ArraySample & iSamp )
         // cache of what the previously written sample was.
         AbcA::ArchiveWriterPtr awp = this->getObject()->getArchive();
 
+        // the first sample decides whether all of them go to the BlobStore
+        if ( m_header->nextSampleIndex == 0 )
+        {
+            m_blobStore = GetBlobStore( awp, key.numBytes );
+            m_header->isExternal = ( bool ) m_blobStore;
+        }
+
+        WrittenSampleMap & sampleMap = m_blobStore ?
+            GetExternalSampleMap( awp ) : GetWrittenSampleMap( awp );
+
         // Write the sample.
         // This distinguishes between string, wstring, and regular arrays.
-        m_previousWrittenSampleID =
-            WriteData( GetWrittenSampleMap( awp ), m_group, iSamp, key );
+        if ( iSamp )
+        {
+            m_previousWrittenSampleID = WriteData( sampleMap, m_group, *iSamp,
+                                                   key, m_blobStore.get() );
+        }
+        else if ( iPacked )
+        {
+            m_previousWrittenSampleID =
+                WritePackedData( sampleMap, m_group, iPacked, iPackedBytes,
+                                 key, dataType.getExtent() * iDims.numPoints(),
+                                 m_blobStore.get() );
+        }
+        else
+        {
+            m_previousWrittenSampleID =
+                WriteRawData( sampleMap, m_group, *iRaw, key,
+                              dataType.getPod(), m_header->isCompressed,
+                              dataType.getExtent() * iDims.numPoints(),
+                              m_blobStore.get() );
+        }
 
-        m_dims = iSamp.getDimensions();
-        WriteDimensions( m_group, m_dims, iSamp.getDataType().getPod() );
+        m_dims = iDims;
+        WriteDimensions( m_group, m_dims, dataType.getPod() );
 
         // if we haven't written this already, isScalarLike will be true
         if ( m_header->isScalarLike && m_dims.numPoints() != 1 )
@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
+#include <Alembic/AbcCoreOgawa/BlobStore.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -60,6 +61,15 @@ protected:
 
     virtual AbcA::ArrayPropertyWriterPtr asArrayPtr();
 
+    // carries on from the samples in iExisting, which was written before
+    // the archive was reopened for appending
+    void adoptSamples( Ogawa::IGroupPtr iExisting );
+
+    // writes a copy of the group as it is now for AwImpl::checkpoint, and
+    // counts the samples so far towards ioMaxSamples
+    Util::uint64_t writeCheckpoint(
+        std::vector< AbcA::index_t > & ioMaxSamples );
+
 public:
     virtual ~ApwImpl();
 
@@ -68,6 +78,9 @@ public:
     virtual void setFromPreviousSample();
     virtual size_t getNumSamples();
     virtual void setTimeSamplingIndex( Util::uint32_t iIndex );
+    virtual bool setRawSample( const AbcA::RawArraySample & iSamp );
+    virtual void setPackedSample( const Util::PackedStrings & iStrings );
+    virtual void setPackedSample( const Util::PackedWstrings & iStrings );
 
     // BasePropertyWriter overrides
     virtual const AbcA::PropertyHeader & getHeader() const;
@@ -79,6 +92,20 @@ protected:
     WrittenSampleIDPtr m_previousWrittenSampleID;
 
 private:
+    // writes iSamp, iRaw, or the iPackedBytes of packed strings at iPacked,
+    // whichever isn't NULL
+    void writeSample( AbcA::ArraySample::Key & ioKey,
+                      const AbcA::Dimensions & iDims,
+                      const AbcA::ArraySample * iSamp,
+                      const AbcA::RawArraySample * iRaw,
+                      const void * iPacked = NULL,
+                      std::size_t iPackedBytes = 0 );
+
+    // the checks setSample does before a sample of iNumStrings strings,
+    // and the dimensions it will have
+    AbcA::Dimensions checkPackedSample( Util::PlainOldDataType iPod,
+                                        std::size_t iNumStrings );
+
     // The parent compound property writer.
     AbcA::CompoundPropertyWriterPtr m_parent;
 
@@ -94,6 +121,9 @@ private:
     AbcA::Dimensions m_dims;
 
     size_t m_index;
+
+    // set when the samples are written to a BlobStore instead of m_group
+    BlobStorePtr m_blobStore;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -46,32 +46,52 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 ArImpl::ArImpl( const std::string &iFileName,
                 std::size_t iNumStreams,
-                bool iUseMMap)
+                bool iUseMMap,
+                bool iOpenCheckpoints,
+                bool iRefreshable )
   : m_fileName( iFileName )
   , m_archive( iFileName, iNumStreams, iUseMMap )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iNumStreams )
+  , m_refreshable( iRefreshable )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file: " << m_fileName );
 
-    ABCA_ASSERT( m_archive.isFrozen(),
-        "Ogawa file not cleanly closed while being written: " << m_fileName );
+    if ( !m_archive.isFrozen() )
+    {
+        ABCA_ASSERT( iOpenCheckpoints,
+            "Ogawa file not cleanly closed while being written: " <<
+            m_fileName );
+
+        ABCA_ASSERT( m_archive.getGroup()->getNumChildren() > 0,
+            "Ogawa file not cleanly closed and has no checkpoint: " <<
+            m_fileName );
+    }
 
     init();
 }
 
 //-*****************************************************************************
-ArImpl::ArImpl( const std::vector< std::istream * > & iStreams )
+ArImpl::ArImpl( const std::vector< std::istream * > & iStreams,
+                bool iOpenCheckpoints,
+                bool iRefreshable )
   : m_archive( iStreams )
   , m_header( new AbcA::ObjectHeader() )
   , m_manager( iStreams.size() )
+  , m_refreshable( iRefreshable )
 {
     ABCA_ASSERT( m_archive.isValid(),
                  "Could not open as Ogawa file from provided streams." );
 
-    ABCA_ASSERT( m_archive.isFrozen(),
-        "Ogawa streams not cleanly closed while being written. " );
+    if ( !m_archive.isFrozen() )
+    {
+        ABCA_ASSERT( iOpenCheckpoints,
+            "Ogawa streams not cleanly closed while being written. " );
+
+        ABCA_ASSERT( m_archive.getGroup()->getNumChildren() > 0,
+            "Ogawa streams not cleanly closed and have no checkpoint. " );
+    }
 
     init();
 }
@@ -169,6 +189,42 @@ AbcA::ObjectReaderPtr ArImpl::getTop()
     return ret;
 }
 
+//-*****************************************************************************
+bool ArImpl::refresh()
+{
+    if ( !m_refreshable )
+    {
+        return false;
+    }
+
+    Alembic::Util::scoped_lock l( m_orlock );
+
+    if ( !m_archive.refresh() )
+    {
+        return false;
+    }
+
+    {
+        Alembic::Util::scoped_lock hl( m_headersLock );
+        m_oldObjectHeaders.swap( m_objectHeaders );
+        m_objectHeaders.clear();
+        m_oldPropertyHeaders.swap( m_propertyHeaders );
+        m_propertyHeaders.clear();
+    }
+
+    // what was gotten from the old top holds on to the old header and data,
+    // the TimeSamplings and indexed MetaData are only ever added to
+    m_timeSamples.clear();
+    m_maxSamples.clear();
+    m_indexMetaData.clear();
+    m_header.reset( new AbcA::ObjectHeader() );
+    m_top.reset();
+
+    init();
+
+    return true;
+}
+
 //-*****************************************************************************
 AbcA::TimeSamplingPtr ArImpl::getTimeSampling( Util::uint32_t iIndex )
 {
@@ -207,12 +263,126 @@ ArImpl::~ArImpl()
 {
 }
 
+//-*****************************************************************************
+Ogawa::IGroupPtr ArImpl::getTopGroup()
+{
+    return m_archive.getGroup()->getGroup( 2, false, 0 );
+}
+
 //-*****************************************************************************
 const std::vector< AbcA::MetaData > & ArImpl::getIndexedMetaData()
 {
     return m_indexMetaData;
 }
 
+//-*****************************************************************************
+BlobStorePtr ArImpl::getBlobStore()
+{
+    Alembic::Util::scoped_lock l( m_blobLock );
+
+    if ( !m_blobStore )
+    {
+        std::string root = m_header->getMetaData().get( "_ai_BlobStore" );
+        if ( !root.empty() )
+        {
+            m_blobStore = BlobStore::getShared( root );
+        }
+    }
+
+    return m_blobStore;
+}
+
+//-*****************************************************************************
+AbcA::ArraySampleAllocatorPtr ArImpl::getArraySampleAllocator()
+{
+    return m_allocator;
+}
+
+//-*****************************************************************************
+void ArImpl::setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iAllocator )
+{
+    m_allocator = iAllocator;
+}
+
+//-*****************************************************************************
+bool ArImpl::findHeaders( Util::uint64_t iPos,
+                          std::vector< ObjectHeaderPtr > & oHeaders )
+{
+    if ( !m_refreshable )
+    {
+        return false;
+    }
+
+    Alembic::Util::scoped_lock l( m_headersLock );
+
+    ObjectHeadersMap::iterator it = m_objectHeaders.find( iPos );
+    if ( it != m_objectHeaders.end() )
+    {
+        oHeaders = it->second;
+        return true;
+    }
+
+    it = m_oldObjectHeaders.find( iPos );
+    if ( it != m_oldObjectHeaders.end() )
+    {
+        oHeaders = it->second;
+        m_objectHeaders[iPos] = it->second;
+        return true;
+    }
+
+    return false;
+}
+
+//-*****************************************************************************
+void ArImpl::addHeaders( Util::uint64_t iPos,
+                         const std::vector< ObjectHeaderPtr > & iHeaders )
+{
+    if ( m_refreshable )
+    {
+        Alembic::Util::scoped_lock l( m_headersLock );
+        m_objectHeaders[iPos] = iHeaders;
+    }
+}
+
+//-*****************************************************************************
+bool ArImpl::findHeaders( Util::uint64_t iPos, PropertyHeaderPtrs & oHeaders )
+{
+    if ( !m_refreshable )
+    {
+        return false;
+    }
+
+    Alembic::Util::scoped_lock l( m_headersLock );
+
+    PropertyHeadersMap::iterator it = m_propertyHeaders.find( iPos );
+    if ( it != m_propertyHeaders.end() )
+    {
+        oHeaders = it->second;
+        return true;
+    }
+
+    it = m_oldPropertyHeaders.find( iPos );
+    if ( it != m_oldPropertyHeaders.end() )
+    {
+        oHeaders = it->second;
+        m_propertyHeaders[iPos] = it->second;
+        return true;
+    }
+
+    return false;
+}
+
+//-*****************************************************************************
+void ArImpl::addHeaders( Util::uint64_t iPos,
+                         const PropertyHeaderPtrs & iHeaders )
+{
+    if ( m_refreshable )
+    {
+        Alembic::Util::scoped_lock l( m_headersLock );
+        m_propertyHeaders[iPos] = iHeaders;
+    }
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
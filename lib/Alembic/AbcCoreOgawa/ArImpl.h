@@ -39,6 +39,7 @@
 
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/StreamManager.h>
+#include <Alembic/AbcCoreOgawa/BlobStore.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -55,11 +56,18 @@ class ArImpl
 private:
     friend class ReadArchive;
 
+    // iOpenCheckpoints allows archives that weren't cleanly closed to be
+    // read as of their last checkpoint, and iRefreshable lets refresh pick
+    // up later ones
     ArImpl( const std::string &iFileName,
             size_t iNumStreams=1,
-            bool iUseMMap=true);
+            bool iUseMMap=true,
+            bool iOpenCheckpoints=false,
+            bool iRefreshable=false );
 
-    ArImpl( const std::vector< std::istream * > & iStreams );
+    ArImpl( const std::vector< std::istream * > & iStreams,
+            bool iOpenCheckpoints=false,
+            bool iRefreshable=false );
 
 public:
 
@@ -88,6 +96,11 @@ public:
     {
     }
 
+    virtual AbcA::ArraySampleAllocatorPtr getArraySampleAllocator();
+
+    virtual void
+    setArraySampleAllocator( AbcA::ArraySampleAllocatorPtr iAllocator );
+
     virtual AbcA::index_t getMaxNumSamplesForTimeSamplingIndex(
         Util::uint32_t iIndex );
 
@@ -101,13 +114,36 @@ public:
         return m_archiveVersion;
     }
 
+    virtual bool refresh();
+
     StreamIDPtr getStreamID();
 
     const std::vector< AbcA::MetaData > & getIndexedMetaData();
 
+    // The group of the top object, used when the archive is reopened for
+    // appending.
+    Ogawa::IGroupPtr getTopGroup();
+
+    // Where externally stored samples are read from, this is the store
+    // recorded in the archive MetaData unless one was set.
+    BlobStorePtr getBlobStore();
+
+    // Refreshable archives keep the headers read from each object and
+    // compound group by the position of the group.  Written groups never
+    // change, so what is unchanged by a refresh isn't read again.
+    bool findHeaders( Util::uint64_t iPos,
+                      std::vector< ObjectHeaderPtr > & oHeaders );
+    void addHeaders( Util::uint64_t iPos,
+                     const std::vector< ObjectHeaderPtr > & iHeaders );
+
+    bool findHeaders( Util::uint64_t iPos, PropertyHeaderPtrs & oHeaders );
+    void addHeaders( Util::uint64_t iPos, const PropertyHeaderPtrs & iHeaders );
+
 private:
     void init();
 
+    void setBlobStore( BlobStorePtr iStore ) { m_blobStore = iStore; }
+
     std::string m_fileName;
     size_t m_numStreams;
 
@@ -127,6 +163,24 @@ private:
     StreamManager m_manager;
 
     std::vector< AbcA::MetaData > m_indexMetaData;
+
+    BlobStorePtr m_blobStore;
+    Alembic::Util::mutex m_blobLock;
+
+    AbcA::ArraySampleAllocatorPtr m_allocator;
+
+    bool m_refreshable;
+
+    // what was found since the last refresh, and what was before it which
+    // is dropped by the next one unless it is found again
+    typedef std::map< Util::uint64_t, std::vector< ObjectHeaderPtr > >
+        ObjectHeadersMap;
+    typedef std::map< Util::uint64_t, PropertyHeaderPtrs > PropertyHeadersMap;
+    ObjectHeadersMap m_objectHeaders;
+    ObjectHeadersMap m_oldObjectHeaders;
+    PropertyHeadersMap m_propertyHeaders;
+    PropertyHeadersMap m_oldPropertyHeaders;
+    Alembic::Util::mutex m_headersLock;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -35,8 +35,10 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 #include <Alembic/AbcCoreOgawa/OwData.h>
 #include <Alembic/AbcCoreOgawa/OwImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
 namespace Alembic {
@@ -50,6 +52,9 @@ AwImpl::AwImpl( const std::string &iFileName,
   , m_metaData( iMetaData )
   , m_archive( iFileName )
   , m_metaDataMap( new MetaDataMap() )
+  , m_minBlobBytes( 0 )
+  , m_checkpointInterval( 0 )
+  , m_lastCheckpoint( 0 )
 {
 
     // add default time sampling
@@ -71,6 +76,9 @@ AwImpl::AwImpl( std::ostream * iStream,
   : m_metaData( iMetaData )
   , m_archive( iStream )
   , m_metaDataMap( new MetaDataMap() )
+  , m_minBlobBytes( 0 )
+  , m_checkpointInterval( 0 )
+  , m_lastCheckpoint( 0 )
 {
     // add default time sampling
     AbcA::TimeSamplingPtr ts( new AbcA::TimeSampling() );
@@ -86,7 +94,134 @@ AwImpl::AwImpl( std::ostream * iStream,
 }
 
 //-*****************************************************************************
-void AwImpl::init()
+AwImpl::AwImpl( const std::string &iFileName,
+                const AbcA::MetaData &iMetaData,
+                Alembic::Util::shared_ptr< ArImpl > iExisting )
+  : m_fileName( iFileName )
+  , m_metaData( iExisting->getMetaData() )
+  , m_archive( iFileName, true )
+  , m_metaDataMap( new MetaDataMap() )
+  , m_minBlobBytes( 0 )
+  , m_existing( iExisting )
+  , m_checkpointInterval( 0 )
+  , m_lastCheckpoint( 0 )
+{
+    if ( !m_archive.isValid() )
+    {
+        ABCA_THROW( "Could not open file for appending: " << m_fileName );
+    }
+
+    // keep the existing TimeSamplings at the same indices, including the
+    // default one
+    for ( Util::uint32_t i = 0; i < m_existing->getNumTimeSamplings(); ++i )
+    {
+        AbcA::TimeSamplingPtr ts(
+            new AbcA::TimeSampling( *m_existing->getTimeSampling( i ) ) );
+        m_timeSamples.push_back( ts );
+        m_maxSamples.push_back(
+            m_existing->getMaxNumSamplesForTimeSamplingIndex( i ) );
+    }
+
+    // the headers that aren't rewritten refer to the indexed MetaData by
+    // position, so it needs to start out the same
+    const std::vector< AbcA::MetaData > & indexed =
+        m_existing->getIndexedMetaData();
+    for ( std::size_t i = 1; i < indexed.size(); ++i )
+    {
+        m_metaDataMap->getIndex( indexed[i].serialize() );
+    }
+
+    for ( AbcA::MetaData::const_iterator it = iMetaData.begin();
+          it != iMetaData.end(); ++it )
+    {
+        m_metaData.set( it->first, it->second );
+    }
+
+    init( m_existing->getTopGroup() );
+}
+
+//-*****************************************************************************
+// Lets the samples under iCompound be shared by samples written after the
+// archive was reopened.
+static void SeedWrittenSamples( Ogawa::IGroupPtr iCompound,
+                                Ogawa::OGroupPtr iWrapper,
+                                ArImpl & iArchive,
+                                WrittenSampleMap & ioMap,
+                                WrittenSampleMap & ioExternalMap )
+{
+    PropertyHeaderPtrs headers;
+    std::size_t numChildren = iCompound->getNumChildren();
+    if ( numChildren > 0 && iCompound->isChildData( numChildren - 1 ) )
+    {
+        ReadPropertyHeaders( iCompound, numChildren - 1, 0, iArchive,
+                             iArchive.getIndexedMetaData(), headers );
+    }
+
+    for ( std::size_t i = 0; i < headers.size(); ++i )
+    {
+        Ogawa::IGroupPtr group = iCompound->getGroup( i, false, 0 );
+        if ( !group )
+        {
+            continue;
+        }
+
+        if ( headers[i]->header.isCompound() )
+        {
+            SeedWrittenSamples( group, iWrapper, iArchive, ioMap,
+                                ioExternalMap );
+            continue;
+        }
+
+        std::vector< WrittenSampleIDPtr > samples;
+        std::vector< AbcA::Dimensions > dims;
+        ReadWrittenSamples( group, iWrapper, headers[i], samples, dims );
+
+        WrittenSampleMap & sampleMap =
+            headers[i]->isExternal ? ioExternalMap : ioMap;
+
+        // the empty samples are already seeded
+        for ( std::size_t j = 0; j < samples.size(); ++j )
+        {
+            if ( samples[j]->getKey().numBytes != 0 )
+            {
+                sampleMap.store( samples[j] );
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+static void SeedWrittenObjectSamples( Ogawa::IGroupPtr iObject,
+                                      Ogawa::OGroupPtr iWrapper,
+                                      ArImpl & iArchive,
+                                      WrittenSampleMap & ioMap,
+                                      WrittenSampleMap & ioExternalMap )
+{
+    // the properties, the child objects, and then the headers
+    std::size_t numChildren = iObject->getNumChildren();
+    for ( std::size_t i = 0; i + 1 < numChildren; ++i )
+    {
+        Ogawa::IGroupPtr group = iObject->getGroup( i, false, 0 );
+        if ( !group )
+        {
+            continue;
+        }
+
+        if ( i == 0 )
+        {
+            SeedWrittenSamples( group, iWrapper, iArchive, ioMap,
+                                ioExternalMap );
+        }
+        else
+        {
+            SeedWrittenObjectSamples( group, iWrapper, iArchive, ioMap,
+                                      ioExternalMap );
+        }
+    }
+}
+
+//-*****************************************************************************
+void AwImpl::init( Ogawa::IGroupPtr iExistingTop )
 {
     // set the version using Ogawa native calls
     // This expresses the AbcCoreOgawa version - how properties,
@@ -102,7 +237,15 @@ void AwImpl::init()
 
     m_metaData.set("_ai_AlembicVersion", AbcA::GetLibraryVersion());
 
-    m_data.reset( new OwData( m_archive.getGroup()->addGroup() ) );
+    if ( iExistingTop )
+    {
+        m_data.reset( new OwData( m_archive.getGroup()->addGroup(),
+                                  iExistingTop, "/", *m_existing ) );
+    }
+    else
+    {
+        m_data.reset( new OwData( m_archive.getGroup()->addGroup() ) );
+    }
 
     // seed with the common empty keys
     AbcA::ArraySampleKey emptyKey;
@@ -113,16 +256,102 @@ void AwImpl::init()
     emptyKey.readPOD = Alembic::Util::kInt8POD;
     WrittenSampleIDPtr wsid( new WrittenSampleID( emptyKey, emptyData, 0 ) );
     m_writtenSampleMap.store( wsid );
+    m_externalSampleMap.store( wsid );
 
     emptyKey.origPOD = Alembic::Util::kStringPOD;
     emptyKey.readPOD = Alembic::Util::kStringPOD;
     wsid.reset( new WrittenSampleID( emptyKey, emptyData, 0 ) );
     m_writtenSampleMap.store( wsid );
+    m_externalSampleMap.store( wsid );
 
     emptyKey.origPOD = Alembic::Util::kWstringPOD;
     emptyKey.readPOD = Alembic::Util::kWstringPOD;
     wsid.reset( new WrittenSampleID( emptyKey, emptyData, 0 ) );
     m_writtenSampleMap.store( wsid );
+    m_externalSampleMap.store( wsid );
+
+    if ( iExistingTop )
+    {
+        SeedWrittenObjectSamples( iExistingTop, m_archive.getGroup(),
+                                  *m_existing, m_writtenSampleMap,
+                                  m_externalSampleMap );
+    }
+
+    m_lastCheckpoint = m_archive.getSize();
+}
+
+//-*****************************************************************************
+void AwImpl::setBlobStore( BlobStorePtr iStore, std::size_t iMinBytes )
+{
+    m_blobStore = iStore;
+    m_minBlobBytes = iMinBytes;
+
+    // so readers can find the samples without being told where they are
+    if ( m_blobStore )
+    {
+        m_metaData.set( "_ai_BlobStore", m_blobStore->getRoot() );
+    }
+}
+
+//-*****************************************************************************
+void AwImpl::checkpoint()
+{
+    if ( !m_data || !m_archive.isValid() )
+    {
+        return;
+    }
+
+    // the properties that are done have already been counted
+    std::vector< AbcA::index_t > maxSamples = m_maxSamples;
+
+    // the versions and the top object, see init, the top object is
+    // snapshotted first since its headers may add to the MetaDataMap
+    Ogawa::OGroupPtr group = m_archive.getGroup();
+    std::vector< Util::uint64_t > children = group->getChildPositions();
+    children[2] = m_data->writeCheckpoint( m_metaDataMap, maxSamples );
+
+    // then the same tables the destructor adds
+    std::string metaData = m_metaData.serialize();
+    children.push_back( group->writeDetachedData( metaData.size(),
+                                                  metaData.c_str() ) );
+
+    std::vector< Util::uint8_t > data;
+    packTimeSamplings( maxSamples, data );
+    children.push_back( group->writeDetachedData( data.size(),
+                                                  &( data.front() ) ) );
+
+    data.clear();
+    m_metaDataMap->serialize( data );
+    children.push_back( group->writeDetachedData( data.size(),
+        data.empty() ? NULL : &( data.front() ) ) );
+
+    // everything it refers to is in the file before the header points at it
+    m_archive.checkpoint( group->writeDetachedGroup( children ) );
+    m_lastCheckpoint = m_archive.getSize();
+}
+
+//-*****************************************************************************
+void AwImpl::checkpointIfNeeded()
+{
+    if ( m_checkpointInterval != 0 &&
+         m_archive.getSize() - m_lastCheckpoint >= m_checkpointInterval )
+    {
+        checkpoint();
+    }
+}
+
+//-*****************************************************************************
+void AwImpl::packTimeSamplings(
+    const std::vector< AbcA::index_t > & iMaxSamples,
+    std::vector< Util::uint8_t > & oData )
+{
+    Util::uint32_t numSamplings = getNumTimeSamplings();
+    for ( Util::uint32_t i = 0; i < numSamplings; ++i )
+    {
+        Util::uint32_t maxSample = iMaxSamples[i];
+        AbcA::TimeSamplingPtr timePtr = getTimeSampling( i );
+        WriteTimeSampling( oData, maxSample, *timePtr );
+    }
 }
 
 //-*****************************************************************************
@@ -216,8 +445,9 @@ void AwImpl::setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
 AwImpl::~AwImpl()
 {
 
-    // empty out the map so any dataset IDs will be freed up
+    // empty out the maps so any dataset IDs will be freed up
     m_writtenSampleMap.clear();
+    m_externalSampleMap.clear();
 
     // write out our child headers
     if ( m_data )
@@ -239,13 +469,7 @@ AwImpl::~AwImpl()
         m_archive.getGroup()->addData( metaData.size(), metaData.c_str() );
 
         std::vector< Util::uint8_t > data;
-        Util::uint32_t numSamplings = getNumTimeSamplings();
-        for ( Util::uint32_t i = 0; i < numSamplings; ++i )
-        {
-            Util::uint32_t maxSample = m_maxSamples[i];
-            AbcA::TimeSamplingPtr timePtr = getTimeSampling( i );
-            WriteTimeSampling( data, maxSample, *timePtr );
-        }
+        packTimeSamplings( m_maxSamples, data );
 
         m_archive.getGroup()->addData( data.size(), &( data.front() ) );
         m_metaDataMap->write( m_archive.getGroup() );
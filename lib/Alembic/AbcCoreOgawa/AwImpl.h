@@ -48,6 +48,7 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 class OwData;
 class OwImpl;
+class ArImpl;
 
 //-*****************************************************************************
 class AwImpl : public AbcA::ArchiveWriter
@@ -55,6 +56,7 @@ class AwImpl : public AbcA::ArchiveWriter
 {
 private:
     friend class WriteArchive;
+    friend class AppendArchive;
 
     AwImpl( const std::string &iFileName,
             const AbcA::MetaData &iMetaData );
@@ -62,6 +64,11 @@ private:
     AwImpl( std::ostream * iStream,
             const AbcA::MetaData & iMetaData );
 
+    // reopens iFileName, which iExisting has open, to add to it
+    AwImpl( const std::string &iFileName,
+            const AbcA::MetaData &iMetaData,
+            Alembic::Util::shared_ptr< ArImpl > iExisting );
+
 public:
     virtual ~AwImpl();
 
@@ -84,11 +91,24 @@ public:
         return m_writtenSampleMap;
     }
 
+    WrittenSampleMap &getExternalSampleMap()
+    {
+        return m_externalSampleMap;
+    }
+
     MetaDataMapPtr getMetaDataMap()
     {
         return m_metaDataMap;
     }
 
+    BlobStorePtr getBlobStore() const { return m_blobStore; }
+
+    std::size_t getMinBlobBytes() const { return m_minBlobBytes; }
+
+    // What was in the archive before it was reopened for appending, NULL if
+    // it wasn't.
+    ArImpl * getExisting() { return m_existing.get(); }
+
     virtual Util::uint32_t addTimeSampling( const AbcA::TimeSampling & iTs );
 
     virtual AbcA::TimeSamplingPtr getTimeSampling( Util::uint32_t iIndex );
@@ -102,8 +122,30 @@ public:
     virtual void setMaxNumSamplesForTimeSamplingIndex( Util::uint32_t iIndex,
                                                       AbcA::index_t iMaxIndex );
 
+    // Writes what has been written so far, the object and property headers,
+    // TimeSamplings and indexed MetaData included, at the end of the file
+    // and points the file header at it.  The archive stays marked as not
+    // cleanly closed, but ReadArchive::setOpenCheckpoints can open it as of
+    // the last checkpoint, whether it is still being written or crashed.
+    // An archive being appended to was cleanly closed before, so there every
+    // reader sees the last checkpoint.
+    void checkpoint();
+
+    // checkpoint if at least the checkpoint interval was written since the
+    // last one
+    void checkpointIfNeeded();
+
 private:
-    void init();
+    void init( Ogawa::IGroupPtr iExistingTop = Ogawa::IGroupPtr() );
+
+    void setBlobStore( BlobStorePtr iStore, std::size_t iMinBytes );
+
+    void setCheckpointInterval( Util::uint64_t iNumBytes )
+    { m_checkpointInterval = iNumBytes; }
+
+    void packTimeSamplings( const std::vector< AbcA::index_t > & iMaxSamples,
+                            std::vector< Util::uint8_t > & oData );
+
     std::string m_fileName;
     AbcA::MetaData m_metaData;
     Alembic::Ogawa::OArchive m_archive;
@@ -117,6 +159,18 @@ private:
 
     WrittenSampleMap m_writtenSampleMap;
     MetaDataMapPtr m_metaDataMap;
+
+    BlobStorePtr m_blobStore;
+    std::size_t m_minBlobBytes;
+    WrittenSampleMap m_externalSampleMap;
+
+    Alembic::Util::shared_ptr< ArImpl > m_existing;
+
+    // 0 means only checkpoint when asked to
+    Util::uint64_t m_checkpointInterval;
+
+    // the size of the file as of the last checkpoint
+    Util::uint64_t m_lastCheckpoint;
 };
 
 } // End namespace ALEMBIC_VERSION_NS
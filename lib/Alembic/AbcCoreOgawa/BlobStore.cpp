@@ -0,0 +1,269 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreOgawa/BlobStore.h>
+#include <Alembic/AbcCoreAbstract/Foundation.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _MSC_VER
+#include <direct.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+void makeDirectory( const std::string & iPath )
+{
+    if ( iPath.empty() )
+    {
+        return;
+    }
+
+#ifdef _MSC_VER
+    _mkdir( iPath.c_str() );
+#else
+    mkdir( iPath.c_str(), 0777 );
+#endif
+}
+
+//-*****************************************************************************
+bool fileExists( const std::string & iPath )
+{
+    struct stat buf;
+    return stat( iPath.c_str(), &buf ) == 0;
+}
+
+//-*****************************************************************************
+int processId()
+{
+#ifdef _MSC_VER
+    return _getpid();
+#else
+    return ( int ) getpid();
+#endif
+}
+
+} // namespace
+
+//-*****************************************************************************
+BlobStore::BlobStore( const std::string & iRoot, std::size_t iCacheBytes )
+    : m_root( iRoot )
+    , m_cacheBytes( iCacheBytes )
+    , m_cachedBytes( 0 )
+{
+    ABCA_ASSERT( !m_root.empty(), "BlobStore needs a root directory" );
+
+    // create each missing directory along the way
+    for ( std::size_t pos = m_root.find_first_of( "/\\", 1 );
+          pos != std::string::npos;
+          pos = m_root.find_first_of( "/\\", pos + 1 ) )
+    {
+        makeDirectory( m_root.substr( 0, pos ) );
+    }
+    makeDirectory( m_root );
+
+    ABCA_ASSERT( fileExists( m_root ),
+        "Could not create the BlobStore directory: " << m_root );
+}
+
+//-*****************************************************************************
+std::string BlobStore::getPath( const Alembic::Util::Digest & iDigest ) const
+{
+    // the first byte picks a sub directory, so none get too big
+    std::string name = iDigest.str();
+    return m_root + "/" + name.substr( 0, 2 ) + "/" + name.substr( 2 );
+}
+
+//-*****************************************************************************
+bool BlobStore::has( const Alembic::Util::Digest & iDigest ) const
+{
+    return fileExists( getPath( iDigest ) );
+}
+
+//-*****************************************************************************
+void BlobStore::put( const Alembic::Util::Digest & iDigest,
+                     std::size_t iNumBuffers,
+                     const void ** iBuffers,
+                     const Alembic::Util::uint64_t * iSizes )
+{
+    std::string path = getPath( iDigest );
+    if ( fileExists( path ) )
+    {
+        return;
+    }
+
+    makeDirectory( m_root + "/" + iDigest.str().substr( 0, 2 ) );
+
+    // unique to this process and this store
+    std::stringstream tmp;
+    tmp << path << ".tmp" << processId() << "_" << ( void * ) this;
+    std::string tmpPath = tmp.str();
+
+    {
+        std::ofstream strm( tmpPath.c_str(),
+                            std::ios_base::binary | std::ios_base::trunc );
+        ABCA_ASSERT( strm.is_open(),
+            "Could not write the blob: " << tmpPath );
+
+        for ( std::size_t i = 0; i < iNumBuffers; ++i )
+        {
+            strm.write( static_cast< const char * >( iBuffers[i] ),
+                        iSizes[i] );
+        }
+
+        ABCA_ASSERT( strm.good(), "Could not write the blob: " << tmpPath );
+    }
+
+    // someone else may have stored the same blob in the meantime, which is
+    // fine since the contents are the same
+    if ( std::rename( tmpPath.c_str(), path.c_str() ) != 0 )
+    {
+        std::remove( tmpPath.c_str() );
+        ABCA_ASSERT( fileExists( path ),
+            "Could not store the blob: " << path );
+    }
+}
+
+//-*****************************************************************************
+BlobStore::BlobPtr BlobStore::get( const Alembic::Util::Digest & iDigest )
+{
+    {
+        Alembic::Util::scoped_lock l( m_lock );
+        std::map< Alembic::Util::Digest, CacheList::iterator >::iterator it =
+            m_cacheMap.find( iDigest );
+        if ( it != m_cacheMap.end() )
+        {
+            // move it to the front
+            m_cacheList.splice( m_cacheList.begin(), m_cacheList,
+                                it->second );
+            return it->second->second;
+        }
+    }
+
+    std::string path = getPath( iDigest );
+    std::ifstream strm( path.c_str(), std::ios_base::binary );
+    if ( !strm.is_open() )
+    {
+        return BlobPtr();
+    }
+
+    strm.seekg( 0, std::ios_base::end );
+    std::streamoff size = strm.tellg();
+    strm.seekg( 0, std::ios_base::beg );
+
+    Alembic::Util::shared_ptr< std::vector< char > > blob(
+        new std::vector< char >( ( std::size_t ) size ) );
+    if ( size > 0 )
+    {
+        strm.read( &blob->front(), size );
+        ABCA_ASSERT( strm.gcount() == size,
+            "Could not read the blob: " << path );
+    }
+
+    Alembic::Util::scoped_lock l( m_lock );
+
+    // another thread may have read it while we were
+    std::map< Alembic::Util::Digest, CacheList::iterator >::iterator it =
+        m_cacheMap.find( iDigest );
+    if ( it != m_cacheMap.end() )
+    {
+        return it->second->second;
+    }
+
+    if ( blob->size() <= m_cacheBytes )
+    {
+        m_cacheList.push_front( CacheEntry( iDigest, blob ) );
+        m_cacheMap[iDigest] = m_cacheList.begin();
+        m_cachedBytes += blob->size();
+        trimCache();
+    }
+
+    return blob;
+}
+
+//-*****************************************************************************
+void BlobStore::setCacheBytes( std::size_t iCacheBytes )
+{
+    Alembic::Util::scoped_lock l( m_lock );
+    m_cacheBytes = iCacheBytes;
+    trimCache();
+}
+
+//-*****************************************************************************
+void BlobStore::trimCache()
+{
+    while ( m_cachedBytes > m_cacheBytes && !m_cacheList.empty() )
+    {
+        m_cachedBytes -= m_cacheList.back().second->size();
+        m_cacheMap.erase( m_cacheList.back().first );
+        m_cacheList.pop_back();
+    }
+}
+
+//-*****************************************************************************
+BlobStorePtr BlobStore::getShared( const std::string & iRoot )
+{
+    static Alembic::Util::mutex sharedLock;
+    static std::map< std::string, Alembic::Util::weak_ptr< BlobStore > >
+        sharedStores;
+
+    Alembic::Util::scoped_lock l( sharedLock );
+    BlobStorePtr store = sharedStores[iRoot].lock();
+    if ( !store )
+    {
+        store.reset( new BlobStore( iRoot ) );
+        sharedStores[iRoot] = store;
+    }
+
+    return store;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
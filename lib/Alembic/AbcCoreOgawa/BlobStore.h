@@ -0,0 +1,129 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcCoreOgawa_BlobStore_h
+#define Alembic_AbcCoreOgawa_BlobStore_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+#include <Alembic/Util/Digest.h>
+#include <Alembic/Ogawa/IData.h>
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Alembic {
+namespace AbcCoreOgawa {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! A directory of array samples stored outside of any archive, named by the
+//! 128 bit digest of the sample.  Archives written with a BlobStore (see
+//! WriteArchive::setBlobStore) keep a small reference to each large sample
+//! instead of the sample itself, so identical samples written to any number
+//! of archives are only stored, and paged in, once.
+//!
+//! Blobs that have been read are kept in memory, up to the cache size, so
+//! archives that share a BlobStore share those reads too.  All of the
+//! functions are thread safe.
+class ALEMBIC_EXPORT BlobStore : Alembic::Util::noncopyable
+{
+public:
+    typedef Alembic::Ogawa::IBufferPtr BlobPtr;
+
+    //! iRoot is created if it doesn't exist.  iCacheBytes is how many bytes
+    //! of read blobs are held on to.
+    explicit BlobStore( const std::string & iRoot,
+                        std::size_t iCacheBytes = 256 * 1024 * 1024 );
+
+    const std::string & getRoot() const { return m_root; }
+
+    //! The file that the blob named by iDigest is stored in.
+    std::string getPath( const Alembic::Util::Digest & iDigest ) const;
+
+    bool has( const Alembic::Util::Digest & iDigest ) const;
+
+    //! Stores the concatenation of the iNumBuffers buffers as the blob
+    //! named by iDigest, unless it is already there.  The blob is written to
+    //! a temporary file which is then renamed, so other processes never see
+    //! a partial blob.
+    void put( const Alembic::Util::Digest & iDigest,
+              std::size_t iNumBuffers,
+              const void ** iBuffers,
+              const Alembic::Util::uint64_t * iSizes );
+
+    //! Returns the blob named by iDigest, or an empty pointer if it isn't
+    //! in the store.
+    BlobPtr get( const Alembic::Util::Digest & iDigest );
+
+    std::size_t getCacheBytes() const { return m_cacheBytes; }
+
+    void setCacheBytes( std::size_t iCacheBytes );
+
+    //! Returns the BlobStore for iRoot that is shared by every caller, this
+    //! is what archives that recorded a BlobStore use when reading unless
+    //! they are given one.
+    static Alembic::Util::shared_ptr< BlobStore >
+    getShared( const std::string & iRoot );
+
+private:
+    void trimCache();
+
+    std::string m_root;
+    std::size_t m_cacheBytes;
+
+    // most recently used first
+    typedef std::pair< Alembic::Util::Digest, BlobPtr > CacheEntry;
+    typedef std::list< CacheEntry > CacheList;
+    CacheList m_cacheList;
+    std::map< Alembic::Util::Digest, CacheList::iterator > m_cacheMap;
+    std::size_t m_cachedBytes;
+
+    Alembic::Util::mutex m_lock;
+};
+
+typedef Alembic::Util::shared_ptr< BlobStore > BlobStorePtr;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcCoreOgawa
+} // End namespace Alembic
+
+#endif
@@ -62,8 +62,16 @@ CprData::CprData( Ogawa::IGroupPtr iGroup,
     if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) )
     {
         PropertyHeaderPtrs headers;
-        ReadPropertyHeaders( m_group, numChildren - 1, iThreadId,
-                             iArchive, iIndexedMetaData, headers );
+        ArImpl * archive = dynamic_cast< ArImpl * >( &iArchive );
+        if ( !archive || !archive->findHeaders( m_group->getPos(), headers ) )
+        {
+            ReadPropertyHeaders( m_group, numChildren - 1, iThreadId,
+                                 iArchive, iIndexedMetaData, headers );
+            if ( archive )
+            {
+                archive->addHeaders( m_group->getPos(), headers );
+            }
+        }
 
         m_propertyHeaders = new SubProperty[ headers.size() ];
         for ( std::size_t i = 0; i < headers.size(); ++i )
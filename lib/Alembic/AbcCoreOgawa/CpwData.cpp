@@ -40,6 +40,8 @@
 #include <Alembic/AbcCoreOgawa/ApwImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -51,6 +53,39 @@ CpwData::CpwData( Ogawa::OGroupPtr iGroup )
 {
 }
 
+//-*****************************************************************************
+CpwData::CpwData( Ogawa::OGroupPtr iGroup,
+                  Ogawa::IGroupPtr iExisting,
+                  ArImpl & iArchive )
+    : m_group( iGroup )
+{
+    ABCA_ASSERT( m_group, "Invalid group" );
+    ABCA_ASSERT( iExisting, "Invalid existing group" );
+
+    std::size_t numChildren = iExisting->getNumChildren();
+    if ( numChildren > 0 && iExisting->isChildData( numChildren - 1 ) )
+    {
+        ReadPropertyHeaders( iExisting, numChildren - 1, 0, iArchive,
+                             iArchive.getIndexedMetaData(),
+                             m_propertyHeaders );
+    }
+
+    for ( size_t i = 0; i < m_propertyHeaders.size(); ++i )
+    {
+        Ogawa::IGroupPtr child = iExisting->getGroup( i, false, 0 );
+        ABCA_ASSERT( child, "Invalid existing property: " <<
+                     m_propertyHeaders[i]->header.getName() );
+        m_group->addExistingGroup( child->getPos() );
+        m_existingProperties.push_back( child );
+
+        Util::uint64_t hash0, hash1;
+        HashExistingProperty( child, m_propertyHeaders[i], iArchive,
+                              hash0, hash1 );
+        m_hashes.push_back( hash0 );
+        m_hashes.push_back( hash1 );
+    }
+}
+
 //-*****************************************************************************
 CpwData::~CpwData()
 {
@@ -95,17 +130,53 @@ CpwData::getPropertyHeader( const std::string &iName )
 
 //-*****************************************************************************
 AbcA::BasePropertyWriterPtr
-CpwData::getProperty( const std::string &iName )
+CpwData::getProperty( AbcA::CompoundPropertyWriterPtr iParent,
+                      const std::string &iName )
 {
     MadeProperties::iterator fiter = m_madeProperties.find( iName );
-    if ( fiter == m_madeProperties.end() )
+    if ( fiter != m_madeProperties.end() )
     {
-        return AbcA::BasePropertyWriterPtr();
+        WeakBpwPtr wptr = (*fiter).second;
+        return wptr.lock();
     }
 
-    WeakBpwPtr wptr = (*fiter).second;
+    // rewrite a property that was written before the archive was reopened
+    for ( size_t i = 0; i < m_existingProperties.size(); ++i )
+    {
+        PropertyHeaderPtr headerPtr = m_propertyHeaders[i];
+        if ( headerPtr->header.getName() != iName )
+        {
+            continue;
+        }
+
+        AbcA::BasePropertyWriterPtr ret;
+        if ( headerPtr->header.isScalar() )
+        {
+            Alembic::Util::shared_ptr<SpwImpl> spw( new SpwImpl( iParent,
+                m_group->rewriteGroup( i ), headerPtr, i ) );
+            spw->adoptSamples( m_existingProperties[i] );
+            ret = spw;
+        }
+        else if ( headerPtr->header.isArray() )
+        {
+            Alembic::Util::shared_ptr<ApwImpl> apw( new ApwImpl( iParent,
+                m_group->rewriteGroup( i ), headerPtr, i ) );
+            apw->adoptSamples( m_existingProperties[i] );
+            ret = apw;
+        }
+        else
+        {
+            ret = Alembic::Util::shared_ptr<CpwImpl>( new CpwImpl( iParent,
+                m_group->rewriteGroup( i ), m_existingProperties[i],
+                headerPtr, i ) );
+        }
+
+        m_madeProperties[iName] = WeakBpwPtr( ret );
+        m_existingProperties[i].reset();
+        return ret;
+    }
 
-    return wptr.lock();
+    return AbcA::BasePropertyWriterPtr();
 }
 
 //-*****************************************************************************
@@ -116,7 +187,7 @@ CpwData::createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
                                const AbcA::DataType & iDataType,
                                Util::uint32_t iTimeSamplingIndex )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) || getPropertyHeader( iName ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -158,7 +229,7 @@ CpwData::createArrayProperty( AbcA::CompoundPropertyWriterPtr iParent,
                               const AbcA::DataType & iDataType,
                               Util::uint32_t iTimeSamplingIndex )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) || getPropertyHeader( iName ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -198,7 +269,7 @@ CpwData::createCompoundProperty( AbcA::CompoundPropertyWriterPtr iParent,
                                  const std::string & iName,
                                  const AbcA::MetaData & iMetaData )
 {
-    if ( m_madeProperties.count( iName ) )
+    if ( m_madeProperties.count( iName ) || getPropertyHeader( iName ) )
     {
         ABCA_THROW( "Already have a property named: " << iName );
     }
@@ -222,26 +293,89 @@ CpwData::createCompoundProperty( AbcA::CompoundPropertyWriterPtr iParent,
 //-*****************************************************************************
 void CpwData::writePropertyHeaders( MetaDataMapPtr iMetaDataMap )
 {
-    // pack in child header and other info
     std::vector< Util::uint8_t > data;
+    packPropertyHeaders( iMetaDataMap, data );
+
+    if ( !data.empty() )
+    {
+        m_group->addData( data.size(), &( data.front() ) );
+    }
+}
+
+//-*****************************************************************************
+void CpwData::packPropertyHeaders( MetaDataMapPtr iMetaDataMap,
+                                   std::vector< Util::uint8_t > & oData )
+{
+    // pack in child header and other info
     for ( size_t i = 0; i < getNumProperties(); ++i )
     {
         PropertyHeaderPtr prop = m_propertyHeaders[i];
-        WritePropertyInfo( data,
+        WritePropertyInfo( oData,
                            prop->header,
                            prop->isScalarLike,
                            prop->isHomogenous,
+                           prop->isExternal,
+                           prop->isCompressed,
                            prop->timeSamplingIndex,
                            prop->nextSampleIndex,
                            prop->firstChangedIndex,
                            prop->lastChangedIndex,
                            iMetaDataMap );
     }
+}
 
+//-*****************************************************************************
+Util::uint64_t
+CpwData::writeCheckpoint( MetaDataMapPtr iMetaDataMap,
+                          std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    // the properties that are done are already frozen in place, the ones
+    // still being written are snapshotted
+    std::vector< Util::uint64_t > children = m_group->getChildPositions();
+    for ( size_t i = 0; i < m_propertyHeaders.size(); ++i )
+    {
+        MadeProperties::iterator fiter =
+            m_madeProperties.find( m_propertyHeaders[i]->header.getName() );
+        if ( fiter == m_madeProperties.end() )
+        {
+            continue;
+        }
+
+        AbcA::BasePropertyWriterPtr prop = fiter->second.lock();
+        if ( !prop )
+        {
+            continue;
+        }
+
+        if ( prop->getPropertyType() == AbcA::kScalarProperty )
+        {
+            children[i] = Alembic::Util::dynamic_pointer_cast< SpwImpl,
+                AbcA::BasePropertyWriter >( prop )->writeCheckpoint(
+                    ioMaxSamples );
+        }
+        else if ( prop->getPropertyType() == AbcA::kArrayProperty )
+        {
+            children[i] = Alembic::Util::dynamic_pointer_cast< ApwImpl,
+                AbcA::BasePropertyWriter >( prop )->writeCheckpoint(
+                    ioMaxSamples );
+        }
+        else
+        {
+            children[i] = Alembic::Util::dynamic_pointer_cast< CpwImpl,
+                AbcA::BasePropertyWriter >( prop )->writeCheckpoint(
+                    iMetaDataMap, ioMaxSamples );
+        }
+    }
+
+    std::vector< Util::uint8_t > data;
+    packPropertyHeaders( iMetaDataMap, data );
     if ( !data.empty() )
     {
-        m_group->addData( data.size(), &( data.front() ) );
+        children.push_back( m_group->writeDetachedData(
+            data.size(), &( data.front() ) ) );
     }
+
+    return m_group->writeDetachedGroup( children );
 }
 
 //-*****************************************************************************
@@ -44,6 +44,8 @@ namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 // data class owned by CpwImpl, or OwImpl if it is a "top" object
 // it owns and makes child properties as well as the group hid_t
 // when necessary
@@ -53,6 +55,13 @@ public:
 
     CpwData( Ogawa::OGroupPtr iGroup );
 
+    // Takes over iExisting, a compound written before the archive was
+    // reopened for appending.  Its properties are referenced in place, and
+    // only rewritten when they are asked for.
+    CpwData( Ogawa::OGroupPtr iGroup,
+             Ogawa::IGroupPtr iExisting,
+             ArImpl & iArchive );
+
     ~CpwData();
 
     size_t getNumProperties();
@@ -61,7 +70,9 @@ public:
 
     const AbcA::PropertyHeader * getPropertyHeader( const std::string &iName );
 
-    AbcA::BasePropertyWriterPtr getProperty( const std::string & iName );
+    AbcA::BasePropertyWriterPtr
+    getProperty( AbcA::CompoundPropertyWriterPtr iParent,
+                 const std::string & iName );
 
     AbcA::ScalarPropertyWriterPtr
     createScalarProperty( AbcA::CompoundPropertyWriterPtr iParent,
@@ -84,6 +95,12 @@ public:
 
     void writePropertyHeaders( MetaDataMapPtr iMetaDataMap );
 
+    // writes a copy of this compound as it is now, with copies of the
+    // properties that are still being written, for AwImpl::checkpoint
+    Util::uint64_t writeCheckpoint(
+        MetaDataMapPtr iMetaDataMap,
+        std::vector< AbcA::index_t > & ioMaxSamples );
+
     void fillHash( size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
@@ -91,6 +108,9 @@ public:
 
 private:
 
+    void packPropertyHeaders( MetaDataMapPtr iMetaDataMap,
+                              std::vector< Util::uint8_t > & oData );
+
     // The group corresponding to this property.
     Ogawa::OGroupPtr m_group;
 
@@ -101,6 +121,9 @@ private:
 
     // child hashes
     std::vector< Util::uint64_t > m_hashes;
+
+    // what was written before the archive was reopened for appending
+    std::vector< Ogawa::IGroupPtr > m_existingProperties;
 };
 
 typedef Alembic::Util::shared_ptr<CpwData> CpwDataPtr;
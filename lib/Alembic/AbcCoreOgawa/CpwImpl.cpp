@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -82,6 +83,28 @@ CpwImpl::CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
     m_data.reset( new CpwData( iGroup ) );
 }
 
+//-*****************************************************************************
+CpwImpl::CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
+                  Ogawa::OGroupPtr iGroup,
+                  Ogawa::IGroupPtr iExisting,
+                  PropertyHeaderPtr iHeader,
+                  size_t iIndex )
+  : m_parent( iParent )
+  , m_header( iHeader )
+  , m_index( iIndex )
+{
+    ABCA_ASSERT( m_parent, "Invalid parent" );
+    ABCA_ASSERT( m_header, "Invalid header" );
+
+    m_object = iParent->getObject();
+
+    ArImpl * existing = Alembic::Util::dynamic_pointer_cast< AwImpl,
+        AbcA::ArchiveWriter >( m_object->getArchive() )->getExisting();
+    ABCA_ASSERT( existing, "Invalid existing archive" );
+
+    m_data.reset( new CpwData( iGroup, iExisting, *existing ) );
+}
+
 //-*****************************************************************************
 CpwImpl::~CpwImpl()
 {
@@ -155,7 +178,7 @@ CpwImpl::getPropertyHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::BasePropertyWriterPtr CpwImpl::getProperty( const std::string & iName )
 {
-    return m_data->getProperty( iName );
+    return m_data->getProperty( asCompoundPtr(), iName );
 }
 
 //-*****************************************************************************
@@ -203,6 +226,14 @@ void CpwImpl::fillHash( std::size_t iIndex, Util::uint64_t iHash0,
     m_data->fillHash( iIndex, iHash0, iHash1 );
 }
 
+//-*****************************************************************************
+Util::uint64_t
+CpwImpl::writeCheckpoint( MetaDataMapPtr iMetaDataMap,
+                          std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    return m_data->writeCheckpoint( iMetaDataMap, ioMaxSamples );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -62,6 +62,14 @@ public:
              PropertyHeaderPtr iHeader,
              size_t iIndex );
 
+    // rewrites iExisting, a child compound written before the archive was
+    // reopened for appending, into iGroup
+    CpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
+             Ogawa::OGroupPtr iGroup,
+             Ogawa::IGroupPtr iExisting,
+             PropertyHeaderPtr iHeader,
+             size_t iIndex );
+
     virtual ~CpwImpl();
 
     //-*************************************************************************
@@ -109,6 +117,10 @@ public:
     void fillHash( size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
+    Util::uint64_t writeCheckpoint(
+        MetaDataMapPtr iMetaDataMap,
+        std::vector< AbcA::index_t > & ioMaxSamples );
+
 private:
 
     // The object we belong to.
@@ -86,6 +86,8 @@ struct PropertyHeaderAndFriends
         firstChangedIndex = 0;
         lastChangedIndex = 0;
         timeSamplingIndex = 0;
+        isExternal = false;
+        isCompressed = false;
     }
 
     // for compounds
@@ -99,6 +101,8 @@ struct PropertyHeaderAndFriends
         firstChangedIndex = 0;
         lastChangedIndex = 0;
         timeSamplingIndex = 0;
+        isExternal = false;
+        isCompressed = false;
     }
 
     // for scalar and array properties
@@ -116,6 +120,8 @@ struct PropertyHeaderAndFriends
         nextSampleIndex = 0;
         firstChangedIndex = 0;
         lastChangedIndex = 0;
+        isExternal = false;
+        isCompressed = false;
     }
 
     // convenience function that makes sure the incoming index is ok, and
@@ -167,6 +173,14 @@ struct PropertyHeaderAndFriends
 
     // Index representing which TimeSampling from the ArchiveWriter to use.
     Util::uint32_t timeSamplingIndex;
+
+    // Whether the samples are references into a BlobStore
+    bool isExternal;
+
+    // Whether array samples are stored as their size followed by a zstd
+    // frame, and scalar samples as just their data, instead of both being
+    // stored after their key
+    bool isCompressed;
 };
 
 typedef Alembic::Util::shared_ptr<PropertyHeaderAndFriends> PropertyHeaderPtr;
@@ -75,36 +75,46 @@ Util::uint32_t MetaDataMap::getIndex( const std::string & iStr )
 //-*****************************************************************************
 void MetaDataMap::write( Ogawa::OGroupPtr iParent )
 {
+    std::vector< Util::uint8_t > buf;
+    serialize( buf );
 
-    if ( m_map.empty() )
+    if ( buf.empty() )
     {
         iParent->addEmptyData();
         return;
     }
 
+    iParent->addData( buf.size(), ( const void * )&buf.front() );
+}
+
+//-*****************************************************************************
+void MetaDataMap::serialize( std::vector< Util::uint8_t > & oData ) const
+{
+    if ( m_map.empty() )
+    {
+        return;
+    }
+
     std::vector< std::string > mdVec;
     mdVec.resize( m_map.size() );
 
     // lets put each string into it's vector slot
-    std::map< std::string, Util::uint32_t >::iterator it, itEnd;
+    std::map< std::string, Util::uint32_t >::const_iterator it, itEnd;
     for ( it = m_map.begin(), itEnd = m_map.end(); it != itEnd; ++it )
     {
         mdVec[ it->second ] = it->first;
     }
 
     // now place it all into one continuous buffer
-    std::vector< Util::uint8_t > buf;
     std::vector< std::string >::iterator jt, jtEnd;
     for ( jt = mdVec.begin(), jtEnd = mdVec.end(); jt != jtEnd; ++jt )
     {
 
         // all these strings are less than 256 chars so just push back size
         // as 1 byte
-        buf.push_back( jt->size() );
-        buf.insert( buf.end(), jt->begin(), jt->end() );
+        oData.push_back( jt->size() );
+        oData.insert( oData.end(), jt->begin(), jt->end() );
     }
-
-    iParent->addData( buf.size(), ( const void * )&buf.front() );
 }
 
 } // End namespace ALEMBIC_VERSION_NS
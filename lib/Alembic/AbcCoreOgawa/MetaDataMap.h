@@ -56,6 +56,9 @@ public:
     // 0 will be returned if iStr is empty
     Util::uint32_t getIndex( const std::string & iStr );
     void write( Ogawa::OGroupPtr iParent );
+
+    // what write adds to iParent, empty if there is nothing in the map
+    void serialize( std::vector< Util::uint8_t > & oData ) const;
 private:
     std::map< std::string, Util::uint32_t > m_map;
 };
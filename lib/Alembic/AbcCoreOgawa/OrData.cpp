@@ -39,6 +39,7 @@
 #include <Alembic/AbcCoreOgawa/CprData.h>
 #include <Alembic/AbcCoreOgawa/CprImpl.h>
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -48,7 +49,7 @@ namespace ALEMBIC_VERSION_NS {
 OrData::OrData( Ogawa::IGroupPtr iGroup,
                 const std::string & iParentName,
                 std::size_t iThreadId,
-                AbcA::ArchiveReader & iArchive,
+                ArImpl & iArchive,
                 const std::vector< AbcA::MetaData > & iIndexedMetaData )
 {
     ABCA_ASSERT( iGroup, "Invalid object data group" );
@@ -60,8 +61,12 @@ OrData::OrData( Ogawa::IGroupPtr iGroup,
     if ( numChildren > 0 && m_group->isChildData( numChildren - 1 ) )
     {
         std::vector< ObjectHeaderPtr > headers;
-        ReadObjectHeaders( m_group, numChildren - 1, iThreadId,
-                           iParentName, iIndexedMetaData, headers );
+        if ( !iArchive.findHeaders( m_group->getPos(), headers ) )
+        {
+            ReadObjectHeaders( m_group, numChildren - 1, iThreadId,
+                               iParentName, iIndexedMetaData, headers );
+            iArchive.addHeaders( m_group->getPos(), headers );
+        }
 
         if ( !headers.empty() )
         {
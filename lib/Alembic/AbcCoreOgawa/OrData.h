@@ -44,6 +44,7 @@ namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
 class CprData;
+class ArImpl;
 
 // data class owned by OrImpl, or ArImpl if it is a "top" object.
 // it owns and makes child objects
@@ -54,7 +55,7 @@ public:
     OrData( Ogawa::IGroupPtr iGroup,
             const std::string & iParentName,
             size_t iThreadId,
-            AbcA::ArchiveReader & iArchive,
+            ArImpl & iArchive,
             const std::vector< AbcA::MetaData > & iIndexedMetaData );
 
     ~OrData();
@@ -39,6 +39,8 @@
 #include <Alembic/AbcCoreOgawa/OwData.h>
 #include <Alembic/AbcCoreOgawa/OwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 
 namespace Alembic {
@@ -55,6 +57,54 @@ OwData::OwData( Ogawa::OGroupPtr iGroup ) : m_group( iGroup )
         new CpwData( m_group->addGroup() ) );
 }
 
+//-*****************************************************************************
+OwData::OwData( Ogawa::OGroupPtr iGroup,
+                Ogawa::IGroupPtr iExisting,
+                const std::string & iFullName,
+                ArImpl & iArchive )
+    : m_group( iGroup )
+{
+    ABCA_ASSERT( m_group, "Invalid parent group" );
+    ABCA_ASSERT( iExisting, "Invalid existing group for: " << iFullName );
+
+    std::size_t numChildren = iExisting->getNumChildren();
+    ABCA_ASSERT( numChildren > 1 && iExisting->isChildGroup( 0 ) &&
+                 iExisting->isChildData( numChildren - 1 ),
+                 "Invalid existing object: " << iFullName );
+
+    m_existingProperties = iExisting->getGroup( 0, false, 0 );
+    ABCA_ASSERT( m_existingProperties,
+                 "Invalid existing properties for: " << iFullName );
+    m_group->addExistingGroup( m_existingProperties->getPos() );
+
+    Ogawa::IDataPtr data = iExisting->getData( numChildren - 1, 0 );
+    if ( data->getSize() >= 32 )
+    {
+        data->read( 16, m_existingDataHash.d, data->getSize() - 32, 0 );
+    }
+
+    std::vector< ObjectHeaderPtr > headers;
+    ReadObjectHeaders( iExisting, numChildren - 1, 0,
+                       iFullName == "/" ? "" : iFullName,
+                       iArchive.getIndexedMetaData(), headers );
+
+    for ( std::size_t i = 0; i < headers.size(); ++i )
+    {
+        Ogawa::IGroupPtr child = iExisting->getGroup( i + 1, false, 0 );
+        ABCA_ASSERT( child, "Invalid existing object: " <<
+                     headers[i]->getFullName() );
+        m_group->addExistingGroup( child->getPos() );
+
+        m_childHeaders.push_back( headers[i] );
+        m_existingChildren.push_back( child );
+
+        Util::uint64_t hash0, hash1;
+        HashExistingObject( child, *headers[i], iArchive, hash0, hash1 );
+        m_hashes.push_back( hash0 );
+        m_hashes.push_back( hash1 );
+    }
+}
+
 //-*****************************************************************************
 OwData::~OwData()
 {
@@ -65,6 +115,19 @@ AbcA::CompoundPropertyWriterPtr
 OwData::getProperties( AbcA::ObjectWriterPtr iParent )
 {
     AbcA::CompoundPropertyWriterPtr ret = m_top.lock();
+
+    // rewrite the existing properties now that they might change
+    if ( ! ret && ! m_data )
+    {
+        ArImpl * existing = Alembic::Util::dynamic_pointer_cast< AwImpl,
+            AbcA::ArchiveWriter >( iParent->getArchive() )->getExisting();
+        ABCA_ASSERT( existing, "Invalid existing archive" );
+
+        m_data = Alembic::Util::shared_ptr<CpwData>( new CpwData(
+            m_group->rewriteGroup( 0 ), m_existingProperties, *existing ) );
+        m_existingProperties.reset();
+    }
+
     if ( ! ret )
     {
         // time to make a new one
@@ -112,16 +175,32 @@ const AbcA::ObjectHeader * OwData::getChildHeader( const std::string &iName )
 }
 
 //-*****************************************************************************
-AbcA::ObjectWriterPtr OwData::getChild( const std::string &iName )
+AbcA::ObjectWriterPtr OwData::getChild( AbcA::ObjectWriterPtr iParent,
+                                        const std::string &iName )
 {
     MadeChildren::iterator fiter = m_madeChildren.find( iName );
-    if ( fiter == m_madeChildren.end() )
+    if ( fiter != m_madeChildren.end() )
     {
-        return AbcA::ObjectWriterPtr();
+        WeakOwPtr wptr = (*fiter).second;
+        return wptr.lock();
     }
 
-    WeakOwPtr wptr = (*fiter).second;
-    return wptr.lock();
+    // rewrite a child that was written before the archive was reopened
+    for ( size_t i = 0; i < m_existingChildren.size(); ++i )
+    {
+        if ( m_childHeaders[i]->getName() == iName )
+        {
+            Alembic::Util::shared_ptr<OwImpl> ret( new OwImpl( iParent,
+                m_group->rewriteGroup( i + 1 ), m_existingChildren[i],
+                m_childHeaders[i], i ) );
+
+            m_madeChildren[iName] = WeakOwPtr( ret );
+            m_existingChildren[i].reset();
+            return ret;
+        }
+    }
+
+    return AbcA::ObjectWriterPtr();
 }
 
 //-*****************************************************************************
@@ -131,7 +210,7 @@ AbcA::ObjectWriterPtr OwData::createChild( AbcA::ObjectWriterPtr iParent,
 {
     std::string name = iHeader.getName();
 
-    if ( m_madeChildren.count( name ) )
+    if ( m_madeChildren.count( name ) || getChildHeader( name ) )
     {
         ABCA_THROW( "Already have an Object named: "
                      << name );
@@ -177,19 +256,45 @@ void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
                            Util::SpookyHash & ioHash )
 {
     std::vector< Util::uint8_t > data;
+    packHeaders( iMetaDataMap, ioHash, data );
+
+    if ( !data.empty() )
+    {
+        m_group->addData( data.size(), &( data.front() ) );
+    }
 
+    if ( m_data )
+    {
+        m_data->writePropertyHeaders( iMetaDataMap );
+    }
+}
+
+//-*****************************************************************************
+void OwData::packHeaders( MetaDataMapPtr iMetaDataMap,
+                          Util::SpookyHash & ioHash,
+                          std::vector< Util::uint8_t > & oData )
+{
     // pack all object header into data here
     for ( size_t i = 0; i < m_childHeaders.size(); ++i )
     {
-        WriteObjectHeader( data, *m_childHeaders[i], iMetaDataMap );
+        WriteObjectHeader( oData, *m_childHeaders[i], iMetaDataMap );
     }
 
-    Util::SpookyHash dataHash;
-    dataHash.Init( 0, 0 );
-    m_data->computeHash( dataHash );
-
     Util::uint64_t hashes[4];
-    dataHash.Final( &hashes[0], &hashes[1] );
+
+    // the properties were never asked for so they are left as they were
+    if ( !m_data )
+    {
+        hashes[0] = m_existingDataHash.words[0];
+        hashes[1] = m_existingDataHash.words[1];
+    }
+    else
+    {
+        Util::SpookyHash dataHash;
+        dataHash.Init( 0, 0 );
+        m_data->computeHash( dataHash );
+        dataHash.Final( &hashes[0], &hashes[1] );
+    }
 
     ioHash.Init( 0, 0 );
 
@@ -208,21 +313,58 @@ void OwData::writeHeaders( MetaDataMapPtr iMetaDataMap,
     Util::uint8_t * hashData = ( Util::uint8_t * ) hashes;
     for ( size_t i = 0; i < 32; ++i )
     {
-        data.push_back( hashData[i] );
+        oData.push_back( hashData[i] );
     }
 
     // now update childHash with dataHash
     // SpookyHash has the nice property that Final doesn't invalidate the hash
     ioHash.Update( hashes, 16 );
+}
 
-    if ( !data.empty() )
+//-*****************************************************************************
+Util::uint64_t
+OwData::writeCheckpoint( MetaDataMapPtr iMetaDataMap,
+                         std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    // the properties, then the children, frozen ones are already in place
+    std::vector< Util::uint64_t > children = m_group->getChildPositions();
+
+    if ( m_data )
     {
-        m_group->addData( data.size(), &( data.front() ) );
+        children[0] = m_data->writeCheckpoint( iMetaDataMap, ioMaxSamples );
     }
 
-    m_data->writePropertyHeaders( iMetaDataMap );
+    for ( size_t i = 0; i < m_childHeaders.size(); ++i )
+    {
+        MadeChildren::iterator fiter =
+            m_madeChildren.find( m_childHeaders[i]->getName() );
+        if ( fiter == m_madeChildren.end() )
+        {
+            continue;
+        }
+
+        Alembic::Util::shared_ptr< OwImpl > child =
+            Alembic::Util::dynamic_pointer_cast< OwImpl, AbcA::ObjectWriter >(
+                fiter->second.lock() );
+        if ( child )
+        {
+            children[i + 1] = child->writeCheckpoint( iMetaDataMap,
+                                                      ioMaxSamples );
+        }
+    }
+
+    // the hashes of what is still being written aren't known yet, so they
+    // only hold once the archive is closed
+    Util::SpookyHash hash;
+    std::vector< Util::uint8_t > data;
+    packHeaders( iMetaDataMap, hash, data );
+    children.push_back( m_group->writeDetachedData(
+        data.size(), &( data.front() ) ) );
+
+    return m_group->writeDetachedGroup( children );
 }
 
+//-*****************************************************************************
 void OwData::fillHash( std::size_t iIndex, Util::uint64_t iHash0,
                        Util::uint64_t iHash1 )
 {
@@ -47,6 +47,7 @@ namespace ALEMBIC_VERSION_NS {
 //-*****************************************************************************
 // Forwards
 class CpwData;
+class ArImpl;
 
 // data class owned by OwImpl, or AwImpl if it is a "top" object.
 // it owns and makes child properties
@@ -55,6 +56,14 @@ class OwData : public Alembic::Util::enable_shared_from_this<OwData>
 public:
     OwData( Ogawa::OGroupPtr iGroup );
 
+    // Takes over iExisting, an object written before the archive was
+    // reopened for appending.  Its properties and children are referenced
+    // in place, and only rewritten when they are asked for.
+    OwData( Ogawa::OGroupPtr iGroup,
+            Ogawa::IGroupPtr iExisting,
+            const std::string & iFullName,
+            ArImpl & iArchive );
+
     ~OwData();
 
     AbcA::CompoundPropertyWriterPtr getProperties(
@@ -67,7 +76,8 @@ public:
     const AbcA::ObjectHeader *
     getChildHeader( const std::string &iName );
 
-    AbcA::ObjectWriterPtr getChild( const std::string &iName );
+    AbcA::ObjectWriterPtr getChild( AbcA::ObjectWriterPtr iParent,
+                                    const std::string &iName );
 
     AbcA::ObjectWriterPtr createChild( AbcA::ObjectWriterPtr iParent,
                                        const std::string & iFullName,
@@ -77,11 +87,22 @@ public:
 
     void writeHeaders( MetaDataMapPtr iMetaDataMap, Util::SpookyHash & ioHash );
 
+    // writes a copy of this object as it is now, with copies of the
+    // properties and children that are still being written, for
+    // AwImpl::checkpoint
+    Util::uint64_t writeCheckpoint(
+        MetaDataMapPtr iMetaDataMap,
+        std::vector< AbcA::index_t > & ioMaxSamples );
+
     void fillHash( std::size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
 private:
 
+    void packHeaders( MetaDataMapPtr iMetaDataMap,
+                      Util::SpookyHash & ioHash,
+                      std::vector< Util::uint8_t > & oData );
+
     // The group corresponding to the object
     Ogawa::OGroupPtr m_group;
 
@@ -99,6 +120,11 @@ private:
 
     // child hashes
     std::vector< Util::uint64_t > m_hashes;
+
+    // what was written before the archive was reopened for appending
+    std::vector< Ogawa::IGroupPtr > m_existingChildren;
+    Ogawa::IGroupPtr m_existingProperties;
+    Util::Digest m_existingDataHash;
 };
 
 typedef Alembic::Util::shared_ptr<OwData> OwDataPtr;
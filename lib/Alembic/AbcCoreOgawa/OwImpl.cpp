@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcCoreOgawa/OwImpl.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
 #include <Alembic/AbcCoreOgawa/CpwImpl.h>
 
 namespace Alembic {
@@ -73,6 +74,30 @@ OwImpl::OwImpl( AbcA::ObjectWriterPtr iParent,
     m_data.reset( new OwData( iGroup ) );
 }
 
+//-*****************************************************************************
+OwImpl::OwImpl( AbcA::ObjectWriterPtr iParent,
+                Ogawa::OGroupPtr iGroup,
+                Ogawa::IGroupPtr iExisting,
+                ObjectHeaderPtr iHeader,
+                size_t iIndex )
+  : m_parent( iParent )
+  , m_header( iHeader )
+  , m_index( iIndex )
+{
+    ABCA_ASSERT( m_parent, "Invalid parent" );
+    ABCA_ASSERT( m_header, "Invalid header" );
+
+    m_archive = m_parent->getArchive();
+    ABCA_ASSERT( m_archive, "Invalid archive" );
+
+    ArImpl * existing = Alembic::Util::dynamic_pointer_cast< AwImpl,
+        AbcA::ArchiveWriter >( m_archive )->getExisting();
+    ABCA_ASSERT( existing, "Invalid existing archive" );
+
+    m_data.reset( new OwData( iGroup, iExisting, m_header->getFullName(),
+                              *existing ) );
+}
+
 //-*****************************************************************************
 OwImpl::~OwImpl()
 {
@@ -150,7 +175,7 @@ const AbcA::ObjectHeader * OwImpl::getChildHeader( const std::string &iName )
 //-*****************************************************************************
 AbcA::ObjectWriterPtr OwImpl::getChild( const std::string &iName )
 {
-    return m_data->getChild( iName );
+    return m_data->getChild( asObjectPtr(), iName );
 }
 
 //-*****************************************************************************
@@ -172,6 +197,14 @@ void OwImpl::fillHash( size_t iIndex, Util::uint64_t iHash0,
     m_data->fillHash( iIndex, iHash0, iHash1 );
 }
 
+//-*****************************************************************************
+Util::uint64_t
+OwImpl::writeCheckpoint( MetaDataMapPtr iMetaDataMap,
+                         std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    return m_data->writeCheckpoint( iMetaDataMap, ioMaxSamples );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
@@ -61,6 +61,14 @@ public:
             ObjectHeaderPtr iHeader,
             size_t iIndex );
 
+    // rewrites iExisting, a child written before the archive was reopened
+    // for appending, into iGroup
+    OwImpl( AbcA::ObjectWriterPtr iParent,
+            Ogawa::OGroupPtr iGroup,
+            Ogawa::IGroupPtr iExisting,
+            ObjectHeaderPtr iHeader,
+            size_t iIndex );
+
     virtual ~OwImpl();
 
     //-*************************************************************************
@@ -92,6 +100,10 @@ public:
     void fillHash( size_t iIndex, Util::uint64_t iHash0,
                    Util::uint64_t iHash1 );
 
+    Util::uint64_t writeCheckpoint(
+        MetaDataMapPtr iMetaDataMap,
+        std::vector< AbcA::index_t > & ioMaxSamples );
+
 private:
     // The parent object, NULL if it is the "top" object
     AbcA::ObjectWriterPtr m_parent;
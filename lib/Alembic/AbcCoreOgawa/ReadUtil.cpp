@@ -35,6 +35,7 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <zstd.h>
@@ -200,6 +201,43 @@ ReadTDRDimensions( Ogawa::IDataPtr iDims,
     }
 }
 
+//-*****************************************************************************
+// Whether converting in place, which is done when reading scalar samples and
+// the larger type has to be written backwards so nothing is clobbered.
+inline bool Overlaps( const void * iFrom, std::size_t iFromSize,
+                      const void * iTo, std::size_t iToSize )
+{
+    const char * from = static_cast< const char * >( iFrom );
+    const char * to = static_cast< const char * >( iTo );
+    return ( to < from + iFromSize && from < to + iToSize );
+}
+
+//-*****************************************************************************
+// The loops over separate buffers are kept free of branches so that the
+// compiler can vectorize them.
+template < typename FROMPOD, typename TOPOD >
+void CastData( const FROMPOD * iFrom, TOPOD * oTo, std::size_t iNum )
+{
+    for ( std::size_t i = 0; i < iNum; ++i )
+    {
+        oTo[i] = static_cast< TOPOD >( iFrom[i] );
+    }
+}
+
+//-*****************************************************************************
+template < typename FROMPOD, typename TOPOD >
+void ClampAndCastData( const FROMPOD * iFrom, TOPOD * oTo, std::size_t iNum,
+                       FROMPOD iMin, FROMPOD iMax )
+{
+    for ( std::size_t i = 0; i < iNum; ++i )
+    {
+        FROMPOD f = iFrom[i];
+        f = ( f < iMin ) ? iMin : f;
+        f = ( f > iMax ) ? iMax : f;
+        oTo[i] = static_cast< TOPOD >( f );
+    }
+}
+
 //-*****************************************************************************
 template < typename FROMPOD >
 void ConvertToBool( char * fromBuffer, void * toBuffer, std::size_t iSize )
@@ -225,6 +263,15 @@ void ConvertFromBool( char * fromBuffer, void * toBuffer, std::size_t iSize )
 
     TOPOD * toPodBuffer = ( TOPOD * ) ( toBuffer );
 
+    if ( !Overlaps( fromBuffer, iSize, toBuffer, iSize * sizeof( TOPOD ) ) )
+    {
+        for ( std::size_t i = 0; i < iSize; ++i )
+        {
+            toPodBuffer[i] = static_cast< TOPOD >( fromBuffer[i] != 0 );
+        }
+        return;
+    }
+
     // do it backwards so we don't accidentally clobber over ourself
     for ( std::size_t i = iSize; i > 0; --i )
     {
@@ -295,20 +342,10 @@ void ConvertData( char * fromBuffer, void * toBuffer, std::size_t iSize )
             podMin = 0;
         }
 
-        for ( std::size_t i = 0; i < numConvert; ++i )
-        {
-            FROMPOD f = fromPodBuffer[i];
-            if ( f < podMin )
-            {
-                f = podMin;
-            }
-            else if ( f > podMax )
-            {
-                f = podMax;
-            }
-            TOPOD t = static_cast< TOPOD >( f );
-            toPodBuffer[i] = t;
-        }
+        // going forwards is fine in place, since what is written is behind
+        // what is read
+        ClampAndCastData( fromPodBuffer, toPodBuffer, numConvert,
+                          podMin, podMax );
     }
     else
     {
@@ -316,9 +353,12 @@ void ConvertData( char * fromBuffer, void * toBuffer, std::size_t iSize )
         TOPOD toPodMax = 0;
         getMinAndMax< TOPOD >( toPodMin, toPodMax);
 
-        FROMPOD podMin = 0;
-        FROMPOD podMax = 0;
-        getMinAndMax< FROMPOD >( podMin, podMax);
+        FROMPOD fromPodMin = 0;
+        FROMPOD fromPodMax = 0;
+        getMinAndMax< FROMPOD >( fromPodMin, fromPodMax );
+
+        FROMPOD podMin = fromPodMin;
+        FROMPOD podMax = fromPodMax;
 
         if ( podMin != 0 && toPodMin == 0 )
         {
@@ -332,6 +372,24 @@ void ConvertData( char * fromBuffer, void * toBuffer, std::size_t iSize )
             podMax = static_cast< FROMPOD >( toPodMax );
         }
 
+        // everything FROMPOD can hold fits, so just cast
+        bool clamp = ( podMin != fromPodMin || podMax != fromPodMax );
+
+        if ( !Overlaps( fromBuffer, iSize, toBuffer,
+                        numConvert * sizeof( TOPOD ) ) )
+        {
+            if ( clamp )
+            {
+                ClampAndCastData( fromPodBuffer, toPodBuffer, numConvert,
+                                  podMin, podMax );
+            }
+            else
+            {
+                CastData( fromPodBuffer, toPodBuffer, numConvert );
+            }
+            return;
+        }
+
         // do it backwards so we don't accidentally clobber over ourself
         for ( std::size_t i = numConvert; i > 0; --i )
         {
@@ -1418,7 +1476,8 @@ ReadData( void * iIntoLocation,
           Ogawa::IDataPtr iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
-          Util::PlainOldDataType iAsPod)
+          Util::PlainOldDataType iAsPod,
+          bool iCompressed )
 {
     Alembic::Util::PlainOldDataType curPod = iDataType.getPod();
     ABCA_ASSERT( ( iAsPod == curPod ) || (
@@ -1442,6 +1501,12 @@ ReadData( void * iIntoLocation,
         return;
     }
 
+    // skip the key, the samples of compressed properties have none
+    std::size_t offset = iCompressed ? 0 : 16;
+    ABCA_ASSERT( dataSize >= offset,
+        "Incorrect data, expected to be empty or to have a key and data");
+    dataSize -= offset;
+
     if ( curPod == Alembic::Util::kStringPOD )
     {
         if ( dataSize <= 0 )
@@ -1454,7 +1519,7 @@ ReadData( void * iIntoLocation,
 
         std::size_t numChars = dataSize;
         char * buf = new char[ numChars ];
-        iData->read( numChars, buf, 0, iThreadId );
+        iData->read( numChars, buf, offset, iThreadId );
 
         std::size_t startStr = 0;
         std::size_t strPos = 0;
@@ -1483,7 +1548,7 @@ ReadData( void * iIntoLocation,
 
         std::size_t numChars = ( dataSize - 0 ) / 4;
         Util::uint32_t * buf = new Util::uint32_t[ numChars ];
-        iData->read( dataSize, buf, 0, iThreadId );
+        iData->read( dataSize, buf, offset, iThreadId );
 
         std::size_t strPos = 0;
 
@@ -1506,15 +1571,13 @@ ReadData( void * iIntoLocation,
     }
     else if ( iAsPod == curPod )
     {
-        // don't read the key
-        iData->read( dataSize, iIntoLocation, 0, iThreadId );
+        iData->read( dataSize, iIntoLocation, offset, iThreadId );
     }
     else if ( PODNumBytes( curPod ) <= PODNumBytes( iAsPod ) )
     {
-        // - 16 to skip key
         std::size_t numBytes = dataSize;
 
-        iData->read( numBytes, iIntoLocation, 0, iThreadId );
+        iData->read( numBytes, iIntoLocation, offset, iThreadId );
 
         char * buf = static_cast< char * >( iIntoLocation );
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
@@ -1522,12 +1585,11 @@ ReadData( void * iIntoLocation,
     }
     else if ( PODNumBytes( curPod ) > PODNumBytes( iAsPod ) )
     {
-        // - 16 to skip key
         std::size_t numBytes = dataSize;
 
         // read into a temporary buffer and cast them one at a time
         char * buf = new char[ numBytes ];
-        iData->read( numBytes, buf, 0, iThreadId );
+        iData->read( numBytes, buf, offset, iThreadId );
 
         ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
 
@@ -1537,12 +1599,256 @@ ReadData( void * iIntoLocation,
 }
 
 //-*****************************************************************************
-void
-ReadArrayData( void * iIntoLocation,
-          Ogawa::IDataPtr iData,
-          size_t iThreadId,
-          const AbcA::DataType &iDataType,
-          Util::PlainOldDataType iAsPod)
+namespace
+{
+
+// Grows, but never shrinks, one of the scratch buffers of the calling thread.
+char * GetScratch( std::size_t iWhich, std::size_t iSize )
+{
+    static thread_local std::vector< char > scratch[2];
+
+    std::vector< char > & buf = scratch[iWhich];
+    if ( buf.size() < iSize )
+    {
+        buf.resize( iSize );
+    }
+
+    return buf.empty() ? NULL : &buf.front();
+}
+
+// Decompression contexts are big enough that creating one per sample, which
+// ZSTD_decompress does, shows up when reading many small samples.
+class DecompressionContext
+{
+public:
+    DecompressionContext() : m_context( ZSTD_createDCtx() ) {}
+    ~DecompressionContext() { ZSTD_freeDCtx( m_context ); }
+
+    ZSTD_DCtx * get() { return m_context; }
+
+private:
+    DecompressionContext( const DecompressionContext & );
+    DecompressionContext & operator=( const DecompressionContext & );
+
+    ZSTD_DCtx * m_context;
+};
+
+ZSTD_DCtx * GetDecompressionContext()
+{
+    static thread_local DecompressionContext context;
+    ABCA_ASSERT( context.get(), "Could not create a zstd context." );
+    return context.get();
+}
+
+// Converting is done a chunk at a time as the data is decompressed, or read,
+// so what is converted is still in cache.  A multiple of every POD size.
+const std::size_t CONVERT_CHUNK_SIZE = 64 * 1024;
+
+// Reads iNumBytes of array data, of iFromPod, into oBuffer as iToPod.
+void ConvertArrayData( void * oBuffer,
+                       Ogawa::IDataPtr iData,
+                       size_t iThreadId,
+                       bool iCompressed,
+                       std::size_t iNumBytes,
+                       Util::PlainOldDataType iFromPod,
+                       Util::PlainOldDataType iToPod )
+{
+    std::size_t fromPodBytes = PODNumBytes( iFromPod );
+    std::size_t toPodBytes = PODNumBytes( iToPod );
+    char * to = static_cast< char * >( oBuffer );
+    char * chunk = GetScratch( 0, CONVERT_CHUNK_SIZE );
+
+    if ( !iCompressed )
+    {
+        for ( std::size_t done = 0; done < iNumBytes;
+              done += CONVERT_CHUNK_SIZE )
+        {
+            std::size_t chunkSize =
+                std::min( CONVERT_CHUNK_SIZE, iNumBytes - done );
+            iData->read( chunkSize, chunk, 16 + done, iThreadId );
+            ConvertData( iFromPod, iToPod, chunk,
+                         to + ( done / fromPodBytes ) * toPodBytes,
+                         chunkSize );
+        }
+        return;
+    }
+
+    std::size_t compressedSize = iData->getSize() - 8;
+    char * compressedBuf = GetScratch( 1, compressedSize );
+    iData->read( compressedSize, compressedBuf, 8, iThreadId );
+
+    ZSTD_DCtx * context = GetDecompressionContext();
+    ZSTD_DCtx_reset( context, ZSTD_reset_session_only );
+
+    ZSTD_inBuffer in = { compressedBuf, compressedSize, 0 };
+
+    for ( std::size_t done = 0; done < iNumBytes;
+          done += CONVERT_CHUNK_SIZE )
+    {
+        ZSTD_outBuffer out = { chunk,
+            std::min( CONVERT_CHUNK_SIZE, iNumBytes - done ), 0 };
+
+        while ( out.pos < out.size )
+        {
+            std::size_t prevIn = in.pos;
+            std::size_t prevOut = out.pos;
+            std::size_t result = ZSTD_decompressStream( context, &out, &in );
+
+            ABCA_ASSERT( !ZSTD_isError( result ),
+                "Could not decompress the array data: " <<
+                ZSTD_getErrorName( result ) );
+
+            ABCA_ASSERT( out.pos == out.size || ( result != 0 &&
+                ( in.pos != prevIn || out.pos != prevOut ) ),
+                "Could not decompress the array data: unexpected size" );
+        }
+
+        ConvertData( iFromPod, iToPod, chunk,
+                     to + ( done / fromPodBytes ) * toPodBytes, out.size );
+    }
+}
+
+// Returns how many bytes of data iData decodes to, which is stored in front
+// of compressed data, and otherwise is what follows the key.
+std::size_t GetArrayDataSize( Ogawa::IDataPtr iData, size_t iThreadId,
+                              bool iCompressed )
+{
+    std::size_t dataSize = iData->getSize();
+    if ( dataSize == 0 )
+    {
+        return 0;
+    }
+
+    std::size_t numBytes = 0;
+    if ( iCompressed )
+    {
+        ABCA_ASSERT( dataSize >= 8,
+            "Incorrect data, expected to be empty or to have a size and a "
+            "zstd frame");
+
+        Util::uint64_t rawSize = 0;
+        iData->read( 8, &rawSize, 0, iThreadId );
+        numBytes = rawSize;
+    }
+    else
+    {
+        ABCA_ASSERT( dataSize >= 16,
+            "Incorrect data, expected to be empty or to have a key and data");
+        numBytes = dataSize - 16;
+    }
+
+    return numBytes;
+}
+
+// Reads the iNumBytes GetArrayDataSize returned into oRaw, decompressing
+// them if needed.
+void ReadArrayBytes( Ogawa::IDataPtr iData, size_t iThreadId,
+                     bool iCompressed, std::size_t iNumBytes, char * oRaw )
+{
+    if ( iNumBytes == 0 )
+    {
+        return;
+    }
+
+    if ( iCompressed )
+    {
+        std::size_t compressedSize = iData->getSize() - 8;
+        char * compressedBuf = GetScratch( 1, compressedSize );
+        iData->read( compressedSize, compressedBuf, 8, iThreadId );
+
+        std::size_t result = ZSTD_decompressDCtx( GetDecompressionContext(),
+            oRaw, iNumBytes, compressedBuf, compressedSize );
+        ABCA_ASSERT( !ZSTD_isError( result ) && result == iNumBytes,
+            "Could not decompress the array data: " <<
+            ( ZSTD_isError( result ) ? ZSTD_getErrorName( result ) :
+              "unexpected size" ) );
+    }
+    else
+    {
+        iData->read( iNumBytes, oRaw, 16, iThreadId );
+    }
+}
+
+}
+
+//-*****************************************************************************
+void GetArraySampleKey( const void * iBytes, std::size_t iSize,
+                        Util::PlainOldDataType iPod,
+                        bool iCompressed,
+                        AbcA::ArraySampleKey & oKey )
+{
+    oKey.numBytes = 0;
+    oKey.digest = Util::Digest();
+
+    const char * bytes = static_cast< const char * >( iBytes );
+
+    if ( iCompressed && iSize >= 8 )
+    {
+        // The leading size and the frame header are the same for many
+        // different samples, so all of the bytes are hashed.  The tag keeps
+        // them apart from the hash of uncompressed data.
+        Util::MurmurHash3 hash( 1 );
+        hash.Update( "zstd", 4 );
+        hash.Update( bytes, iSize );
+        hash.Final( oKey.digest.words );
+
+        Util::uint64_t rawSize = 0;
+        memcpy( &rawSize, bytes, 8 );
+        oKey.numBytes = rawSize;
+    }
+    else if ( !iCompressed && iSize >= 16 )
+    {
+        // the same hash ArraySample::getKey makes
+        std::size_t podSize = 1;
+        if ( iPod == Util::kWstringPOD )
+        {
+            podSize = 4;
+        }
+        else if ( iPod != Util::kStringPOD )
+        {
+            podSize = Util::PODNumBytes( iPod );
+        }
+
+        Util::MurmurHash3_x64_128( bytes + 16, iSize - 16, podSize,
+                                   oKey.digest.words );
+        oKey.numBytes = iSize - 16;
+    }
+}
+
+//-*****************************************************************************
+void ReadArraySampleKey( Ogawa::IDataPtr iData,
+                         size_t iThreadId,
+                         Util::PlainOldDataType iPod,
+                         bool iCompressed,
+                         AbcA::ArraySampleKey & oKey )
+{
+    oKey.numBytes = 0;
+    oKey.digest = Util::Digest();
+
+    std::size_t dataSize = iData->getSize();
+    if ( iCompressed )
+    {
+        char * bytes = GetScratch( 1, dataSize );
+        iData->read( dataSize, bytes, 0, iThreadId );
+        GetArraySampleKey( bytes, dataSize, iPod, true, oKey );
+    }
+    // the key was stored with the data
+    else if ( dataSize >= 16 )
+    {
+        oKey.numBytes = dataSize - 16;
+        iData->read( 16, oKey.digest.d, 0, iThreadId );
+    }
+}
+
+//-*****************************************************************************
+std::size_t
+ReadArrayDataInto( void * oBuffer,
+                   std::size_t iCapacity,
+                   Ogawa::IDataPtr iData,
+                   size_t iThreadId,
+                   const AbcA::DataType &iDataType,
+                   Util::PlainOldDataType iAsPod,
+                   bool iCompressed )
 {
     Alembic::Util::PlainOldDataType curPod = iDataType.getPod();
     ABCA_ASSERT( ( iAsPod == curPod ) || (
@@ -1552,134 +1858,174 @@ ReadArrayData( void * iIntoLocation,
         curPod != Alembic::Util::kWstringPOD ),
         "Cannot convert the data to or from a string, or wstring." );
 
-    if ( !iData )
+    ABCA_ASSERT( iData, "ReadArrayDataInto invalid: Null IDataPtr." );
+
+    if ( iData->getSize() == 0 )
     {
-        ABCA_THROW("ReadData invalid: Null IDataPtr.");
-        return;
+        return 0;
     }
 
-    std::size_t dataSize = iData->getSize();
+    std::size_t numBytes = GetArrayDataSize( iData, iThreadId, iCompressed );
+
+    bool isString = ( curPod == Alembic::Util::kStringPOD ||
+                      curPod == Alembic::Util::kWstringPOD );
 
-    if ( dataSize < 8 )
+    std::size_t curPodBytes = PODNumBytes( curPod );
+    std::size_t numPods = 0;
+
+    // how many strings there are isn't known until the data is decoded
+    if ( !isString )
     {
-        ABCA_ASSERT( dataSize == 0,
-            "Incorrect data, expected to be empty or to have a key and data");
-        return;
+        numPods = ( numBytes + curPodBytes - 1 ) / curPodBytes;
+        if ( !oBuffer || numPods > iCapacity )
+        {
+            return numPods;
+        }
     }
 
-    // the decompressed data size
-    std::size_t decompressedDataSize = 0;
-    iData->read(8, &decompressedDataSize, 0, 0);
+    if ( !isString && iAsPod != curPod )
+    {
+        ConvertArrayData( oBuffer, iData, iThreadId, iCompressed, numBytes,
+                          curPod, iAsPod );
+        return numPods;
+    }
+
+    // decompressed or read directly into oBuffer, unless it has to be
+    // parsed into strings
+    char * raw = isString ? GetScratch( 0, numBytes ) :
+        static_cast< char * >( oBuffer );
+    ReadArrayBytes( iData, iThreadId, iCompressed, numBytes, raw );
 
     if ( curPod == Alembic::Util::kStringPOD )
     {
-        if ( dataSize <= 8 )
+        for ( std::size_t i = 0; i < numBytes; ++i )
         {
-            return;
+            numPods += ( raw[i] == 0 );
         }
 
-        std::string * strPtr =
-            reinterpret_cast< std::string * > ( iIntoLocation );
-
-        std::size_t numChars = dataSize - 8;
-        char * buf = new char[ numChars ];
-        iData->read( numChars, buf, 8, iThreadId );
-
-        // decompress the zstd data
-        char * newBuf = new char[ decompressedDataSize ];
-        size_t result = ZSTD_decompress(newBuf, decompressedDataSize, buf, numChars);
+        if ( !oBuffer || numPods > iCapacity )
+        {
+            return numPods;
+        }
 
+        std::string * strPtr = static_cast< std::string * >( oBuffer );
         std::size_t startStr = 0;
         std::size_t strPos = 0;
 
-        for ( std::size_t i = 0; i < numChars; ++i )
+        for ( std::size_t i = 0; i < numBytes; ++i )
         {
-            if ( newBuf[i] == 0 )
+            if ( raw[i] == 0 )
             {
-                strPtr[strPos] = newBuf + startStr;
+                strPtr[strPos].assign( raw + startStr, i - startStr );
                 startStr = i + 1;
                 strPos ++;
             }
         }
-
-        delete [] buf;
-        delete [] newBuf;
     }
     else if ( curPod == Alembic::Util::kWstringPOD )
     {
-        if ( dataSize <= 8 )
+        std::size_t numChars = numBytes / 4;
+        const Util::uint32_t * chars =
+            reinterpret_cast< const Util::uint32_t * >( raw );
+
+        for ( std::size_t i = 0; i < numChars; ++i )
         {
-            return;
+            numPods += ( chars[i] == 0 );
         }
 
-        std::wstring * wstrPtr =
-            reinterpret_cast< std::wstring * > ( iIntoLocation );
-
-        std::size_t numChars = ( dataSize - 8 ) / 4;
-        Util::uint32_t * buf = new Util::uint32_t[ numChars ];
-        iData->read( dataSize - 8, buf, 8, iThreadId );
+        if ( !oBuffer || numPods > iCapacity )
+        {
+            return numPods;
+        }
 
-        // decompress the zstd data
-        Util::uint32_t * newBuf = new Util::uint32_t[ decompressedDataSize / 4 ];
-        size_t result = ZSTD_decompress(newBuf, decompressedDataSize / 4, buf, numChars);
+        std::wstring * wstrPtr = static_cast< std::wstring * >( oBuffer );
+        for ( std::size_t i = 0; i < numPods; ++i )
+        {
+            wstrPtr[i].clear();
+        }
 
         std::size_t strPos = 0;
-
-        // push these one at a time until we can figure out how to cast like
-        // strings above
-        for ( std::size_t i = 0; i < numChars; ++i )
+        for ( std::size_t i = 0; i < numChars && strPos < numPods; ++i )
         {
-            std::wstring & wstr = wstrPtr[strPos];
-            if ( newBuf[i] == 0 )
+            if ( chars[i] == 0 )
             {
                 strPos ++;
             }
             else
             {
-                wstr.push_back( newBuf[i] );
+                wstrPtr[strPos].push_back( chars[i] );
             }
         }
-
-        delete [] buf;
-        delete [] newBuf;
     }
-    else if ( iAsPod == curPod )
+    else if ( iAsPod != curPod )
     {
-        // don't read the key
-        char * buf = new char[ dataSize - 8 ];
-        iData->read( dataSize - 8, buf, 8, iThreadId );
-        size_t result = ZSTD_decompress(iIntoLocation, decompressedDataSize, buf, dataSize - 8);
-
-        delete [] buf;
+        ConvertData( curPod, iAsPod, raw, oBuffer, numBytes );
     }
-    else if ( PODNumBytes( curPod ) <= PODNumBytes( iAsPod ) )
-    {
-        std::size_t numBytes = dataSize - 8;
 
-        char * compressedBuf = new char[ numBytes ];
-        iData->read( numBytes, compressedBuf, 8, iThreadId );
-        size_t result = ZSTD_decompress(iIntoLocation, decompressedDataSize, compressedBuf, numBytes);
+    return numPods;
+}
 
-        char * buf = static_cast< char * >( iIntoLocation );
-        ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
+//-*****************************************************************************
+void
+ReadPackedStrings( Ogawa::IDataPtr iData,
+                   size_t iThreadId,
+                   bool iCompressed,
+                   Util::PackedStrings & oStrings )
+{
+    ABCA_ASSERT( iData, "ReadPackedStrings invalid: Null IDataPtr." );
 
-        delete [] compressedBuf;
-    }
-    else if ( PODNumBytes( curPod ) > PODNumBytes( iAsPod ) )
+    std::size_t numBytes = GetArrayDataSize( iData, iThreadId, iCompressed );
+
+    // the stored strings are already packed with a NULL after each one
+    std::vector< char > chars( numBytes );
+    if ( numBytes > 0 )
     {
-        std::size_t numBytes = dataSize - 8;
+        ReadArrayBytes( iData, iThreadId, iCompressed, numBytes, &chars[0] );
+    }
 
-        char * compressedBuf = new char[ numBytes ];
-        iData->read( numBytes, compressedBuf, 8, iThreadId );
+    oStrings.swapChars( chars );
+}
 
-        char * buf = new char[ decompressedDataSize ];
-        size_t result = ZSTD_decompress(buf, decompressedDataSize, compressedBuf, numBytes);
-        ConvertData( curPod, iAsPod, buf, iIntoLocation, numBytes );
+//-*****************************************************************************
+void
+ReadPackedStrings( Ogawa::IDataPtr iData,
+                   size_t iThreadId,
+                   bool iCompressed,
+                   Util::PackedWstrings & oStrings )
+{
+    ABCA_ASSERT( iData, "ReadPackedStrings invalid: Null IDataPtr." );
 
-        delete [] buf;
-        delete [] compressedBuf;
-    }
+    std::size_t numBytes = GetArrayDataSize( iData, iThreadId, iCompressed );
 
+    // stored as 32 bit characters, which wchar_t might not be
+    std::size_t numChars = numBytes / 4;
+    char * raw = GetScratch( 0, numBytes );
+    ReadArrayBytes( iData, iThreadId, iCompressed, numBytes, raw );
+
+    const Util::uint32_t * stored =
+        reinterpret_cast< const Util::uint32_t * >( raw );
+    std::vector< wchar_t > chars( stored, stored + numChars );
+
+    oStrings.swapChars( chars );
+}
+
+//-*****************************************************************************
+void
+ReadArrayDimensions( Ogawa::IDataPtr iDims,
+                     Ogawa::IDataPtr iData,
+                     size_t iThreadId,
+                     const AbcA::DataType &iDataType,
+                     bool iCompressed,
+                     Util::Dimensions & oDim )
+{
+    if ( iCompressed )
+    {
+        ReadTDRDimensions( iDims, iData, iThreadId, iDataType, oDim );
+    }
+    else
+    {
+        ReadDimensions( iDims, iData, iThreadId, iDataType, oDim );
+    }
 }
 
 //-*****************************************************************************
@@ -1688,16 +2034,29 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample )
+                 bool iCompressed,
+                 AbcA::ArraySamplePtr &oSample,
+                 AbcA::ArraySampleAllocatorPtr iAllocator )
 {
     // get our dimensions
     Util::Dimensions dims;
-    ReadTDRDimensions( iDims, iData, iThreadId, iDataType, dims );
+    ReadArrayDimensions( iDims, iData, iThreadId, iDataType, iCompressed,
+                         dims );
+
+    oSample = AbcA::AllocateArraySample( iDataType, dims, iAllocator );
+
+    std::size_t numPods = iDataType.getExtent() * dims.numPoints();
+    if ( numPods == 0 || iData->getSize() == 0 )
+    {
+        return;
+    }
 
-    oSample = AbcA::AllocateArraySample( iDataType, dims );
+    std::size_t numRead = ReadArrayDataInto(
+        const_cast<void*>( oSample->getData() ), numPods, iData, iThreadId,
+        iDataType, iDataType.getPod(), iCompressed );
 
-    ReadArrayData( const_cast<void*>( oSample->getData() ), iData,
-        iThreadId, iDataType, iDataType.getPod() );
+    ABCA_ASSERT( numRead <= numPods,
+        "Incorrect data, there is more of it than the dimensions allow" );
 }
 
 //-*****************************************************************************
@@ -1785,12 +2144,15 @@ ReadObjectHeaders( Ogawa::IGroupPtr iGroup,
     Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
     ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
 
-    std::vector< char > buf( data->getSize() );
-    if ( buf.empty() )
+    // the last 32 bytes are the data and children hashes, see
+    // OwData::writeHeaders
+    if ( data->getSize() <= 32 )
     {
         return;
     }
 
+    std::vector< char > buf( data->getSize() - 32 );
+
     std::size_t bufSize = buf.size();
     data->read( bufSize, &( buf.front() ), 0, iThreadId );
     std::size_t pos = 0;
@@ -1938,6 +2300,12 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Samples are stored in a BlobStore mask 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Samples are zstd compressed and stored without a key mask 0x20000000
+    // 0010 0000 0000 0000 0000 0000 0000 0000
 
     Ogawa::IDataPtr data = iGroup->getData( iIndex, iThreadId );
     ABCA_ASSERT( data, "ReadObjectHeaders Invalid data at index " << iIndex );
@@ -2011,6 +2379,10 @@ ReadPropertyHeaders( Ogawa::IGroupPtr iGroup,
 
             header->isHomogenous = ( info & 0x400 ) != 0;
 
+            header->isExternal = ( info & 0x10000000 ) != 0;
+
+            header->isCompressed = ( info & 0x20000000 ) != 0;
+
             header->nextSampleIndex = GetUint32WithHint( buf, bufSize, sizeHint, pos );
 
             if ( ( info & 0x0200 ) != 0 )
@@ -65,12 +65,82 @@ ReadTDRDimensions( Ogawa::IDataPtr iDims,
                 Util::Dimensions & oDim );
 
 //-*****************************************************************************
+// The dimensions of an array sample, from ReadDimensions, or from
+// ReadTDRDimensions if its property is compressed, see
+// PropertyHeaderAndFriends::isCompressed.
+void
+ReadArrayDimensions( Ogawa::IDataPtr iDims,
+                     Ogawa::IDataPtr iData,
+                     size_t iThreadId,
+                     const AbcA::DataType &iDataType,
+                     bool iCompressed,
+                     Util::Dimensions & oDim );
+
+//-*****************************************************************************
+// Reads a scalar sample, which is stored after its key unless its property
+// is compressed.
 void
 ReadData( void * iIntoLocation,
           Ogawa::IDataPtr iData,
           size_t iThreadId,
           const AbcA::DataType &iDataType,
-          Util::PlainOldDataType iAsPod);
+          Util::PlainOldDataType iAsPod,
+          bool iCompressed );
+
+//-*****************************************************************************
+// The key of the iSize stored bytes of an array sample.  Uncompressed, it is
+// the key ArraySample::getKey makes for the data that follows the stored
+// key, made again from it.  Compressed samples have no key stored, so all of
+// their bytes are hashed instead.
+void
+GetArraySampleKey( const void * iBytes,
+                   std::size_t iSize,
+                   Util::PlainOldDataType iPod,
+                   bool iCompressed,
+                   AbcA::ArraySampleKey & oKey );
+
+//-*****************************************************************************
+// Same as GetArraySampleKey for the stored data of an array sample, the key
+// stored with uncompressed data is read instead of being made again.
+void
+ReadArraySampleKey( Ogawa::IDataPtr iData,
+                    size_t iThreadId,
+                    Util::PlainOldDataType iPod,
+                    bool iCompressed,
+                    AbcA::ArraySampleKey & oKey );
+
+//-*****************************************************************************
+// Reads the data of an array sample into oBuffer as iAsPod, if it holds at
+// least as many PODs as the sample has, and returns how many it has.  For
+// strings and wstrings oBuffer is an array of std::string or std::wstring and
+// the count is the number of strings.  Passing a NULL oBuffer or a zero
+// iCapacity only queries the count.  iCompressed says whether the data is
+// zstd compressed or follows its key, and nothing is allocated apart from a
+// per thread scratch buffer that is reused.
+std::size_t
+ReadArrayDataInto( void * oBuffer,
+                   std::size_t iCapacity,
+                   Ogawa::IDataPtr iData,
+                   size_t iThreadId,
+                   const AbcA::DataType &iDataType,
+                   Util::PlainOldDataType iAsPod,
+                   bool iCompressed );
+
+//-*****************************************************************************
+// Reads the data of a string or wstring array sample into oStrings, which is
+// filled with one copy of the stored characters instead of parsing them into
+// separate strings.  iCompressed is the same as for ReadArrayDataInto.
+void
+ReadPackedStrings( Ogawa::IDataPtr iData,
+                   size_t iThreadId,
+                   bool iCompressed,
+                   Util::PackedStrings & oStrings );
+
+void
+ReadPackedStrings( Ogawa::IDataPtr iData,
+                   size_t iThreadId,
+                   bool iCompressed,
+                   Util::PackedWstrings & oStrings );
 
 //-*****************************************************************************
 void
@@ -78,7 +148,10 @@ ReadArraySample( Ogawa::IDataPtr iDims,
                  Ogawa::IDataPtr iData,
                  size_t iThreadId,
                  const AbcA::DataType &iDataType,
-                 AbcA::ArraySamplePtr &oSample );
+                 bool iCompressed,
+                 AbcA::ArraySamplePtr &oSample,
+                 AbcA::ArraySampleAllocatorPtr iAllocator =
+                     AbcA::ArraySampleAllocatorPtr() );
 
 //-*****************************************************************************
 void
@@ -45,9 +45,17 @@ namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
 WriteArchive::WriteArchive()
+    : m_minBlobBytes( 0 ), m_checkpointInterval( 0 )
 {
 }
 
+//-*****************************************************************************
+void WriteArchive::setBlobStore( BlobStorePtr iStore, std::size_t iMinBytes )
+{
+    m_blobStore = iStore;
+    m_minBlobBytes = iMinBytes;
+}
+
 //-*****************************************************************************
 AbcA::ArchiveWriterPtr
 WriteArchive::operator()( const std::string &iFileName,
@@ -55,6 +63,8 @@ WriteArchive::operator()( const std::string &iFileName,
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
         new AwImpl( iFileName, iMetaData ) );
+    archivePtr->setBlobStore( m_blobStore, m_minBlobBytes );
+    archivePtr->setCheckpointInterval( m_checkpointInterval );
     return archivePtr;
 }
 
@@ -65,6 +75,40 @@ WriteArchive::operator()( std::ostream * iStream,
 {
     Alembic::Util::shared_ptr<AwImpl> archivePtr(
         new AwImpl( iStream, iMetaData ) );
+    archivePtr->setBlobStore( m_blobStore, m_minBlobBytes );
+    archivePtr->setCheckpointInterval( m_checkpointInterval );
+    return archivePtr;
+}
+
+//-*****************************************************************************
+AppendArchive::AppendArchive()
+    : m_minBlobBytes( 4096 ), m_checkpointInterval( 0 )
+{
+}
+
+//-*****************************************************************************
+void AppendArchive::setBlobStore( BlobStorePtr iStore, std::size_t iMinBytes )
+{
+    m_blobStore = iStore;
+    m_minBlobBytes = iMinBytes;
+}
+
+//-*****************************************************************************
+AbcA::ArchiveWriterPtr
+AppendArchive::operator()( const std::string &iFileName,
+                           const AbcA::MetaData &iMetaData ) const
+{
+    // file streams instead of memory mapping since the file will grow
+    Alembic::Util::shared_ptr<ArImpl> existing =
+        Alembic::Util::dynamic_pointer_cast< ArImpl, AbcA::ArchiveReader >(
+            ReadArchive( 1, false )( iFileName ) );
+
+    Alembic::Util::shared_ptr<AwImpl> archivePtr(
+        new AwImpl( iFileName, iMetaData, existing ) );
+
+    BlobStorePtr store = m_blobStore ? m_blobStore : existing->getBlobStore();
+    archivePtr->setBlobStore( store, m_minBlobBytes );
+    archivePtr->setCheckpointInterval( m_checkpointInterval );
     return archivePtr;
 }
 
@@ -73,6 +117,8 @@ ReadArchive::ReadArchive()
 {
     m_numStreams = 1;
     m_useMMap = true;
+    m_openCheckpoints = false;
+    m_refreshable = false;
 }
 
 //-*****************************************************************************
@@ -80,11 +126,14 @@ ReadArchive::ReadArchive( size_t iNumStreams, bool iUseMMap )
 {
     m_numStreams = iNumStreams;
     m_useMMap = iUseMMap;
+    m_openCheckpoints = false;
+    m_refreshable = false;
 }
 
 //-*****************************************************************************
 ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
     : m_numStreams( 1 ), m_useMMap(true), m_streams( iStreams )
+    , m_openCheckpoints( false ), m_refreshable( false )
 {
 }
 
@@ -92,17 +141,25 @@ ReadArchive::ReadArchive( const std::vector< std::istream * > & iStreams )
 AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    Alembic::Util::shared_ptr<ArImpl> archivePtr;
 
     if ( m_streams.empty() )
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
-            new ArImpl( iFileName, m_numStreams, m_useMMap ) );
+            new ArImpl( iFileName, m_numStreams, m_useMMap,
+                        m_openCheckpoints || m_refreshable,
+                        m_refreshable ) );
     }
     else
     {
         archivePtr = Alembic::Util::shared_ptr<ArImpl>(
-            new ArImpl( m_streams ) );
+            new ArImpl( m_streams, m_openCheckpoints || m_refreshable,
+                        m_refreshable ) );
+    }
+
+    if ( m_blobStore )
+    {
+        archivePtr->setBlobStore( m_blobStore );
     }
     return archivePtr;
 }
@@ -113,19 +170,15 @@ AbcA::ArchiveReaderPtr
 ReadArchive::operator()( const std::string &iFileName,
             AbcA::ReadArraySampleCachePtr iCache ) const
 {
-    AbcA::ArchiveReaderPtr archivePtr;
+    return ( *this )( iFileName );
+}
 
-    if ( m_streams.empty() )
-    {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( iFileName, m_numStreams, m_useMMap ) );
-    }
-    else
-    {
-        archivePtr = Alembic::Util::shared_ptr<ArImpl> (
-            new ArImpl( m_streams ) );
-    }
-    return archivePtr;
+//-*****************************************************************************
+void WriteCheckpoint( AbcA::ArchiveWriterPtr iArchive )
+{
+    AwImpl * archive = dynamic_cast< AwImpl * >( iArchive.get() );
+    ABCA_ASSERT( archive, "Checkpoints can only be written to Ogawa archives" );
+    archive->checkpoint();
 }
 
 } // End namespace ALEMBIC_VERSION_NS
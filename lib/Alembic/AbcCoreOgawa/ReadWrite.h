@@ -38,6 +38,7 @@
 #define Alembic_AbcCoreOgawa_ReadWrite_h
 
 #include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/BlobStore.h>
 #include <Alembic/Util/Export.h>
 
 namespace Alembic {
@@ -58,6 +59,55 @@ public:
     ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
     operator()( std::ostream * iStream,
                 const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+    // Array properties whose first sample is at least iMinBytes keep their
+    // samples in iStore, and only refer to them from the archive.  The
+    // root of the store is recorded in the archive MetaData so readers
+    // can find it.
+    void setBlobStore( BlobStorePtr iStore, std::size_t iMinBytes = 4096 );
+
+    // Writes a checkpoint, see WriteCheckpoint, before setting a sample once
+    // at least iNumBytes have been written since the last one.  0, the
+    // default, only writes them when WriteCheckpoint is called.
+    void setCheckpointInterval( Alembic::Util::uint64_t iNumBytes )
+    { m_checkpointInterval = iNumBytes; }
+
+private:
+    BlobStorePtr m_blobStore;
+    std::size_t m_minBlobBytes;
+    Alembic::Util::uint64_t m_checkpointInterval;
+};
+
+//-*****************************************************************************
+//! Reopens an archive that WriteArchive finished writing, and returns a
+//! shared pointer to an archive writer that adds to it.  Existing objects and
+//! properties are found by name via getChild and getProperty, and samples set
+//! on existing properties carry on after the ones already there.  Only what
+//! is reopened, and the headers and tables above it, is rewritten at the end
+//! of the file, and new samples that match existing ones refer to them.  The
+//! old contents stay valid until the archive writer is destroyed.
+class ALEMBIC_EXPORT AppendArchive
+{
+public:
+    AppendArchive();
+
+    //! iMetaData is merged over the existing archive MetaData.
+    ::Alembic::AbcCoreAbstract::ArchiveWriterPtr
+    operator()( const std::string &iFileName,
+                const ::Alembic::AbcCoreAbstract::MetaData &iMetaData ) const;
+
+    // Same as WriteArchive::setBlobStore, if not set the store recorded in
+    // the archive MetaData is used.
+    void setBlobStore( BlobStorePtr iStore, std::size_t iMinBytes = 4096 );
+
+    // Same as WriteArchive::setCheckpointInterval
+    void setCheckpointInterval( Alembic::Util::uint64_t iNumBytes )
+    { m_checkpointInterval = iNumBytes; }
+
+private:
+    BlobStorePtr m_blobStore;
+    std::size_t m_minBlobBytes;
+    Alembic::Util::uint64_t m_checkpointInterval;
 };
 
 //-*****************************************************************************
@@ -77,6 +127,22 @@ public:
     // delete them
     ReadArchive( const std::vector< std::istream * > & iStreams );
 
+    // Where externally stored samples are read from, if not set the store
+    // recorded in the archive MetaData is used.
+    void setBlobStore( BlobStorePtr iStore ) { m_blobStore = iStore; }
+
+    // Open archives that weren't cleanly closed as of their last
+    // checkpoint, instead of refusing them.  This is how the frames of an
+    // archive that is still being written, or that crashed, are read.
+    void setOpenCheckpoints( bool iOpen ) { m_openCheckpoints = iOpen; }
+
+    // Read an archive while it is still being written, see
+    // AbcCoreAbstract::ArchiveReader::refresh.  It is opened as of its last
+    // checkpoint, and each refresh picks up the later ones.  The headers of
+    // unchanged objects and properties are kept between refreshes instead
+    // of being read again.
+    void setRefreshable( bool iRefreshable ) { m_refreshable = iRefreshable; }
+
     // open the file
     ::Alembic::AbcCoreAbstract::ArchiveReaderPtr
     operator()( const std::string &iFileName ) const;
@@ -91,8 +157,34 @@ private:
     size_t m_numStreams;
     bool m_useMMap;
     std::vector< std::istream * > m_streams;
+    BlobStorePtr m_blobStore;
+    bool m_openCheckpoints;
+    bool m_refreshable;
 };
 
+//-*****************************************************************************
+//! Makes everything iArchive has written so far readable, even if it is
+//! never cleanly closed.  The object and property headers, TimeSamplings,
+//! and indexed MetaData written so far are added at the end of the file,
+//! and the file header is pointed at them, see
+//! ReadArchive::setOpenCheckpoints.  Only the samples count, what Abc level
+//! schemas hold on to until they are destroyed, like computed bounds, only
+//! shows up once they are.  iArchive has to come from WriteArchive or
+//! AppendArchive.
+ALEMBIC_EXPORT void
+WriteCheckpoint( ::Alembic::AbcCoreAbstract::ArchiveWriterPtr iArchive );
+
+//-*****************************************************************************
+//! Fills oRaw with iSample stored the way the samples of compressed array
+//! properties are, the size of the data followed by a zstd frame of it at
+//! compression level iLevel, so ArrayPropertyWriter::setRawSample stores it
+//! as it is.  The first sample set on a property decides whether it is
+//! compressed, and later samples are compressed, or not, to match.
+ALEMBIC_EXPORT void
+CompressArraySample( const ::Alembic::AbcCoreAbstract::ArraySample & iSample,
+                     ::Alembic::AbcCoreAbstract::RawArraySample & oRaw,
+                     int iLevel = 3 );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -114,16 +114,19 @@ void SprImpl::getSample( index_t iSampleIndex, void * iIntoLocation )
     std::size_t numBytes = dt.getNumBytes();
 
     // Check to make sure the Ogawa data size matches our expected scalar
-    // property size, the + 16 is to account for the data key.
+    // property size, the + 16 is to account for the data key, which the
+    // samples of compressed properties don't have.
+    std::size_t keySize = m_header->isCompressed ? 0 : 16;
     if ( dt.getPod() < Util::kStringPOD && data &&
-        data->getSize() !=  numBytes )
+        data->getSize() != numBytes + keySize )
     {
         ABCA_THROW( "ScalarPropertyReader::getSample size is not correct "
                     "expected: " << numBytes << " got: " <<
-                    data->getSize() );
+                    data->getSize() - keySize );
     }
 
-    ReadData( iIntoLocation, data, id, dt, dt.getPod() );
+    ReadData( iIntoLocation, data, id, dt, dt.getPod(),
+              m_header->isCompressed );
 }
 
 //-*****************************************************************************
@@ -62,6 +62,38 @@ SpwImpl::SpwImpl( AbcA::CompoundPropertyWriterPtr iParent,
 }
 
 
+//-*****************************************************************************
+void SpwImpl::adoptSamples( Ogawa::IGroupPtr iExisting )
+{
+    std::vector< WrittenSampleIDPtr > samples;
+    std::vector< AbcA::Dimensions > dims;
+    ReadWrittenSamples( iExisting, m_group, m_header, samples, dims );
+    CopyExistingChildren( iExisting, m_group );
+
+    if ( !samples.empty() )
+    {
+        m_previousWrittenSampleID = samples.back();
+    }
+
+    m_hash = HashWrittenSamples( m_header, samples, dims );
+}
+
+//-*****************************************************************************
+Util::uint64_t
+SpwImpl::writeCheckpoint( std::vector< AbcA::index_t > & ioMaxSamples )
+{
+    Util::uint32_t numSamples = GetNumMaxSamples( m_header );
+    if ( m_header->timeSamplingIndex < ioMaxSamples.size() &&
+         ioMaxSamples[m_header->timeSamplingIndex] < numSamples )
+    {
+        ioMaxSamples[m_header->timeSamplingIndex] = numSamples;
+    }
+
+    // samples are written as soon as they are set, so these already agree
+    // with m_header which our parent writes out with its checkpoint
+    return m_group->writeDetachedGroup( m_group->getChildPositions() );
+}
+
 //-*****************************************************************************
 SpwImpl::~SpwImpl()
 {
@@ -70,13 +102,7 @@ SpwImpl::~SpwImpl()
     index_t maxSamples = archive->getMaxNumSamplesForTimeSamplingIndex(
             m_header->timeSamplingIndex );
 
-    Util::uint32_t numSamples = m_header->nextSampleIndex;
-
-    // a constant property, we wrote the same sample over and over
-    if ( m_header->lastChangedIndex == 0 && numSamples > 0 )
-    {
-        numSamples = 1;
-    }
+    Util::uint32_t numSamples = GetNumMaxSamples( m_header );
 
     if ( maxSamples < numSamples )
     {
@@ -136,6 +162,9 @@ void SpwImpl::setSample( const void *iSamp )
         "Can not write more samples than we have times for when using "
         "Acyclic sampling." );
 
+    // before anything changes, so the checkpoint only sees whole samples
+    CheckpointIfNeeded( getObject()->getArchive() );
+
     AbcA::ArraySample samp( iSamp, m_header->header.getDataType(),
                             AbcA::Dimensions(1) );
 
@@ -61,6 +61,15 @@ protected:
 
     AbcA::ScalarPropertyWriterPtr asScalarPtr();
 
+    // carries on from the samples in iExisting, which was written before
+    // the archive was reopened for appending
+    void adoptSamples( Ogawa::IGroupPtr iExisting );
+
+    // writes a copy of the group as it is now for AwImpl::checkpoint, and
+    // counts the samples so far towards ioMaxSamples
+    Util::uint64_t writeCheckpoint(
+        std::vector< AbcA::index_t > & ioMaxSamples );
+
 public:
     virtual ~SpwImpl();
 
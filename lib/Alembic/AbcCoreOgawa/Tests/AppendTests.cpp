@@ -0,0 +1,252 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+std::size_t fileSize( const std::string & iFileName )
+{
+    std::ifstream strm( iFileName.c_str(), std::ios_base::binary );
+    strm.seekg( 0, std::ios_base::end );
+    return ( std::size_t ) strm.tellg();
+}
+
+//-*****************************************************************************
+std::vector< int32_t > arraySample( std::size_t iIndex )
+{
+    // the 5th sample repeats the 1st one
+    std::vector< int32_t > samp( 1000, ( int32_t )( iIndex % 4 ) );
+    samp[0] = 7;
+    return samp;
+}
+
+//-*****************************************************************************
+double scalarSample( std::size_t iIndex )
+{
+    return iIndex < 4 ? 1.0 : 2.0;
+}
+
+//-*****************************************************************************
+void setSamples( ABCA::ArrayPropertyWriterPtr arrayProp,
+                 ABCA::ScalarPropertyWriterPtr scalarProp,
+                 std::size_t iStart, std::size_t iEnd )
+{
+    ABCA::DataType dtype( kInt32POD );
+    for ( std::size_t i = iStart; i < iEnd; ++i )
+    {
+        std::vector< int32_t > samp = arraySample( i );
+        arrayProp->setSample( ABCA::ArraySample( &samp.front(), dtype,
+            Dimensions( samp.size() ) ) );
+
+        double val = scalarSample( i );
+        scalarProp->setSample( &val );
+    }
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName, std::size_t iNumSamples )
+{
+    AO::WriteArchive w;
+    ABCA::MetaData md;
+    md.set( "first", "1" );
+    ABCA::ArchiveWriterPtr a = w( iArchiveName, md );
+    ABCA::ObjectWriterPtr top = a->getTop();
+
+    Alembic::Util::uint32_t tsIndex =
+        a->addTimeSampling( ABCA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+
+    ABCA::ObjectWriterPtr obj = top->createChild(
+        ABCA::ObjectHeader( "animated", ABCA::MetaData() ) );
+    ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+    ABCA::ArrayPropertyWriterPtr arrayProp = props->createArrayProperty(
+        "array", ABCA::MetaData(), ABCA::DataType( kInt32POD ), tsIndex );
+    ABCA::ScalarPropertyWriterPtr scalarProp = props->createScalarProperty(
+        "scalar", ABCA::MetaData(), ABCA::DataType( kFloat64POD ), tsIndex );
+
+    // a compound and a whole object that are never touched when appending
+    ABCA::CompoundPropertyWriterPtr compound = props->createCompoundProperty(
+        "compound", ABCA::MetaData() );
+    ABCA::ArrayPropertyWriterPtr other = compound->createArrayProperty(
+        "other", ABCA::MetaData(), ABCA::DataType( kInt32POD ), 0 );
+    std::vector< int32_t > samp = arraySample( 2 );
+    other->setSample( ABCA::ArraySample( &samp.front(),
+        ABCA::DataType( kInt32POD ), Dimensions( samp.size() ) ) );
+
+    ABCA::ObjectWriterPtr still = top->createChild(
+        ABCA::ObjectHeader( "still", ABCA::MetaData() ) );
+    ABCA::MetaData childMd;
+    childMd.set( "kind", "leaf" );
+    still->createChild( ABCA::ObjectHeader( "leaf", childMd ) );
+
+    setSamples( arrayProp, scalarProp, 0, iNumSamples );
+
+    // the full archive gets the new object right away
+    if ( iNumSamples == 5 )
+    {
+        top->createChild( ABCA::ObjectHeader( "added", ABCA::MetaData() ) );
+    }
+}
+
+//-*****************************************************************************
+void appendArchive( const std::string & iArchiveName )
+{
+    AO::AppendArchive w;
+    ABCA::MetaData md;
+    md.set( "second", "2" );
+    ABCA::ArchiveWriterPtr a = w( iArchiveName, md );
+    ABCA::ObjectWriterPtr top = a->getTop();
+
+    TESTING_ASSERT( top->getNumChildren() == 2 );
+    TESTING_ASSERT( top->getChildHeader( "still" ) != NULL );
+
+    ABCA::ObjectWriterPtr obj = top->getChild( "animated" );
+    TESTING_ASSERT( obj );
+    TESTING_ASSERT( obj->getProperties()->getNumProperties() == 3 );
+
+    ABCA::ArrayPropertyWriterPtr arrayProp =
+        obj->getProperties()->getProperty( "array" )->asArrayPtr();
+    TESTING_ASSERT( arrayProp->getNumSamples() == 3 );
+
+    ABCA::ScalarPropertyWriterPtr scalarProp =
+        obj->getProperties()->getProperty( "scalar" )->asScalarPtr();
+    TESTING_ASSERT( scalarProp->getNumSamples() == 3 );
+
+    setSamples( arrayProp, scalarProp, 3, 5 );
+
+    // existing names are still taken
+    TESTING_ASSERT_THROW( top->createChild(
+        ABCA::ObjectHeader( "still", ABCA::MetaData() ) ),
+        Alembic::Util::Exception );
+
+    top->createChild( ABCA::ObjectHeader( "added", ABCA::MetaData() ) );
+}
+
+//-*****************************************************************************
+void compareObjects( ABCA::ObjectReaderPtr iA, ABCA::ObjectReaderPtr iB )
+{
+    TESTING_ASSERT( iA->getName() == iB->getName() );
+    TESTING_ASSERT( iA->getNumChildren() == iB->getNumChildren() );
+
+    Digest a, b;
+    iA->getPropertiesHash( a );
+    iB->getPropertiesHash( b );
+    TESTING_ASSERT( a == b );
+
+    iA->getChildrenHash( a );
+    iB->getChildrenHash( b );
+    TESTING_ASSERT( a == b );
+
+    for ( std::size_t i = 0; i < iA->getNumChildren(); ++i )
+    {
+        compareObjects( iA->getChild( i ), iB->getChild( i ) );
+    }
+}
+
+//-*****************************************************************************
+void testAppend()
+{
+    writeArchive( "appendFull.abc", 5 );
+    writeArchive( "appendPartial.abc", 3 );
+
+    std::size_t partialSize = fileSize( "appendPartial.abc" );
+    appendArchive( "appendPartial.abc" );
+
+    // the 5th sample refers to the 1st instead of being written again, and
+    // the untouched data isn't rewritten
+    std::size_t appendedSize = fileSize( "appendPartial.abc" ) - partialSize;
+    TESTING_ASSERT( appendedSize < 4000 + 1000 );
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr full = r( "appendFull.abc" );
+    ABCA::ArchiveReaderPtr appended = r( "appendPartial.abc" );
+
+    TESTING_ASSERT( appended->getMetaData().get( "first" ) == "1" );
+    TESTING_ASSERT( appended->getMetaData().get( "second" ) == "2" );
+
+    TESTING_ASSERT( appended->getNumTimeSamplings() == 2 );
+    TESTING_ASSERT( appended->getMaxNumSamplesForTimeSamplingIndex( 1 ) == 5 );
+
+    // the same hashes as writing it all at once
+    compareObjects( full->getTop(), appended->getTop() );
+
+    ABCA::ObjectReaderPtr obj = appended->getTop()->getChild( "animated" );
+    ABCA::ArrayPropertyReaderPtr arrayProp =
+        obj->getProperties()->getArrayProperty( "array" );
+    ABCA::ScalarPropertyReaderPtr scalarProp =
+        obj->getProperties()->getScalarProperty( "scalar" );
+
+    TESTING_ASSERT( arrayProp->getNumSamples() == 5 );
+    TESTING_ASSERT( scalarProp->getNumSamples() == 5 );
+    TESTING_ASSERT( !scalarProp->isConstant() );
+
+    for ( std::size_t i = 0; i < 5; ++i )
+    {
+        std::vector< int32_t > samp = arraySample( i );
+        ABCA::ArraySample expected( &samp.front(), ABCA::DataType( kInt32POD ),
+                                    Dimensions( samp.size() ) );
+
+        ABCA::ArraySampleKey key;
+        TESTING_ASSERT( arrayProp->getKey( i, key ) );
+        TESTING_ASSERT( key.digest == expected.getKey().digest );
+    }
+
+    ABCA::ObjectReaderPtr leaf =
+        appended->getTop()->getChild( "still" )->getChild( "leaf" );
+    TESTING_ASSERT( leaf && leaf->getMetaData().get( "kind" ) == "leaf" );
+    TESTING_ASSERT( appended->getTop()->getChild( "added" ) );
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    testAppend();
+    return 0;
+}
@@ -40,6 +40,7 @@
 
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <cstring>
 #include <iostream>
 #include <vector>
 
@@ -2017,6 +2018,218 @@ void testBigData(bool iUseMMap)
     }
 }
 
+//-*****************************************************************************
+// Makes the raw sample of iVals stored as an 8 byte size and a zstd frame.
+void makeCompressedSample(const std::vector< Alembic::Util::int32_t > & iVals,
+                          ABCA::RawArraySample & oRaw)
+{
+    AO::CompressArraySample(ABCA::ArraySample(&iVals.front(),
+        ABCA::DataType(Alembic::Util::kInt32POD),
+        Alembic::Util::Dimensions(iVals.size())), oRaw);
+}
+
+//-*****************************************************************************
+void testRawCompressedSamples(bool iUseMMap)
+{
+    // Noise of the same size, so the leading size, the frame header and the
+    // header of the one uncompressed block are the same.
+    std::vector< Alembic::Util::int32_t > first(1000);
+    std::vector< Alembic::Util::int32_t > second(1000);
+    Alembic::Util::uint32_t seed = 1;
+    for (std::size_t i = 0; i < first.size(); ++i)
+    {
+        seed = seed * 1664525 + 1013904223;
+        first[i] = seed;
+        seed = seed * 1664525 + 1013904223;
+        second[i] = seed;
+    }
+
+    ABCA::RawArraySample rawFirst, rawSecond;
+    makeCompressedSample(first, rawFirst);
+    makeCompressedSample(second, rawSecond);
+    TESTING_ASSERT(memcmp(&rawFirst.data.front(), &rawSecond.data.front(),
+                          16) == 0);
+
+    ABCA::DataType dtype(Alembic::Util::kInt32POD);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w("rawCompressed.abc", ABCA::MetaData());
+        ABCA::ArrayPropertyWriterPtr prop =
+            a->getTop()->getProperties()->createArrayProperty("ints",
+                ABCA::MetaData(), dtype, 0);
+        TESTING_ASSERT(prop->setRawSample(rawFirst));
+        TESTING_ASSERT(prop->setRawSample(rawSecond));
+        TESTING_ASSERT(prop->setRawSample(rawFirst));
+    }
+
+    // copy them getRawSample to setRawSample, as AbcStitcher does
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r("rawCompressed.abc");
+        ABCA::ArrayPropertyReaderPtr prop =
+            a->getTop()->getProperties()->getArrayProperty("ints");
+        TESTING_ASSERT(prop->getNumSamples() == 3);
+        TESTING_ASSERT(!prop->isConstant());
+
+        ABCA::ArraySampleKey keys[3];
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            TESTING_ASSERT(prop->getKey(i, keys[i]));
+            TESTING_ASSERT(keys[i].numBytes == first.size() * 4);
+        }
+        TESTING_ASSERT(!(keys[0] == keys[1]));
+        TESTING_ASSERT(keys[0] == keys[2]);
+
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr b = w("rawCompressedCopy.abc",
+                                     ABCA::MetaData());
+        ABCA::ArrayPropertyWriterPtr copy =
+            b->getTop()->getProperties()->createArrayProperty("ints",
+                ABCA::MetaData(), dtype, 0);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            ABCA::RawArraySample raw;
+            TESTING_ASSERT(prop->getRawSample(i, raw));
+            TESTING_ASSERT(copy->setRawSample(raw));
+        }
+    }
+
+    {
+        AO::ReadArchive r(1, iUseMMap);
+        ABCA::ArchiveReaderPtr a = r("rawCompressedCopy.abc");
+        ABCA::ArrayPropertyReaderPtr prop =
+            a->getTop()->getProperties()->getArrayProperty("ints");
+        TESTING_ASSERT(prop->getNumSamples() == 3);
+
+        const std::vector< Alembic::Util::int32_t > * expected[3] = {
+            &first, &second, &first };
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            ABCA::ArraySamplePtr samp;
+            prop->getSample(i, samp);
+            TESTING_ASSERT(samp->size() == first.size());
+
+            const Alembic::Util::int32_t * data =
+                static_cast< const Alembic::Util::int32_t * >(
+                    samp->getData());
+            for (std::size_t j = 0; j < first.size(); ++j)
+            {
+                TESTING_ASSERT(data[j] == (*expected[i])[j]);
+            }
+        }
+    }
+}
+
+//-*****************************************************************************
+void testCompressedLayout(bool iUseMMap)
+{
+    std::vector< Alembic::Util::int32_t > first(100);
+    std::vector< Alembic::Util::int32_t > second(100);
+    for (std::size_t i = 0; i < first.size(); ++i)
+    {
+        first[i] = i;
+        second[i] = i * 3;
+    }
+
+    ABCA::DataType dtype(Alembic::Util::kInt32POD);
+    ABCA::ArraySample firstSamp(&first.front(), dtype,
+                                Alembic::Util::Dimensions(first.size()));
+    ABCA::ArraySample secondSamp(&second.front(), dtype,
+                                 Alembic::Util::Dimensions(second.size()));
+
+    ABCA::RawArraySample rawFirst;
+    AO::CompressArraySample(firstSamp, rawFirst);
+    TESTING_ASSERT(rawFirst.format == "OgawaZstd");
+
+    std::vector< std::string > strs(3);
+    strs[0] = "one";
+    strs[2] = "three";
+    ABCA::DataType sdtype(Alembic::Util::kStringPOD);
+    ABCA::ArraySample strSamp(&strs.front(), sdtype,
+                              Alembic::Util::Dimensions(strs.size()));
+    ABCA::RawArraySample rawStrs;
+    AO::CompressArraySample(strSamp, rawStrs);
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w("compressedLayout.abc",
+                                     ABCA::MetaData());
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        // the first sample makes it compressed, so the next one is too
+        ABCA::ArrayPropertyWriterPtr mixed = parent->createArrayProperty(
+            "mixed", ABCA::MetaData(), dtype, 0);
+        TESTING_ASSERT(mixed->setRawSample(rawFirst));
+        mixed->setSample(secondSamp);
+
+        // and the other way around
+        ABCA::ArrayPropertyWriterPtr keyed = parent->createArrayProperty(
+            "keyed", ABCA::MetaData(), dtype, 0);
+        keyed->setSample(secondSamp);
+        TESTING_ASSERT(!keyed->setRawSample(rawFirst));
+        keyed->setSample(firstSamp);
+
+        ABCA::ArrayPropertyWriterPtr strProp = parent->createArrayProperty(
+            "strs", ABCA::MetaData(), sdtype, 0);
+        TESTING_ASSERT(strProp->setRawSample(rawStrs));
+        strProp->setSample(strSamp);
+    }
+
+    AO::ReadArchive r(1, iUseMMap);
+    ABCA::ArchiveReaderPtr a = r("compressedLayout.abc");
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+    ABCA::ArrayPropertyReaderPtr mixed = parent->getArrayProperty("mixed");
+    ABCA::ArrayPropertyReaderPtr keyed = parent->getArrayProperty("keyed");
+    const std::vector< Alembic::Util::int32_t > * mixedVals[2] = {
+        &first, &second };
+    const std::vector< Alembic::Util::int32_t > * keyedVals[2] = {
+        &second, &first };
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        ABCA::RawArraySample raw;
+        TESTING_ASSERT(mixed->getRawSample(i, raw));
+        TESTING_ASSERT(raw.format == "OgawaZstd");
+        TESTING_ASSERT(keyed->getRawSample(i, raw));
+        TESTING_ASSERT(raw.format == "Ogawa");
+
+        ABCA::ArraySamplePtr mixedSamp, keyedSamp;
+        mixed->getSample(i, mixedSamp);
+        keyed->getSample(i, keyedSamp);
+        TESTING_ASSERT(mixedSamp->size() == first.size());
+        TESTING_ASSERT(keyedSamp->size() == first.size());
+
+        const Alembic::Util::int32_t * mixedData =
+            static_cast< const Alembic::Util::int32_t * >(
+                mixedSamp->getData());
+        const Alembic::Util::int32_t * keyedData =
+            static_cast< const Alembic::Util::int32_t * >(
+                keyedSamp->getData());
+        for (std::size_t j = 0; j < first.size(); ++j)
+        {
+            TESTING_ASSERT(mixedData[j] == (*mixedVals[i])[j]);
+            TESTING_ASSERT(keyedData[j] == (*keyedVals[i])[j]);
+        }
+    }
+
+    // the same strings, compressed the same way, are one sample
+    ABCA::ArrayPropertyReaderPtr strProp = parent->getArrayProperty("strs");
+    TESTING_ASSERT(strProp->getNumSamples() == 2);
+    TESTING_ASSERT(strProp->isConstant());
+
+    ABCA::ArraySamplePtr strsRead;
+    strProp->getSample(1, strsRead);
+    TESTING_ASSERT(strsRead->size() == 3);
+    const std::string * strData =
+        static_cast< const std::string * >(strsRead->getData());
+    TESTING_ASSERT(strData[0] == "one" && strData[1].empty() &&
+                   strData[2] == "three");
+}
+
 void runTests(bool iUseMMap)
 {
     testEmptyArray(iUseMMap);
@@ -2025,6 +2238,8 @@ void runTests(bool iUseMMap)
     testExtentArrayStrings(iUseMMap);
     testArrayStringsRepeats(iUseMMap);
     testArraySamples(iUseMMap);
+    testRawCompressedSamples(iUseMMap);
+    testCompressedLayout(iUseMMap);
 
     if (!iUseMMap)
     {
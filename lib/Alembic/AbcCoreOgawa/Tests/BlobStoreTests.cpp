@@ -0,0 +1,301 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <zstd.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+std::size_t fileSize( const std::string & iFileName )
+{
+    std::ifstream strm( iFileName.c_str(), std::ios_base::binary );
+    strm.seekg( 0, std::ios_base::end );
+    return ( std::size_t ) strm.tellg();
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName,
+                   AO::BlobStorePtr iStore,
+                   const std::vector< std::vector< int32_t > > & iSamples )
+{
+    AO::WriteArchive w;
+    w.setBlobStore( iStore, 64 );
+    ABCA::ArchiveWriterPtr a = w( iArchiveName, ABCA::MetaData() );
+    ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+    ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+
+    ABCA::ArrayPropertyWriterPtr big = parent->createArrayProperty( "big",
+        ABCA::MetaData(), i32d, 0 );
+
+    for ( std::size_t i = 0; i < iSamples.size(); ++i )
+    {
+        big->setSample( ABCA::ArraySample( &( iSamples[i].front() ), i32d,
+            Alembic::Util::Dimensions( iSamples[i].size() ) ) );
+    }
+
+    // too small to be worth a blob
+    ABCA::ArrayPropertyWriterPtr small = parent->createArrayProperty(
+        "small", ABCA::MetaData(), i32d, 0 );
+    small->setSample( ABCA::ArraySample( &( iSamples[0].front() ), i32d,
+        Alembic::Util::Dimensions( 3 ) ) );
+}
+
+//-*****************************************************************************
+void readArchive( ABCA::ArchiveReaderPtr iArchive,
+                  AO::BlobStorePtr iStore,
+                  const std::vector< std::vector< int32_t > > & iSamples )
+{
+    ABCA::CompoundPropertyReaderPtr parent =
+        iArchive->getTop()->getProperties();
+    TESTING_ASSERT( parent->getNumProperties() == 2 );
+
+    ABCA::ArrayPropertyReaderPtr big = parent->getArrayProperty( "big" );
+    TESTING_ASSERT( big->getNumSamples() == iSamples.size() );
+
+    for ( std::size_t i = 0; i < iSamples.size(); ++i )
+    {
+        ABCA::ArraySamplePtr samp;
+        big->getSample( i, samp );
+        TESTING_ASSERT( samp->size() == iSamples[i].size() );
+
+        const int32_t * data = static_cast< const int32_t * >(
+            samp->getData() );
+        for ( std::size_t j = 0; j < iSamples[i].size(); ++j )
+        {
+            TESTING_ASSERT( data[j] == iSamples[i][j] );
+        }
+
+        ABCA::ArraySampleKey key;
+        TESTING_ASSERT( big->getKey( i, key ) );
+        TESTING_ASSERT( key.numBytes == iSamples[i].size() * 4 );
+        TESTING_ASSERT( iStore->has( key.digest ) );
+
+        // raw samples hand over the resolved data
+        ABCA::RawArraySample raw;
+        TESTING_ASSERT( big->getRawSample( i, raw ) );
+        TESTING_ASSERT( raw.data.size() == 16 + key.numBytes );
+    }
+
+    ABCA::ArrayPropertyReaderPtr small = parent->getArrayProperty( "small" );
+    ABCA::ArraySampleKey key;
+    TESTING_ASSERT( small->getKey( 0, key ) );
+    TESTING_ASSERT( !iStore->has( key.digest ) );
+
+    ABCA::ArraySamplePtr samp;
+    small->getSample( 0, samp );
+    TESTING_ASSERT( samp->size() == 3 );
+    TESTING_ASSERT( static_cast< const int32_t * >(
+        samp->getData() )[2] == iSamples[0][2] );
+}
+
+//-*****************************************************************************
+void testBlobStore()
+{
+    AO::BlobStorePtr store( new AO::BlobStore( "blobStoreTest" ) );
+
+    std::vector< std::vector< int32_t > > samples( 3 );
+    for ( std::size_t i = 0; i < 1000; ++i )
+    {
+        samples[0].push_back( i );
+        samples[1].push_back( i );
+        samples[2].push_back( i * 2 );
+    }
+
+    writeArchive( "blobStore1.abc", store, samples );
+
+    // shares everything with the first one
+    std::vector< std::vector< int32_t > > samples2( 1, samples[2] );
+    writeArchive( "blobStore2.abc", store, samples2 );
+
+    // only the reference to the big sample is in the archive
+    TESTING_ASSERT( fileSize( "blobStore2.abc" ) < samples[2].size() * 4 );
+
+    // blobs are named by the digest of the sample
+    ABCA::ArraySampleKey key = ABCA::ArraySample( &( samples[2].front() ),
+        ABCA::DataType( Alembic::Util::kInt32POD, 1 ),
+        Alembic::Util::Dimensions( samples[2].size() ) ).getKey();
+    TESTING_ASSERT( store->has( key.digest ) );
+
+    // found via the archive MetaData
+    {
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r( "blobStore1.abc" );
+        TESTING_ASSERT( a->getMetaData().get( "_ai_BlobStore" ) ==
+                        "blobStoreTest" );
+        readArchive( a, store, samples );
+    }
+
+    // given explicitly, with nothing cached
+    {
+        AO::BlobStorePtr store2( new AO::BlobStore( "blobStoreTest", 0 ) );
+        AO::ReadArchive r;
+        r.setBlobStore( store2 );
+        readArchive( r( "blobStore2.abc" ), store2, samples2 );
+    }
+
+    // archives without a store are unaffected
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w( "blobStore3.abc", ABCA::MetaData() );
+    }
+
+    {
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr a = r( "blobStore3.abc" );
+        TESTING_ASSERT( a->getMetaData().get( "_ai_BlobStore" ).empty() );
+    }
+}
+
+//-*****************************************************************************
+// [8-byte uncompressed size][zstd frame], keyed by its leading bytes the way
+// older writers handed raw samples around
+void makeCompressedSample( const std::vector< int32_t > & iVals,
+                           ABCA::RawArraySample & oRaw )
+{
+    std::size_t rawSize = iVals.size() * 4;
+    std::vector< char > compressed( ZSTD_compressBound( rawSize ) );
+    std::size_t compressedSize = ZSTD_compress( &compressed.front(),
+        compressed.size(), &iVals.front(), rawSize, 3 );
+    TESTING_ASSERT( !ZSTD_isError( compressedSize ) );
+
+    uint64_t size = rawSize;
+    oRaw.format = "OgawaZstd";
+    oRaw.data.resize( 8 + compressedSize );
+    memcpy( &oRaw.data.front(), &size, 8 );
+    memcpy( &oRaw.data.front() + 8, &compressed.front(), compressedSize );
+    oRaw.dims = Alembic::Util::Dimensions( iVals.size() );
+
+    oRaw.key.origPOD = Alembic::Util::kInt32POD;
+    oRaw.key.readPOD = Alembic::Util::kInt32POD;
+    oRaw.key.numBytes = rawSize;
+    memcpy( oRaw.key.digest.d, &oRaw.data.front(), 16 );
+}
+
+//-*****************************************************************************
+void writeRawArchive( const std::string & iArchiveName,
+                      AO::BlobStorePtr iStore,
+                      const ABCA::RawArraySample & iRaw )
+{
+    AO::WriteArchive w;
+    w.setBlobStore( iStore, 64 );
+    ABCA::ArchiveWriterPtr a = w( iArchiveName, ABCA::MetaData() );
+    ABCA::ArrayPropertyWriterPtr prop =
+        a->getTop()->getProperties()->createArrayProperty( "raw",
+            ABCA::MetaData(), ABCA::DataType( Alembic::Util::kInt32POD ), 0 );
+    TESTING_ASSERT( prop->setRawSample( iRaw ) );
+}
+
+//-*****************************************************************************
+void readRawArchive( const std::string & iArchiveName,
+                     AO::BlobStorePtr iStore,
+                     const std::vector< int32_t > & iVals,
+                     ABCA::ArraySampleKey & oKey )
+{
+    AO::ReadArchive r;
+    r.setBlobStore( iStore );
+    ABCA::ArchiveReaderPtr a = r( iArchiveName );
+    ABCA::ArrayPropertyReaderPtr prop =
+        a->getTop()->getProperties()->getArrayProperty( "raw" );
+
+    ABCA::ArraySamplePtr samp;
+    prop->getSample( 0, samp );
+    TESTING_ASSERT( samp->size() == iVals.size() );
+    TESTING_ASSERT( memcmp( samp->getData(), &iVals.front(),
+                            iVals.size() * 4 ) == 0 );
+
+    TESTING_ASSERT( prop->getKey( 0, oKey ) );
+    TESTING_ASSERT( iStore->has( oKey.digest ) );
+}
+
+//-*****************************************************************************
+void testRawBlobs()
+{
+    AO::BlobStorePtr store( new AO::BlobStore( "rawBlobStoreTest", 0 ) );
+
+    // Noise of the same size, so the stored bytes start the same way.
+    std::vector< int32_t > first( 1000 );
+    std::vector< int32_t > second( 1000 );
+    uint32_t seed = 7;
+    for ( std::size_t i = 0; i < first.size(); ++i )
+    {
+        seed = seed * 1664525 + 1013904223;
+        first[i] = seed;
+        seed = seed * 1664525 + 1013904223;
+        second[i] = seed;
+    }
+
+    ABCA::RawArraySample rawFirst, rawSecond;
+    makeCompressedSample( first, rawFirst );
+    makeCompressedSample( second, rawSecond );
+    TESTING_ASSERT( rawFirst.key == rawSecond.key );
+
+    // different archives, so only the blob name can tell them apart
+    writeRawArchive( "rawBlobStore1.abc", store, rawFirst );
+    writeRawArchive( "rawBlobStore2.abc", store, rawSecond );
+
+    ABCA::ArraySampleKey firstKey, secondKey;
+    readRawArchive( "rawBlobStore1.abc", store, first, firstKey );
+    readRawArchive( "rawBlobStore2.abc", store, second, secondKey );
+    TESTING_ASSERT( !( firstKey.digest == secondKey.digest ) );
+
+    // never named by the key that was handed in
+    TESTING_ASSERT( !store->has( rawFirst.key.digest ) );
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    testBlobStore();
+    testRawBlobs();
+    return 0;
+}
@@ -0,0 +1,241 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+// what a crash would leave behind, since nothing is buffered
+void copyFile( const std::string & iFrom, const std::string & iTo )
+{
+    std::ifstream src( iFrom.c_str(), std::ios_base::binary );
+    std::ofstream dst( iTo.c_str(),
+                       std::ios_base::binary | std::ios_base::trunc );
+    dst << src.rdbuf();
+}
+
+//-*****************************************************************************
+ABCA::ArchiveReaderPtr openCheckpoint( const std::string & iName )
+{
+    AO::ReadArchive r;
+    r.setOpenCheckpoints( true );
+    return r( iName );
+}
+
+//-*****************************************************************************
+void checkSamples( ABCA::ArchiveReaderPtr iArchive, std::size_t iNumSamples )
+{
+    ABCA::ObjectReaderPtr obj = iArchive->getTop()->getChild( "animated" );
+    TESTING_ASSERT( obj );
+
+    ABCA::ScalarPropertyReaderPtr scalarProp =
+        obj->getProperties()->getScalarProperty( "scalar" );
+    ABCA::ArrayPropertyReaderPtr arrayProp =
+        obj->getProperties()->getArrayProperty( "array" );
+
+    TESTING_ASSERT( scalarProp->getNumSamples() == iNumSamples );
+    TESTING_ASSERT( arrayProp->getNumSamples() == iNumSamples );
+    TESTING_ASSERT( iArchive->getMaxNumSamplesForTimeSamplingIndex( 1 ) ==
+                    ( ABCA::index_t ) iNumSamples );
+
+    TESTING_ASSERT( !scalarProp->isConstant() );
+
+    for ( std::size_t i = 0; i < iNumSamples; ++i )
+    {
+        ABCA::ArraySampleKey key;
+        TESTING_ASSERT( arrayProp->getKey( i, key ) );
+        TESTING_ASSERT( key.numBytes == 4 * ( i + 1 ) );
+    }
+}
+
+//-*****************************************************************************
+void setSample( ABCA::ScalarPropertyWriterPtr iScalar,
+                ABCA::ArrayPropertyWriterPtr iArray, std::size_t iIndex )
+{
+    double val = ( double ) iIndex;
+    iScalar->setSample( &val );
+
+    std::vector< int32_t > samp( iIndex + 1, ( int32_t ) iIndex );
+    iArray->setSample( ABCA::ArraySample( &samp.front(),
+        ABCA::DataType( kInt32POD ), Dimensions( samp.size() ) ) );
+}
+
+//-*****************************************************************************
+void testCheckpoints()
+{
+    std::string archiveName = "checkpoint.abc";
+    std::string crashName = "checkpointCrash.abc";
+
+    {
+        AO::WriteArchive w;
+        ABCA::MetaData md;
+        md.set( "name", "checkpoint" );
+        ABCA::ArchiveWriterPtr a = w( archiveName, md );
+        ABCA::ObjectWriterPtr top = a->getTop();
+
+        Alembic::Util::uint32_t tsIndex =
+            a->addTimeSampling( ABCA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+
+        // one object that is done before any checkpoint
+        {
+            ABCA::MetaData childMd;
+            childMd.set( "kind", "done" );
+            top->createChild( ABCA::ObjectHeader( "done", childMd ) );
+        }
+
+        ABCA::ObjectWriterPtr obj = top->createChild(
+            ABCA::ObjectHeader( "animated", ABCA::MetaData() ) );
+        ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+        ABCA::ScalarPropertyWriterPtr scalarProp =
+            props->createScalarProperty( "scalar", ABCA::MetaData(),
+                ABCA::DataType( kFloat64POD ), tsIndex );
+        ABCA::ArrayPropertyWriterPtr arrayProp =
+            props->createArrayProperty( "array", ABCA::MetaData(),
+                ABCA::DataType( kInt32POD ), tsIndex );
+
+        // not checkpointed yet, so there is nothing to open
+        TESTING_ASSERT_THROW( openCheckpoint( archiveName ),
+                              Alembic::Util::Exception );
+
+        for ( std::size_t i = 0; i < 3; ++i )
+        {
+            setSample( scalarProp, arrayProp, i );
+        }
+
+        AO::WriteCheckpoint( a );
+
+        // only readable as a checkpoint while it is still being written
+        {
+            AO::ReadArchive r;
+            TESTING_ASSERT_THROW( r( archiveName ),
+                                  Alembic::Util::Exception );
+        }
+
+        {
+            ABCA::ArchiveReaderPtr ar = openCheckpoint( archiveName );
+            TESTING_ASSERT( ar->getMetaData().get( "name" ) == "checkpoint" );
+            TESTING_ASSERT( ar->getNumTimeSamplings() == 2 );
+            TESTING_ASSERT( ar->getTop()->getNumChildren() == 2 );
+            TESTING_ASSERT( ar->getTop()->getChildHeader( "done" )->
+                            getMetaData().get( "kind" ) == "done" );
+            checkSamples( ar, 3 );
+        }
+
+        for ( std::size_t i = 3; i < 5; ++i )
+        {
+            setSample( scalarProp, arrayProp, i );
+        }
+
+        AO::WriteCheckpoint( a );
+
+        // a sample that no checkpoint has, and then the "crash"
+        setSample( scalarProp, arrayProp, 5 );
+        copyFile( archiveName, crashName );
+
+        checkSamples( openCheckpoint( archiveName ), 5 );
+    }
+
+    // cleanly closed now, so it is read as usual
+    {
+        AO::ReadArchive r;
+        checkSamples( r( archiveName ), 6 );
+    }
+
+    // the crash keeps what the last checkpoint had
+    {
+        AO::ReadArchive r;
+        TESTING_ASSERT_THROW( r( crashName ), Alembic::Util::Exception );
+        checkSamples( openCheckpoint( crashName ), 5 );
+    }
+}
+
+//-*****************************************************************************
+void testCheckpointInterval()
+{
+    std::string archiveName = "checkpointInterval.abc";
+
+    AO::WriteArchive w;
+    w.setCheckpointInterval( 1 );
+    ABCA::ArchiveWriterPtr a = w( archiveName, ABCA::MetaData() );
+
+    Alembic::Util::uint32_t tsIndex =
+        a->addTimeSampling( ABCA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+
+    ABCA::ObjectWriterPtr obj = a->getTop()->createChild(
+        ABCA::ObjectHeader( "animated", ABCA::MetaData() ) );
+    ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+    ABCA::ScalarPropertyWriterPtr scalarProp =
+        props->createScalarProperty( "scalar", ABCA::MetaData(),
+            ABCA::DataType( kFloat64POD ), tsIndex );
+    ABCA::ArrayPropertyWriterPtr arrayProp =
+        props->createArrayProperty( "array", ABCA::MetaData(),
+            ABCA::DataType( kInt32POD ), tsIndex );
+
+    for ( std::size_t i = 0; i < 4; ++i )
+    {
+        setSample( scalarProp, arrayProp, i );
+    }
+
+    // the checkpoint before the last array sample has all of the scalar ones
+    ABCA::ArchiveReaderPtr ar = openCheckpoint( archiveName );
+    ABCA::ObjectReaderPtr objReader = ar->getTop()->getChild( "animated" );
+    TESTING_ASSERT( objReader->getProperties()->getScalarProperty(
+                    "scalar" )->getNumSamples() == 4 );
+    TESTING_ASSERT( objReader->getProperties()->getArrayProperty(
+                    "array" )->getNumSamples() == 3 );
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    testCheckpoints();
+    testCheckpointInterval();
+    return 0;
+}
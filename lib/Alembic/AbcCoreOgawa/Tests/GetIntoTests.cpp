@@ -0,0 +1,324 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName )
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w( iArchiveName, ABCA::MetaData() );
+    ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+    ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+    ABCA::ArrayPropertyWriterPtr ints = parent->createArrayProperty( "ints",
+        ABCA::MetaData(), i32d, 0 );
+
+    std::vector< int32_t > vals;
+    for ( int32_t i = 0; i < 100; ++i )
+    {
+        vals.push_back( i - 50 );
+    }
+    ints->setSample( ABCA::ArraySample( &vals.front(), i32d,
+        Alembic::Util::Dimensions( vals.size() ) ) );
+    ints->setSample( ABCA::ArraySample( &vals.front(), i32d,
+        Alembic::Util::Dimensions( 5 ) ) );
+
+    ABCA::DataType f3d( Alembic::Util::kFloat32POD, 3 );
+    ABCA::ArrayPropertyWriterPtr points = parent->createArrayProperty(
+        "points", ABCA::MetaData(), f3d, 0 );
+
+    std::vector< float32_t > pts;
+    for ( std::size_t i = 0; i < 12; ++i )
+    {
+        pts.push_back( i * 0.5f );
+    }
+    points->setSample( ABCA::ArraySample( &pts.front(), f3d,
+        Alembic::Util::Dimensions( 4 ) ) );
+
+    ABCA::DataType sd( Alembic::Util::kStringPOD, 1 );
+    ABCA::ArrayPropertyWriterPtr strs = parent->createArrayProperty( "strs",
+        ABCA::MetaData(), sd, 0 );
+
+    std::vector< std::string > names;
+    names.push_back( "one" );
+    names.push_back( "" );
+    names.push_back( "three" );
+    strs->setSample( ABCA::ArraySample( &names.front(), sd,
+        Alembic::Util::Dimensions( names.size() ) ) );
+
+    ABCA::DataType wsd( Alembic::Util::kWstringPOD, 1 );
+    ABCA::ArrayPropertyWriterPtr wstrs = parent->createArrayProperty(
+        "wstrs", ABCA::MetaData(), wsd, 0 );
+
+    std::vector< std::wstring > wnames;
+    wnames.push_back( L"alpha" );
+    wnames.push_back( L"beta" );
+    wstrs->setSample( ABCA::ArraySample( &wnames.front(), wsd,
+        Alembic::Util::Dimensions( wnames.size() ) ) );
+}
+
+//-*****************************************************************************
+void testGetInto()
+{
+    writeArchive( "getInto.abc" );
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r( "getInto.abc" );
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+    ABCA::ArrayPropertyReaderPtr ints = parent->getArrayProperty( "ints" );
+
+    // query the size first
+    TESTING_ASSERT( ints->getInto( 0, NULL, 0, kInt32POD ) == 100 );
+    TESTING_ASSERT( ints->getInto( 1, NULL, 0, kInt32POD ) == 5 );
+
+    // too small, left alone
+    std::vector< int32_t > i32( 99, 7 );
+    TESTING_ASSERT( ints->getInto( 0, &i32.front(), i32.size(),
+                                   kInt32POD ) == 100 );
+    TESTING_ASSERT( i32[0] == 7 && i32[98] == 7 );
+
+    i32.resize( 100 );
+    TESTING_ASSERT( ints->getInto( 0, &i32.front(), i32.size(),
+                                   kInt32POD ) == 100 );
+    for ( int32_t i = 0; i < 100; ++i )
+    {
+        TESTING_ASSERT( i32[i] == i - 50 );
+    }
+
+    // bigger and smaller PODs
+    std::vector< int64_t > i64( 100 );
+    TESTING_ASSERT( ints->getInto( 0, &i64.front(), i64.size(),
+                                   kInt64POD ) == 100 );
+    std::vector< int8_t > i8( 100 );
+    TESTING_ASSERT( ints->getInto( 0, &i8.front(), i8.size(),
+                                   kInt8POD ) == 100 );
+    std::vector< float64_t > f64( 100 );
+    TESTING_ASSERT( ints->getInto( 0, &f64.front(), f64.size(),
+                                   kFloat64POD ) == 100 );
+    for ( int32_t i = 0; i < 100; ++i )
+    {
+        TESTING_ASSERT( i64[i] == i - 50 );
+        TESTING_ASSERT( i8[i] == i - 50 );
+        TESTING_ASSERT( f64[i] == i - 50 );
+    }
+
+    // getAs goes through the same path
+    std::vector< int64_t > as64( 5, 0 );
+    ints->getAs( 1, &as64.front(), kInt64POD );
+    TESTING_ASSERT( as64[0] == -50 && as64[4] == -46 );
+
+    // the count includes the extent
+    ABCA::ArrayPropertyReaderPtr points = parent->getArrayProperty( "points" );
+    std::vector< float64_t > pts( 12 );
+    TESTING_ASSERT( points->getInto( 0, &pts.front(), pts.size(),
+                                     kFloat64POD ) == 12 );
+    for ( std::size_t i = 0; i < 12; ++i )
+    {
+        TESTING_ASSERT( pts[i] == i * 0.5 );
+    }
+
+    ABCA::ArrayPropertyReaderPtr strs = parent->getArrayProperty( "strs" );
+    TESTING_ASSERT( strs->getInto( 0, NULL, 0, kStringPOD ) == 3 );
+    std::vector< std::string > names( 3, "junk" );
+    TESTING_ASSERT( strs->getInto( 0, &names.front(), names.size(),
+                                   kStringPOD ) == 3 );
+    TESTING_ASSERT( names[0] == "one" && names[1].empty() &&
+                    names[2] == "three" );
+
+    ABCA::ArrayPropertyReaderPtr wstrs = parent->getArrayProperty( "wstrs" );
+    std::vector< std::wstring > wnames( 2, L"junk" );
+    TESTING_ASSERT( wstrs->getInto( 0, &wnames.front(), wnames.size(),
+                                    kWstringPOD ) == 2 );
+    TESTING_ASSERT( wnames[0] == L"alpha" && wnames[1] == L"beta" );
+}
+
+//-*****************************************************************************
+void testCompressedGetInto()
+{
+    AO::BlobStorePtr store( new AO::BlobStore( "getIntoBlobs" ) );
+
+    // big enough to be converted over several chunks
+    std::vector< int32_t > vals;
+    for ( int32_t i = 0; i < 50000; ++i )
+    {
+        vals.push_back( ( i % 30000 ) - 15000 );
+    }
+
+    ABCA::DataType i32d( Alembic::Util::kInt32POD, 1 );
+    ABCA::ArraySample samp( &vals.front(), i32d,
+        Alembic::Util::Dimensions( vals.size() ) );
+
+    {
+        AO::WriteArchive w;
+        w.setBlobStore( store, 64 );
+        ABCA::ArchiveWriterPtr a = w( "getIntoCompressed.abc",
+                                      ABCA::MetaData() );
+        ABCA::ArrayPropertyWriterPtr ints =
+            a->getTop()->getProperties()->createArrayProperty( "ints",
+                ABCA::MetaData(), i32d, 0 );
+        ABCA::RawArraySample raw;
+        AO::CompressArraySample( samp, raw );
+        TESTING_ASSERT( ints->setRawSample( raw ) );
+    }
+
+    AO::BlobStorePtr store2( new AO::BlobStore( "getIntoBlobs", 0 ) );
+    AO::ReadArchive r;
+    r.setBlobStore( store2 );
+    ABCA::ArchiveReaderPtr a = r( "getIntoCompressed.abc" );
+    ABCA::ArrayPropertyReaderPtr ints =
+        a->getTop()->getProperties()->getArrayProperty( "ints" );
+
+    std::size_t numVals = vals.size();
+    TESTING_ASSERT( ints->getInto( 0, NULL, 0, kInt32POD ) == numVals );
+
+    std::vector< int32_t > i32( numVals );
+    TESTING_ASSERT( ints->getInto( 0, &i32.front(), i32.size(),
+                                   kInt32POD ) == numVals );
+    std::vector< float64_t > f64( numVals );
+    TESTING_ASSERT( ints->getInto( 0, &f64.front(), f64.size(),
+                                   kFloat64POD ) == numVals );
+    std::vector< int16_t > i16( numVals );
+    TESTING_ASSERT( ints->getInto( 0, &i16.front(), i16.size(),
+                                   kInt16POD ) == numVals );
+
+    // out of range values are clamped
+    std::vector< int8_t > i8( numVals );
+    TESTING_ASSERT( ints->getInto( 0, &i8.front(), i8.size(),
+                                   kInt8POD ) == numVals );
+    std::vector< uint32_t > u32( numVals );
+    TESTING_ASSERT( ints->getInto( 0, &u32.front(), u32.size(),
+                                   kUint32POD ) == numVals );
+
+    for ( std::size_t i = 0; i < numVals; ++i )
+    {
+        TESTING_ASSERT( i32[i] == vals[i] );
+        TESTING_ASSERT( f64[i] == vals[i] );
+        TESTING_ASSERT( i16[i] == vals[i] );
+        TESTING_ASSERT( i8[i] == std::max( -128, std::min( 127, vals[i] ) ) );
+        TESTING_ASSERT( u32[i] == ( uint32_t ) std::max( 0, vals[i] ) );
+    }
+}
+
+//-*****************************************************************************
+void testFloatConversions()
+{
+    std::vector< float64_t > vals;
+    for ( std::size_t i = 0; i < 3000; ++i )
+    {
+        vals.push_back( i * 0.25 - 100.0 );
+    }
+    vals[7] = 1e300;
+    vals[8] = -1e300;
+
+    std::vector< float16_t > hvals;
+    for ( std::size_t i = 0; i < 100; ++i )
+    {
+        hvals.push_back( float16_t( i * 0.5f - 20.0f ) );
+    }
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w( "getIntoFloats.abc", ABCA::MetaData() );
+        ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+        ABCA::DataType f64d( Alembic::Util::kFloat64POD, 3 );
+        ABCA::ArrayPropertyWriterPtr doubles = parent->createArrayProperty(
+            "doubles", ABCA::MetaData(), f64d, 0 );
+
+        doubles->setSample( ABCA::ArraySample( &vals.front(), f64d,
+            Alembic::Util::Dimensions( vals.size() / 3 ) ) );
+
+        ABCA::DataType hd( Alembic::Util::kFloat16POD, 1 );
+        ABCA::ArrayPropertyWriterPtr halves = parent->createArrayProperty(
+            "halves", ABCA::MetaData(), hd, 0 );
+
+        halves->setSample( ABCA::ArraySample( &hvals.front(), hd,
+            Alembic::Util::Dimensions( hvals.size() ) ) );
+    }
+
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr ra = r( "getIntoFloats.abc" );
+    ABCA::CompoundPropertyReaderPtr parent = ra->getTop()->getProperties();
+
+    ABCA::ArrayPropertyReaderPtr rdoubles = parent->getArrayProperty(
+        "doubles" );
+    std::vector< float32_t > f32( vals.size() );
+    TESTING_ASSERT( rdoubles->getInto( 0, &f32.front(), f32.size(),
+                                       kFloat32POD ) == vals.size() );
+    TESTING_ASSERT( f32[7] == std::numeric_limits< float32_t >::max() );
+    TESTING_ASSERT( f32[8] == -std::numeric_limits< float32_t >::max() );
+    for ( std::size_t i = 9; i < vals.size(); ++i )
+    {
+        TESTING_ASSERT( f32[i] == ( float32_t ) vals[i] );
+    }
+
+    ABCA::ArrayPropertyReaderPtr rhalves = parent->getArrayProperty(
+        "halves" );
+    std::vector< float32_t > hf32( hvals.size() );
+    TESTING_ASSERT( rhalves->getInto( 0, &hf32.front(), hf32.size(),
+                                      kFloat32POD ) == hvals.size() );
+    for ( std::size_t i = 0; i < hvals.size(); ++i )
+    {
+        TESTING_ASSERT( hf32[i] == i * 0.5f - 20.0f );
+    }
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    testGetInto();
+    testCompressedGetInto();
+    testFloatConversions();
+    return 0;
+}
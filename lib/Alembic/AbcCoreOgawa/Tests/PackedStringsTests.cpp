@@ -0,0 +1,248 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <iostream>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+void makeNames( std::vector< std::string > & oNames,
+                PackedStrings & oPacked )
+{
+    oNames.clear();
+    oPacked.clear();
+    for ( std::size_t i = 0; i < 1000; ++i )
+    {
+        std::ostringstream strm;
+        if ( i % 7 != 0 )
+        {
+            strm << "/root/group" << i % 13 << "/shape" << i;
+        }
+        oNames.push_back( strm.str() );
+        oPacked.push_back( strm.str() );
+    }
+}
+
+//-*****************************************************************************
+void testPackedStrings()
+{
+    PackedStrings packed;
+    TESTING_ASSERT( packed.empty() && packed.size() == 0 );
+    TESTING_ASSERT( packed.numChars() == 0 && packed.data() == NULL );
+
+    packed.push_back( "abc" );
+    packed.push_back( "" );
+    packed.push_back( "de", 2 );
+    TESTING_ASSERT( packed.size() == 3 );
+    TESTING_ASSERT( packed.numChars() == 8 );
+    TESTING_ASSERT( packed.length( 0 ) == 3 && packed.length( 1 ) == 0 );
+    TESTING_ASSERT( std::string( packed.c_str( 2 ) ) == "de" );
+    TESTING_ASSERT( packed[0] == "abc" && packed.get( 1 ).empty() );
+
+    std::vector< char > chars;
+    chars.push_back( 'x' );
+    chars.push_back( 0 );
+    chars.push_back( 0 );
+    packed.swapChars( chars );
+    TESTING_ASSERT( chars.size() == 8 );
+    TESTING_ASSERT( packed.size() == 2 );
+    TESTING_ASSERT( packed[0] == "x" && packed[1] == "" );
+
+    std::vector< std::string > strs;
+    packed.getStrings( strs );
+    TESTING_ASSERT( strs.size() == 2 && strs[0] == "x" && strs[1] == "" );
+
+    packed.clear();
+    TESTING_ASSERT( packed.empty() && packed.numChars() == 0 );
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iArchiveName )
+{
+    AO::WriteArchive w;
+    ABCA::ArchiveWriterPtr a = w( iArchiveName, ABCA::MetaData() );
+    ABCA::CompoundPropertyWriterPtr parent = a->getTop()->getProperties();
+
+    std::vector< std::string > names;
+    PackedStrings packedNames;
+    makeNames( names, packedNames );
+
+    ABCA::DataType sd( kStringPOD, 1 );
+
+    // the same sample set both ways should be stored once
+    ABCA::ArrayPropertyWriterPtr unpacked = parent->createArrayProperty(
+        "unpacked", ABCA::MetaData(), sd, 0 );
+    unpacked->setSample( ABCA::ArraySample( &names.front(), sd,
+        Dimensions( names.size() ) ) );
+
+    ABCA::ArrayPropertyWriterPtr strs = parent->createArrayProperty(
+        "strs", ABCA::MetaData(), sd, 0 );
+    strs->setPackedSample( packedNames );
+    strs->setPackedSample( PackedStrings() );
+    strs->setPackedSample( packedNames );
+
+    ABCA::DataType s2d( kStringPOD, 2 );
+    ABCA::ArrayPropertyWriterPtr pairs = parent->createArrayProperty(
+        "pairs", ABCA::MetaData(), s2d, 0 );
+    pairs->setPackedSample( packedNames );
+
+    PackedStrings odd;
+    odd.push_back( "a" );
+    TESTING_ASSERT_THROW( pairs->setPackedSample( odd ),
+                          Alembic::Util::Exception );
+
+    PackedStrings withNull;
+    withNull.push_back( "a\0b", 3 );
+    TESTING_ASSERT_THROW( strs->setPackedSample( withNull ),
+                          Alembic::Util::Exception );
+
+    PackedWstrings wrongType;
+    TESTING_ASSERT_THROW( strs->setPackedSample( wrongType ),
+                          Alembic::Util::Exception );
+
+    ABCA::DataType wsd( kWstringPOD, 1 );
+    ABCA::ArrayPropertyWriterPtr wstrs = parent->createArrayProperty(
+        "wstrs", ABCA::MetaData(), wsd, 0 );
+
+    PackedWstrings wnames;
+    wnames.push_back( L"alpha" );
+    wnames.push_back( L"" );
+    wnames.push_back( L"gamma" );
+    wstrs->setPackedSample( wnames );
+
+    std::vector< std::wstring > wunpacked;
+    wnames.getStrings( wunpacked );
+    wstrs->setSample( ABCA::ArraySample( &wunpacked.front(), wsd,
+        Dimensions( wunpacked.size() ) ) );
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iArchiveName )
+{
+    AO::ReadArchive r;
+    ABCA::ArchiveReaderPtr a = r( iArchiveName );
+    ABCA::CompoundPropertyReaderPtr parent = a->getTop()->getProperties();
+
+    std::vector< std::string > names;
+    PackedStrings packedNames;
+    makeNames( names, packedNames );
+
+    ABCA::ArrayPropertyReaderPtr unpacked =
+        parent->getArrayProperty( "unpacked" );
+    ABCA::ArrayPropertyReaderPtr strs = parent->getArrayProperty( "strs" );
+    TESTING_ASSERT( strs->getNumSamples() == 3 );
+
+    ABCA::ArraySampleKey unpackedKey;
+    ABCA::ArraySampleKey packedKey;
+    TESTING_ASSERT( unpacked->getKey( 0, unpackedKey ) );
+    TESTING_ASSERT( strs->getKey( 0, packedKey ) );
+    TESTING_ASSERT( unpackedKey == packedKey );
+
+    for ( ABCA::index_t i = 0; i < 3; i += 2 )
+    {
+        std::vector< std::string > vals( names.size() );
+        TESTING_ASSERT( strs->getInto( i, &vals.front(), vals.size(),
+                                       kStringPOD ) == names.size() );
+
+        PackedStrings packed;
+        strs->getPacked( i, packed );
+        TESTING_ASSERT( packed.size() == names.size() );
+
+        for ( std::size_t j = 0; j < names.size(); ++j )
+        {
+            TESTING_ASSERT( vals[j] == names[j] );
+            TESTING_ASSERT( packed[j] == names[j] );
+        }
+    }
+
+    PackedStrings empty;
+    empty.push_back( "stale" );
+    strs->getPacked( 1, empty );
+    TESTING_ASSERT( empty.empty() );
+
+    ABCA::ArrayPropertyReaderPtr pairs = parent->getArrayProperty( "pairs" );
+    Dimensions dims;
+    pairs->getDimensions( 0, dims );
+    TESTING_ASSERT( dims.numPoints() == names.size() / 2 );
+
+    PackedStrings packedPairs;
+    pairs->getPacked( 0, packedPairs );
+    TESTING_ASSERT( packedPairs.size() == names.size() );
+    TESTING_ASSERT( packedPairs[names.size() - 1] == names.back() );
+
+    PackedWstrings wrongType;
+    TESTING_ASSERT_THROW( strs->getPacked( 0, wrongType ),
+                          Alembic::Util::Exception );
+
+    ABCA::ArrayPropertyReaderPtr wstrs = parent->getArrayProperty( "wstrs" );
+
+    // the unpacked sample matched the packed one, so it wasn't stored again
+    TESTING_ASSERT( wstrs->isConstant() );
+
+    for ( ABCA::index_t i = 0; i < 2; ++i )
+    {
+        PackedWstrings wpacked;
+        wstrs->getPacked( i, wpacked );
+        TESTING_ASSERT( wpacked.size() == 3 );
+        TESTING_ASSERT( wpacked[0] == L"alpha" );
+        TESTING_ASSERT( wpacked[1] == L"" );
+        TESTING_ASSERT( wpacked[2] == L"gamma" );
+    }
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testPackedStrings();
+
+    std::string archiveName = "packedStrings.abc";
+    writeArchive( archiveName );
+    readArchive( archiveName );
+
+    return 0;
+}
@@ -0,0 +1,221 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcCoreAbstract/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+#include <Alembic/Util/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+//-*****************************************************************************
+namespace AO = Alembic::AbcCoreOgawa;
+
+namespace ABCA = Alembic::AbcCoreAbstract;
+
+using namespace Alembic::Util;
+
+//-*****************************************************************************
+void setSample( ABCA::ScalarPropertyWriterPtr iScalar,
+                ABCA::ArrayPropertyWriterPtr iArray, std::size_t iIndex )
+{
+    double val = ( double ) iIndex;
+    iScalar->setSample( &val );
+
+    std::vector< int32_t > samp( iIndex + 1, ( int32_t ) iIndex );
+    iArray->setSample( ABCA::ArraySample( &samp.front(),
+        ABCA::DataType( kInt32POD ), Dimensions( samp.size() ) ) );
+}
+
+//-*****************************************************************************
+void checkSamples( ABCA::ObjectReaderPtr iTop, std::size_t iNumSamples )
+{
+    ABCA::ObjectReaderPtr obj = iTop->getChild( "animated" );
+    TESTING_ASSERT( obj );
+
+    ABCA::ScalarPropertyReaderPtr scalarProp =
+        obj->getProperties()->getScalarProperty( "scalar" );
+    ABCA::ArrayPropertyReaderPtr arrayProp =
+        obj->getProperties()->getArrayProperty( "array" );
+
+    TESTING_ASSERT( scalarProp->getNumSamples() == iNumSamples );
+    TESTING_ASSERT( arrayProp->getNumSamples() == iNumSamples );
+
+    for ( std::size_t i = 0; i < iNumSamples; ++i )
+    {
+        ABCA::ArraySampleKey key;
+        TESTING_ASSERT( arrayProp->getKey( i, key ) );
+        TESTING_ASSERT( key.numBytes == 4 * ( i + 1 ) );
+    }
+}
+
+//-*****************************************************************************
+// the headers of what didn't change are shared with the old hierarchy
+void checkUnchanged( ABCA::ObjectReaderPtr iOldTop,
+                     ABCA::ObjectReaderPtr iNewTop )
+{
+    ABCA::ObjectReaderPtr oldDone = iOldTop->getChild( "done" );
+    ABCA::ObjectReaderPtr newDone = iNewTop->getChild( "done" );
+
+    TESTING_ASSERT( newDone->getNumChildren() == 1 );
+    TESTING_ASSERT( &oldDone->getChildHeader( 0 ) ==
+                    &newDone->getChildHeader( 0 ) );
+    TESTING_ASSERT( &oldDone->getProperties()->getPropertyHeader( 0 ) ==
+                    &newDone->getProperties()->getPropertyHeader( 0 ) );
+
+    // while what did was read again
+    TESTING_ASSERT(
+        &iOldTop->getChild( "animated" )->getProperties()->
+            getPropertyHeader( 0 ) !=
+        &iNewTop->getChild( "animated" )->getProperties()->
+            getPropertyHeader( 0 ) );
+}
+
+//-*****************************************************************************
+void testRefresh( AO::ReadArchive & iReader, const std::string & iName )
+{
+    std::string archiveName = iName + ".abc";
+
+    iReader.setRefreshable( true );
+
+    ABCA::ArchiveReaderPtr ar;
+    ABCA::ObjectReaderPtr firstTop;
+    ABCA::ObjectReaderPtr secondTop;
+
+    {
+        AO::WriteArchive w;
+        ABCA::ArchiveWriterPtr a = w( archiveName, ABCA::MetaData() );
+        ABCA::ObjectWriterPtr top = a->getTop();
+
+        Alembic::Util::uint32_t tsIndex =
+            a->addTimeSampling( ABCA::TimeSampling( 1.0 / 24.0, 0.0 ) );
+
+        // done before any checkpoint, so it never changes after
+        {
+            ABCA::ObjectWriterPtr done = top->createChild(
+                ABCA::ObjectHeader( "done", ABCA::MetaData() ) );
+            done->createChild( ABCA::ObjectHeader( "inner",
+                                                   ABCA::MetaData() ) );
+            ABCA::ScalarPropertyWriterPtr constProp =
+                done->getProperties()->createScalarProperty( "constant",
+                    ABCA::MetaData(), ABCA::DataType( kInt32POD ), 0 );
+            int32_t val = 7;
+            constProp->setSample( &val );
+        }
+
+        ABCA::ObjectWriterPtr obj = top->createChild(
+            ABCA::ObjectHeader( "animated", ABCA::MetaData() ) );
+        ABCA::CompoundPropertyWriterPtr props = obj->getProperties();
+        ABCA::ScalarPropertyWriterPtr scalarProp =
+            props->createScalarProperty( "scalar", ABCA::MetaData(),
+                ABCA::DataType( kFloat64POD ), tsIndex );
+        ABCA::ArrayPropertyWriterPtr arrayProp =
+            props->createArrayProperty( "array", ABCA::MetaData(),
+                ABCA::DataType( kInt32POD ), tsIndex );
+
+        for ( std::size_t i = 0; i < 2; ++i )
+        {
+            setSample( scalarProp, arrayProp, i );
+        }
+        AO::WriteCheckpoint( a );
+
+        ar = iReader( archiveName );
+        firstTop = ar->getTop();
+        checkSamples( firstTop, 2 );
+
+        // samples without a checkpoint aren't picked up
+        setSample( scalarProp, arrayProp, 2 );
+        TESTING_ASSERT( !ar->refresh() );
+        TESTING_ASSERT( ar->getTop() == firstTop );
+
+        setSample( scalarProp, arrayProp, 3 );
+        AO::WriteCheckpoint( a );
+
+        TESTING_ASSERT( ar->refresh() );
+        secondTop = ar->getTop();
+        TESTING_ASSERT( secondTop != firstTop );
+        checkSamples( secondTop, 4 );
+        checkSamples( firstTop, 2 );
+        TESTING_ASSERT( ar->getMaxNumSamplesForTimeSamplingIndex( 1 ) == 4 );
+        checkUnchanged( firstTop, secondTop );
+
+        // objects added since show up too
+        top->createChild( ABCA::ObjectHeader( "late", ABCA::MetaData() ) );
+        AO::WriteCheckpoint( a );
+
+        TESTING_ASSERT( ar->refresh() );
+        TESTING_ASSERT( ar->getTop()->getNumChildren() == 3 );
+        TESTING_ASSERT( secondTop->getNumChildren() == 2 );
+        TESTING_ASSERT( !ar->refresh() );
+
+        setSample( scalarProp, arrayProp, 4 );
+    }
+
+    // closing the archive is picked up like a checkpoint
+    TESTING_ASSERT( ar->refresh() );
+    checkSamples( ar->getTop(), 5 );
+    TESTING_ASSERT( ar->getMaxNumSamplesForTimeSamplingIndex( 1 ) == 5 );
+    checkUnchanged( secondTop, ar->getTop() );
+    TESTING_ASSERT( ar->getTop()->getNumChildren() == 3 );
+    TESTING_ASSERT( !ar->refresh() );
+
+    // only refreshable readers refresh
+    {
+        AO::ReadArchive r;
+        ABCA::ArchiveReaderPtr closed = r( archiveName );
+        TESTING_ASSERT( !closed->refresh() );
+        checkSamples( closed->getTop(), 5 );
+    }
+}
+
+//-*****************************************************************************
+int main ( int argc, char *argv[] )
+{
+    {
+        AO::ReadArchive r;
+        testRefresh( r, "refreshMMap" );
+    }
+
+    {
+        AO::ReadArchive r( 1, false );
+        testRefresh( r, "refreshStreams" );
+    }
+
+    return 0;
+}
@@ -36,6 +36,10 @@
 
 #include <Alembic/AbcCoreOgawa/WriteUtil.h>
 #include <Alembic/AbcCoreOgawa/AwImpl.h>
+#include <Alembic/AbcCoreOgawa/ArImpl.h>
+#include <Alembic/AbcCoreOgawa/ReadUtil.h>
+#include <Alembic/AbcCoreOgawa/ReadWrite.h>
+#include <zstd.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
@@ -156,6 +160,81 @@ GetWrittenSampleMap( AbcA::ArchiveWriterPtr iVal )
     return ptr->getWrittenSampleMap();
 }
 
+//-*****************************************************************************
+WrittenSampleMap &
+GetExternalSampleMap( AbcA::ArchiveWriterPtr iVal )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    return ptr->getExternalSampleMap();
+}
+
+//-*****************************************************************************
+void CheckpointIfNeeded( AbcA::ArchiveWriterPtr iVal )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+    ptr->checkpointIfNeeded();
+}
+
+//-*****************************************************************************
+Util::uint32_t GetNumMaxSamples( PropertyHeaderPtr iHeader )
+{
+    Util::uint32_t numSamples = iHeader->nextSampleIndex;
+
+    // a constant property, we wrote the same sample over and over
+    if ( iHeader->lastChangedIndex == 0 && numSamples > 0 )
+    {
+        numSamples = 1;
+    }
+
+    return numSamples;
+}
+
+//-*****************************************************************************
+BlobStorePtr GetBlobStore( AbcA::ArchiveWriterPtr iVal,
+                           std::size_t iNumBytes )
+{
+    AwImpl *ptr = dynamic_cast<AwImpl*>( iVal.get() );
+    ABCA_ASSERT( ptr, "NULL Impl Ptr" );
+
+    if ( ptr->getBlobStore() && iNumBytes >= ptr->getMinBlobBytes() )
+    {
+        return ptr->getBlobStore();
+    }
+
+    return BlobStorePtr();
+}
+
+//-*****************************************************************************
+// Adds the sample data to iGroup, or if iStore is given, stores it there and
+// adds the digest and the size of the blob to iGroup instead.
+static Ogawa::ODataPtr
+AddSampleData( Ogawa::OGroupPtr iGroup,
+               BlobStore * iStore,
+               const Util::Digest & iDigest,
+               Util::uint64_t iNumData,
+               const Util::uint64_t * iSizes,
+               const void ** iDatas )
+{
+    if ( !iStore )
+    {
+        return iGroup->addData( iNumData, iSizes, iDatas );
+    }
+
+    iStore->put( iDigest, iNumData, iDatas, iSizes );
+
+    Util::uint64_t blobSize = 0;
+    for ( Util::uint64_t i = 0; i < iNumData; ++i )
+    {
+        blobSize += iSizes[i];
+    }
+
+    const void * datas[2] = { iDigest.d, &blobSize };
+    Alembic::Util::uint64_t sizes[2] = { 16, 8 };
+    return iGroup->addData( 2, sizes, datas );
+}
+
 //-*****************************************************************************
 void WriteDimensions( Ogawa::OGroupPtr iGroup,
                       const AbcA::Dimensions & iDims,
@@ -178,12 +257,138 @@ void WriteDimensions( Ogawa::OGroupPtr iGroup,
                      ( const void * )iDims.rootPtr() );
 }
 
+//-*****************************************************************************
+// Packs string and wstring samples the way they are stored, each string
+// followed by a NULL, and wstring characters as 32 bit integers.
+static void PackStrings( const AbcA::ArraySample & iSamp,
+                         std::vector< Util::int8_t > & oPacked )
+{
+    size_t numPods = iSamp.getDataType().getExtent() *
+        iSamp.getDimensions().numPoints();
+    const std::string * strs =
+        static_cast<const std::string*>( iSamp.getData() );
+
+    // the strings and their NULL separators, packed in one go
+    size_t numChars = numPods;
+    for ( size_t j = 0; j < numPods; ++j )
+    {
+        numChars += strs[j].length();
+    }
+
+    oPacked.resize( numChars );
+    Util::int8_t * packed = oPacked.empty() ? NULL : &oPacked.front();
+    for ( size_t j = 0; j < numPods; ++j )
+    {
+        const std::string &str = strs[j];
+
+        ABCA_ASSERT( str.find( '\0' ) == std::string::npos,
+                 "Illegal NULL character found in string data " );
+
+        memcpy( packed, str.data(), str.length() );
+        packed += str.length();
+        *packed++ = 0;
+    }
+}
+
+//-*****************************************************************************
+static void PackStrings( const AbcA::ArraySample & iSamp,
+                         std::vector< Util::int32_t > & oPacked )
+{
+    size_t numPods = iSamp.getDataType().getExtent() *
+        iSamp.getDimensions().numPoints();
+    const std::wstring * strs =
+        static_cast<const std::wstring*>( iSamp.getData() );
+
+    size_t numChars = numPods;
+    for ( size_t j = 0; j < numPods; ++j )
+    {
+        numChars += strs[j].length();
+    }
+
+    oPacked.resize( numChars );
+    Util::int32_t * packed = oPacked.empty() ? NULL : &oPacked.front();
+    for ( size_t j = 0; j < numPods; ++j )
+    {
+        const std::wstring &str = strs[j];
+
+        wchar_t nullChar = 0;
+        ABCA_ASSERT( str.find( nullChar ) == std::wstring::npos,
+                 "Illegal NULL character found in wstring data" );
+
+        packed = std::copy( str.begin(), str.end(), packed );
+        *packed++ = 0;
+    }
+}
+
+//-*****************************************************************************
+void CompressRawSample( const void * iData,
+                        std::size_t iNumBytes,
+                        Util::PlainOldDataType iPod,
+                        const AbcA::Dimensions & iDims,
+                        AbcA::RawArraySample & oRaw,
+                        int iLevel )
+{
+    std::size_t bound = ZSTD_compressBound( iNumBytes );
+    oRaw.format = "OgawaZstd";
+    oRaw.data.resize( 8 + bound );
+
+    Util::uint64_t numBytes = iNumBytes;
+    memcpy( &oRaw.data.front(), &numBytes, 8 );
+
+    std::size_t compressedSize = ZSTD_compress( &oRaw.data.front() + 8,
+        bound, iNumBytes ? iData : "", iNumBytes, iLevel );
+    ABCA_ASSERT( !ZSTD_isError( compressedSize ),
+        "Could not compress the array data: " <<
+        ZSTD_getErrorName( compressedSize ) );
+
+    oRaw.data.resize( 8 + compressedSize );
+    oRaw.dims = iDims;
+
+    GetArraySampleKey( &oRaw.data.front(), oRaw.data.size(), iPod, true,
+                       oRaw.key );
+    oRaw.key.origPOD = iPod;
+    oRaw.key.readPOD = iPod;
+}
+
+//-*****************************************************************************
+void CompressArraySample( const AbcA::ArraySample & iSamp,
+                          AbcA::RawArraySample & oRaw,
+                          int iLevel )
+{
+    Util::PlainOldDataType pod = iSamp.getDataType().getPod();
+
+    if ( pod == Util::kStringPOD )
+    {
+        std::vector< Util::int8_t > packed;
+        PackStrings( iSamp, packed );
+        CompressRawSample( packed.empty() ? NULL : &packed.front(),
+                           packed.size(), pod, iSamp.getDimensions(), oRaw,
+                           iLevel );
+    }
+    else if ( pod == Util::kWstringPOD )
+    {
+        std::vector< Util::int32_t > packed;
+        PackStrings( iSamp, packed );
+        CompressRawSample( packed.empty() ? NULL : &packed.front(),
+                           packed.size() * sizeof( Util::int32_t ), pod,
+                           iSamp.getDimensions(), oRaw, iLevel );
+    }
+    else
+    {
+        CompressRawSample( iSamp.getData(),
+                           iSamp.getDataType().getNumBytes() *
+                           iSamp.getDimensions().numPoints(), pod,
+                           iSamp.getDimensions(), oRaw, iLevel );
+    }
+}
+
 //-*****************************************************************************
 WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey )
+           const AbcA::ArraySample::Key &iKey,
+           BlobStore * iStore )
 {
 
     // Okay, need to actually store it.
@@ -205,64 +410,34 @@ WriteData( WrittenSampleMap &iMap,
 
     if ( dataType.getPod() == Alembic::Util::kStringPOD )
     {
-        size_t numPods = dataType.getExtent() * dims.numPoints();
         std::vector <Util::int8_t> v;
-        for ( size_t j = 0; j < numPods; ++j )
-        {
-            const std::string &str =
-                static_cast<const std::string*>( iSamp.getData() )[j];
+        PackStrings( iSamp, v );
 
-            ABCA_ASSERT( str.find( '\0' ) == std::string::npos,
-                     "Illegal NULL character found in string data " );
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
-        }
-
-        const void * datas[2] = { &iKey.digest, &v.front() };
+        const void * datas[2] = { &iKey.digest,
+            v.empty() ? NULL : &v.front() };
         Alembic::Util::uint64_t sizes[2] = { 16, v.size() };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        dataPtr = AddSampleData( iGroup, iStore, iKey.digest, 2, sizes,
+                                 datas );
     }
     else if ( dataType.getPod() == Alembic::Util::kWstringPOD )
     {
-        size_t numPods = dataType.getExtent() * dims.numPoints();
         std::vector <Util::int32_t> v;
-        for ( size_t j = 0; j < numPods; ++j )
-        {
-            const std::wstring &str =
-                static_cast<const std::wstring*>( iSamp.getData() )[j];
+        PackStrings( iSamp, v );
 
-            wchar_t nullChar = 0;
-            ABCA_ASSERT( str.find( nullChar ) == std::wstring::npos,
-                     "Illegal NULL character found in wstring data" );
-
-            size_t strLen = str.length();
-            for ( size_t k = 0; k < strLen; ++k )
-            {
-                v.push_back(str[k]);
-            }
-
-            // append a 0 for the NULL seperator character
-            v.push_back(0);
-        }
-
-        const void * datas[2] = { &iKey.digest, &v.front() };
+        const void * datas[2] = { &iKey.digest,
+            v.empty() ? NULL : &v.front() };
         Alembic::Util::uint64_t sizes[2] = { 16,
             v.size() * sizeof(Util::int32_t) };
-        dataPtr =  iGroup->addData( 2, sizes, datas );
+        dataPtr = AddSampleData( iGroup, iStore, iKey.digest, 2, sizes,
+                                 datas );
     }
     else
     {
         const void * datas[2] = { &iKey.digest, iSamp.getData() };
         Alembic::Util::uint64_t sizes[2] = { 16, iKey.numBytes };
 
-        dataPtr = iGroup->addData( 2, sizes, datas );
+        dataPtr = AddSampleData( iGroup, iStore, iKey.digest, 2, sizes,
+                                 datas );
     }
 
     writeID.reset( new WrittenSampleID( iKey, dataPtr,
@@ -273,6 +448,76 @@ WriteData( WrittenSampleMap &iMap,
     return writeID;
 }
 
+//-*****************************************************************************
+WrittenSampleIDPtr
+WriteRawData( WrittenSampleMap &iMap,
+              Ogawa::OGroupPtr iGroup,
+              const AbcA::RawArraySample &iSamp,
+              const AbcA::ArraySample::Key &iKey,
+              Util::PlainOldDataType iPod,
+              bool iCompressed,
+              std::size_t iNumPods,
+              BlobStore * iStore )
+{
+    // See whether or not we've already stored this.
+    WrittenSampleIDPtr writeID = iMap.find( iKey );
+    if ( writeID )
+    {
+        CopyWrittenData( iGroup, writeID );
+        return writeID;
+    }
+
+    // the bytes are stored as they are, with their key or zstd compressed
+    const void * datas[1] = {
+        iSamp.data.empty() ? NULL : &iSamp.data.front() };
+    Alembic::Util::uint64_t sizes[1] = { iSamp.data.size() };
+
+    // Blobs are shared by every archive using the BlobStore, and never
+    // written again once there, so they are only ever named by a hash of the
+    // bytes that are put in them.
+    AbcA::ArraySample::Key blobKey;
+    if ( iStore && !iSamp.data.empty() )
+    {
+        GetArraySampleKey( datas[0], sizes[0], iPod, iCompressed, blobKey );
+    }
+
+    Ogawa::ODataPtr dataPtr = AddSampleData( iGroup,
+        iSamp.data.empty() ? NULL : iStore, blobKey.digest, 1, sizes, datas );
+
+    writeID.reset( new WrittenSampleID( iKey, dataPtr, iNumPods ) );
+    iMap.store( writeID );
+
+    return writeID;
+}
+
+//-*****************************************************************************
+WrittenSampleIDPtr
+WritePackedData( WrittenSampleMap &iMap,
+                 Ogawa::OGroupPtr iGroup,
+                 const void * iPacked,
+                 std::size_t iNumBytes,
+                 const AbcA::ArraySample::Key &iKey,
+                 std::size_t iNumPods,
+                 BlobStore * iStore )
+{
+    WrittenSampleIDPtr writeID = iMap.find( iKey );
+    if ( writeID )
+    {
+        CopyWrittenData( iGroup, writeID );
+        return writeID;
+    }
+
+    const void * datas[2] = { &iKey.digest, iNumBytes ? iPacked : NULL };
+    Alembic::Util::uint64_t sizes[2] = { 16, iNumBytes };
+    Ogawa::ODataPtr dataPtr = AddSampleData( iGroup, iStore, iKey.digest,
+                                             2, sizes, datas );
+
+    writeID.reset( new WrittenSampleID( iKey, dataPtr, iNumPods ) );
+    iMap.store( writeID );
+
+    return writeID;
+}
+
 //-*****************************************************************************
 void CopyWrittenData( Ogawa::OGroupPtr iGroup,
                       WrittenSampleIDPtr iRef )
@@ -291,6 +536,8 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                     const AbcA::PropertyHeader &iHeader,
                     bool isScalarLike,
                     bool isHomogenous,
+                    bool isExternal,
+                    bool isCompressed,
                     Util::uint32_t iTimeSamplingIndex,
                     Util::uint32_t iNumSamples,
                     Util::uint32_t iFirstChangedIndex,
@@ -345,6 +592,12 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
     //
     // Meta data index mask 0xff00000
     // 0000 1111 1111 0000 0000 0000 0000 0000
+    //
+    // Samples are stored in a BlobStore mask 0x10000000
+    // 0001 0000 0000 0000 0000 0000 0000 0000
+    //
+    // Samples are zstd compressed and stored without a key mask 0x20000000
+    // 0010 0000 0000 0000 0000 0000 0000 0000
 
     std::string metaData = iHeader.getMetaData().serialize();
     Util::uint32_t metaDataSize = metaData.size();
@@ -429,6 +682,16 @@ void WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
             info |= 0x400;
         }
 
+        if ( isExternal )
+        {
+            info |= 0x10000000;
+        }
+
+        if ( isCompressed )
+        {
+            info |= 0x20000000;
+        }
+
         ABCA_ASSERT( iFirstChangedIndex <= iNumSamples &&
             iLastChangedIndex <= iNumSamples &&
             iFirstChangedIndex <= iLastChangedIndex,
@@ -536,6 +799,267 @@ void WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
 
 }
 
+//-*****************************************************************************
+void ReadWrittenSamples( Ogawa::IGroupPtr iGroup,
+                         Ogawa::OGroupPtr iWrapper,
+                         PropertyHeaderPtr iHeader,
+                         std::vector< WrittenSampleIDPtr > & oSamples,
+                         std::vector< AbcA::Dimensions > & oDims )
+{
+    const AbcA::DataType & dataType = iHeader->header.getDataType();
+    Util::PlainOldDataType pod = dataType.getPod();
+    bool isString = ( pod == Alembic::Util::kStringPOD ||
+                      pod == Alembic::Util::kWstringPOD );
+    bool isArray = iHeader->header.isArray();
+
+    // array properties store the data and then the dimensions of each sample
+    std::size_t numStored = iGroup->getNumChildren();
+    if ( isArray )
+    {
+        numStored /= 2;
+    }
+
+    for ( std::size_t i = 0; i < numStored; ++i )
+    {
+        Ogawa::IDataPtr data = iGroup->getData( isArray ? i * 2 : i, 0 );
+        ABCA_ASSERT( data, "Invalid sample data for: " <<
+                     iHeader->header.getName() );
+
+        // the same masking ApwImpl and SpwImpl do before writing
+        AbcA::ArraySample::Key key;
+        key.numBytes = 0;
+        key.origPOD = isString ? pod : Alembic::Util::kInt8POD;
+        key.readPOD = key.origPOD;
+
+        Util::uint64_t dataSize = data->getSize();
+        if ( isArray && !iHeader->isExternal )
+        {
+            ReadArraySampleKey( data, 0, pod, iHeader->isCompressed, key );
+        }
+        else if ( dataSize >= 16 )
+        {
+            data->read( 16, key.digest.d, 0, 0 );
+            key.numBytes = dataSize - 16;
+        }
+
+        // the size of what is in the BlobStore follows the digest
+        if ( iHeader->isExternal && dataSize == 24 )
+        {
+            Util::uint64_t blobSize = 0;
+            data->read( 8, &blobSize, 16, 0 );
+            key.numBytes = blobSize - 16;
+        }
+
+        AbcA::Dimensions dims( 1 );
+        if ( isArray )
+        {
+            Ogawa::IDataPtr dimsData = iGroup->getData( i * 2 + 1, 0 );
+            if ( dimsData && dimsData->getSize() > 0 )
+            {
+                std::size_t rank = dimsData->getSize() / 8;
+                std::vector< Util::uint64_t > ranks( rank );
+                dimsData->read( rank * 8, &ranks.front(), 0, 0 );
+
+                dims.setRank( rank );
+                for ( std::size_t r = 0; r < rank; ++r )
+                {
+                    dims[r] = ranks[r];
+                }
+            }
+            // see WriteDimensions, it is figured out from the data
+            else
+            {
+                dims = AbcA::Dimensions( key.numBytes / dataType.getNumBytes() );
+            }
+
+            oDims.push_back( dims );
+        }
+
+        // strings are keyed by the size of what they were written from
+        if ( isString )
+        {
+            key.numBytes = dataType.getNumBytes() * dims.numPoints();
+        }
+
+        // only hashing needs no data
+        Ogawa::ODataPtr existing;
+        if ( iWrapper )
+        {
+            existing = iWrapper->getExistingData( data->getPos(), dataSize );
+        }
+
+        oSamples.push_back( WrittenSampleIDPtr( new WrittenSampleID( key,
+            existing, dataType.getExtent() * dims.numPoints() ) ) );
+    }
+}
+
+//-*****************************************************************************
+Util::Digest HashWrittenSamples(
+    PropertyHeaderPtr iHeader,
+    const std::vector< WrittenSampleIDPtr > & iSamples,
+    const std::vector< AbcA::Dimensions > & iDims )
+{
+    Util::Digest hash;
+    for ( Util::uint32_t i = 0; i < iHeader->nextSampleIndex; ++i )
+    {
+        std::size_t index = iHeader->verifyIndex( i );
+        ABCA_ASSERT( index < iSamples.size(),
+            "Missing sample " << i << " for: " << iHeader->header.getName() );
+
+        Util::Digest digest = iSamples[index]->getKey().digest;
+        if ( !iDims.empty() )
+        {
+            HashDimensions( iDims[index], digest );
+        }
+
+        if ( i == 0 )
+        {
+            hash = digest;
+        }
+        else
+        {
+            Util::SpookyHash::ShortEnd( hash.words[0], hash.words[1],
+                                        digest.words[0], digest.words[1] );
+        }
+    }
+
+    return hash;
+}
+
+//-*****************************************************************************
+void CopyExistingChildren( Ogawa::IGroupPtr iExisting,
+                           Ogawa::OGroupPtr iGroup )
+{
+    std::size_t numChildren = iExisting->getNumChildren();
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        if ( iExisting->isChildData( i ) )
+        {
+            Ogawa::IDataPtr data = iExisting->getData( i, 0 );
+            iGroup->addData( iGroup->getExistingData( data->getPos(),
+                                                      data->getSize() ) );
+        }
+        else
+        {
+            Ogawa::IGroupPtr group = iExisting->getGroup( i, false, 0 );
+            iGroup->addExistingGroup( group ? group->getPos() : 0 );
+        }
+    }
+}
+
+//-*****************************************************************************
+void HashExistingProperty( Ogawa::IGroupPtr iGroup,
+                           PropertyHeaderPtr iHeader,
+                           ArImpl & iArchive,
+                           Util::uint64_t & oHash0,
+                           Util::uint64_t & oHash1 )
+{
+    Util::SpookyHash hash;
+    hash.Init( 0, 0 );
+
+    if ( iHeader->header.isCompound() )
+    {
+        // see CpwData::computeHash and CpwImpl::~CpwImpl
+        PropertyHeaderPtrs headers;
+        std::size_t numChildren = iGroup->getNumChildren();
+        if ( numChildren > 0 && iGroup->isChildData( numChildren - 1 ) )
+        {
+            ReadPropertyHeaders( iGroup, numChildren - 1, 0, iArchive,
+                                 iArchive.getIndexedMetaData(), headers );
+        }
+
+        std::vector< Util::uint64_t > hashes( headers.size() * 2 );
+        for ( std::size_t i = 0; i < headers.size(); ++i )
+        {
+            Ogawa::IGroupPtr child = iGroup->getGroup( i, false, 0 );
+            ABCA_ASSERT( child, "Invalid property group for: " <<
+                         headers[i]->header.getName() );
+            HashExistingProperty( child, headers[i], iArchive,
+                                  hashes[i * 2], hashes[i * 2 + 1] );
+        }
+
+        if ( !hashes.empty() )
+        {
+            hash.Update( &hashes.front(), hashes.size() * 8 );
+        }
+
+        HashPropertyHeader( iHeader->header, hash );
+    }
+    else
+    {
+        // see ~ApwImpl and ~SpwImpl
+        HashPropertyHeader( iHeader->header, hash );
+
+        if ( iHeader->nextSampleIndex != 0 )
+        {
+            std::vector< WrittenSampleIDPtr > samples;
+            std::vector< AbcA::Dimensions > dims;
+            ReadWrittenSamples( iGroup, Ogawa::OGroupPtr(), iHeader, samples,
+                                dims );
+
+            Util::Digest digest = HashWrittenSamples( iHeader, samples, dims );
+            hash.Update( digest.d, 16 );
+        }
+    }
+
+    hash.Final( &oHash0, &oHash1 );
+}
+
+//-*****************************************************************************
+void HashExistingObject( Ogawa::IGroupPtr iGroup,
+                         const AbcA::ObjectHeader & iHeader,
+                         ArImpl & iArchive,
+                         Util::uint64_t & oHash0,
+                         Util::uint64_t & oHash1 )
+{
+    // see OwData::writeHeaders and OwImpl::~OwImpl, Final doesn't invalidate
+    // SpookyHash so it is the child hashes followed by the data hash
+    Util::SpookyHash hash;
+    hash.Init( 0, 0 );
+
+    std::size_t numChildren = iGroup->getNumChildren();
+    ABCA_ASSERT( numChildren > 1 && iGroup->isChildData( numChildren - 1 ),
+                 "Invalid object group for: " << iHeader.getFullName() );
+
+    std::vector< ObjectHeaderPtr > headers;
+    std::string parentName = iHeader.getFullName();
+    ReadObjectHeaders( iGroup, numChildren - 1, 0,
+                       parentName == "/" ? "" : parentName,
+                       iArchive.getIndexedMetaData(), headers );
+
+    std::vector< Util::uint64_t > hashes( headers.size() * 2 );
+    for ( std::size_t i = 0; i < headers.size(); ++i )
+    {
+        Ogawa::IGroupPtr child = iGroup->getGroup( i + 1, false, 0 );
+        ABCA_ASSERT( child, "Invalid object group for: " <<
+                     headers[i]->getFullName() );
+        HashExistingObject( child, *headers[i], iArchive,
+                            hashes[i * 2], hashes[i * 2 + 1] );
+    }
+
+    if ( !hashes.empty() )
+    {
+        hash.Update( &hashes.front(), hashes.size() * 8 );
+    }
+
+    Util::uint64_t dataHash[2] = { 0, 0 };
+    Ogawa::IDataPtr data = iGroup->getData( numChildren - 1, 0 );
+    if ( data->getSize() >= 32 )
+    {
+        data->read( 16, dataHash, data->getSize() - 32, 0 );
+    }
+    hash.Update( dataHash, 16 );
+
+    std::string metaDataStr = iHeader.getMetaData().serialize();
+    if ( !metaDataStr.empty() )
+    {
+        hash.Update( &( metaDataStr[0] ), metaDataStr.size() );
+    }
+
+    hash.Update( &( iHeader.getName()[0] ), iHeader.getName().size() );
+    hash.Final( &oHash0, &oHash1 );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcCoreOgawa
 } // End namespace Alembic
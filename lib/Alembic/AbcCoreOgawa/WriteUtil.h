@@ -40,11 +40,14 @@
 #include <Alembic/AbcCoreOgawa/Foundation.h>
 #include <Alembic/AbcCoreOgawa/WrittenSampleMap.h>
 #include <Alembic/AbcCoreOgawa/MetaDataMap.h>
+#include <Alembic/AbcCoreOgawa/BlobStore.h>
 
 namespace Alembic {
 namespace AbcCoreOgawa {
 namespace ALEMBIC_VERSION_NS {
 
+class ArImpl;
+
 //-*****************************************************************************
 void HashPropertyHeader( const AbcA::PropertyHeader & iHeader,
                          Util::SpookyHash & ioHash );
@@ -59,6 +62,29 @@ void HashDimensions( const AbcA::Dimensions & iDims,
 WrittenSampleMap& GetWrittenSampleMap(
     AbcA::ArchiveWriterPtr iArchive );
 
+//-*****************************************************************************
+// The samples written to the BlobStore are deduplicated separately, since in
+// the archive they are references instead of data.
+WrittenSampleMap& GetExternalSampleMap(
+    AbcA::ArchiveWriterPtr iArchive );
+
+//-*****************************************************************************
+// Returns the BlobStore of the archive if a sample of iNumBytes should be
+// stored in it, otherwise an empty pointer.
+BlobStorePtr GetBlobStore( AbcA::ArchiveWriterPtr iArchive,
+                           std::size_t iNumBytes );
+
+//-*****************************************************************************
+// Writes a checkpoint of iArchive if its checkpoint interval has been
+// written since the last one.  Called before a sample changes anything, so
+// what is snapshotted is always consistent.
+void CheckpointIfNeeded( AbcA::ArchiveWriterPtr iArchive );
+
+//-*****************************************************************************
+// The number of samples a property adds to the max samples of its
+// TimeSampling, a constant property only counts once.
+Util::uint32_t GetNumMaxSamples( PropertyHeaderPtr iHeader );
+
 //-*****************************************************************************
 void
 WriteDimensions( Ogawa::OGroupPtr iGroup,
@@ -75,7 +101,46 @@ WrittenSampleIDPtr
 WriteData( WrittenSampleMap &iMap,
            Ogawa::OGroupPtr iGroup,
            const AbcA::ArraySample &iSamp,
-           const AbcA::ArraySample::Key &iKey );
+           const AbcA::ArraySample::Key &iKey,
+           BlobStore * iStore = NULL );
+
+//-*****************************************************************************
+// Fills oRaw with the iNumBytes at iData the way the samples of compressed
+// properties are stored, their size followed by a zstd frame, and their key.
+// The data of strings and wstrings is packed the way WritePackedData wants.
+void
+CompressRawSample( const void * iData,
+                   std::size_t iNumBytes,
+                   Util::PlainOldDataType iPod,
+                   const AbcA::Dimensions & iDims,
+                   AbcA::RawArraySample & oRaw,
+                   int iLevel = 3 );
+
+//-*****************************************************************************
+// Same as WriteData for the bytes of a raw sample, iPod is the POD of the
+// property they are written to and iCompressed whether it is compressed.
+WrittenSampleIDPtr
+WriteRawData( WrittenSampleMap &iMap,
+              Ogawa::OGroupPtr iGroup,
+              const AbcA::RawArraySample &iSamp,
+              const AbcA::ArraySample::Key &iKey,
+              Util::PlainOldDataType iPod,
+              bool iCompressed,
+              std::size_t iNumPods,
+              BlobStore * iStore = NULL );
+
+//-*****************************************************************************
+// Same as WriteData for string and wstring samples whose iNumBytes of data
+// are already packed the way they are stored, each string followed by a
+// NULL and wstring characters as 32 bit integers.
+WrittenSampleIDPtr
+WritePackedData( WrittenSampleMap &iMap,
+                 Ogawa::OGroupPtr iGroup,
+                 const void * iPacked,
+                 std::size_t iNumBytes,
+                 const AbcA::ArraySample::Key &iKey,
+                 std::size_t iNumPods,
+                 BlobStore * iStore = NULL );
 
 //-*****************************************************************************
 void
@@ -83,6 +148,8 @@ WritePropertyInfo( std::vector< Util::uint8_t > & ioData,
                    const AbcA::PropertyHeader &iHeader,
                    bool isScalarLike,
                    bool isHomogenous,
+                   bool isExternal,
+                   bool isCompressed,
                    Util::uint32_t iTimeSamplingIndex,
                    Util::uint32_t iNumSamples,
                    Util::uint32_t iFirstChangedIndex,
@@ -95,6 +162,52 @@ WriteObjectHeader( std::vector< Util::uint8_t > & ioData,
                    const AbcA::ObjectHeader &iHeader,
                    MetaDataMapPtr iMap );
 
+//-*****************************************************************************
+// Reads back the samples a scalar or array property wrote before its archive
+// was reopened for appending.  Each stored sample gets a WrittenSampleID
+// whose data is the existing data wrapped via iWrapper, and for array
+// properties oDims gets the dimensions of each stored sample.
+void
+ReadWrittenSamples( Ogawa::IGroupPtr iGroup,
+                    Ogawa::OGroupPtr iWrapper,
+                    PropertyHeaderPtr iHeader,
+                    std::vector< WrittenSampleIDPtr > & oSamples,
+                    std::vector< AbcA::Dimensions > & oDims );
+
+//-*****************************************************************************
+// Replays the running hash ApwImpl and SpwImpl accumulate as samples are set,
+// over every sample index of what ReadWrittenSamples returned.
+Util::Digest
+HashWrittenSamples( PropertyHeaderPtr iHeader,
+                    const std::vector< WrittenSampleIDPtr > & iSamples,
+                    const std::vector< AbcA::Dimensions > & iDims );
+
+//-*****************************************************************************
+// Adds every child of iExisting to iGroup by position without copying it.
+void
+CopyExistingChildren( Ogawa::IGroupPtr iExisting,
+                      Ogawa::OGroupPtr iGroup );
+
+//-*****************************************************************************
+// The hash a property writer hands to its parent via fillHash, computed for a
+// property that was written before the archive was reopened for appending.
+void
+HashExistingProperty( Ogawa::IGroupPtr iGroup,
+                      PropertyHeaderPtr iHeader,
+                      ArImpl & iArchive,
+                      Util::uint64_t & oHash0,
+                      Util::uint64_t & oHash1 );
+
+//-*****************************************************************************
+// Same as HashExistingProperty but for objects, the hash of the properties
+// is stored with the headers so only the objects below are walked.
+void
+HashExistingObject( Ogawa::IGroupPtr iGroup,
+                    const AbcA::ObjectHeader & iHeader,
+                    ArImpl & iArchive,
+                    Util::uint64_t & oHash0,
+                    Util::uint64_t & oHash1 );
+
 //-*****************************************************************************
 void
 WriteTimeSampling( std::vector< Util::uint8_t > & ioData,
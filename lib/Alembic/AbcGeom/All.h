@@ -38,6 +38,7 @@
 #define Alembic_AbcGeom_All_h
 
 #include <Alembic/AbcGeom/ArchiveBounds.h>
+#include <Alembic/AbcGeom/ChildBounds.h>
 
 #include <Alembic/AbcGeom/GeometryScope.h>
 
@@ -82,4 +83,6 @@
 
 #include <Alembic/AbcGeom/Visibility.h>
 
+#include <Alembic/AbcGeom/Interpolation.h>
+
 #endif
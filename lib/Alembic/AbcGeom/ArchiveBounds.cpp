@@ -35,6 +35,11 @@
 //-*****************************************************************************
 
 #include <Alembic/AbcGeom/ArchiveBounds.h>
+#include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/AbcGeom/IXform.h>
+#include <Alembic/Util/TaskPool.h>
+
+#include <ImathBoxAlgo.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -61,6 +66,233 @@ Abc::OBox3dProperty CreateOArchiveBounds( OArchive & iArchive,
 
 }
 
+namespace {
+
+//-*****************************************************************************
+// Min/max reduction over the packed xyz floats of a positions sample.
+// The points are consumed in blocks of kLanes so that every operation in the
+// inner loop is an independent element-wise min or max, which the compiler
+// turns into vector instructions without needing fast-math.
+Abc::Box3d ReducePositions( const Abc::V3f * iPos, std::size_t iNumPoints )
+{
+    Abc::Box3d ret;
+    if ( iNumPoints == 0 )
+    {
+        return ret;
+    }
+
+    static const std::size_t kLanes = 8;
+    static const std::size_t kWidth = kLanes * 3;
+
+    const float * p = reinterpret_cast< const float * >( iPos );
+
+    float lo[kWidth];
+    float hi[kWidth];
+    for ( std::size_t j = 0; j < kWidth; ++j )
+    {
+        lo[j] = hi[j] = p[j % 3];
+    }
+
+    std::size_t numBlocks = iNumPoints / kLanes;
+    for ( std::size_t b = 0; b < numBlocks; ++b )
+    {
+        const float * block = p + b * kWidth;
+        for ( std::size_t j = 0; j < kWidth; ++j )
+        {
+            lo[j] = block[j] < lo[j] ? block[j] : lo[j];
+            hi[j] = block[j] > hi[j] ? block[j] : hi[j];
+        }
+    }
+
+    for ( std::size_t i = numBlocks * kLanes; i < iNumPoints; ++i )
+    {
+        for ( std::size_t k = 0; k < 3; ++k )
+        {
+            lo[k] = std::min( lo[k], p[i * 3 + k] );
+            hi[k] = std::max( hi[k], p[i * 3 + k] );
+        }
+    }
+
+    for ( std::size_t j = 3; j < kWidth; ++j )
+    {
+        lo[j % 3] = std::min( lo[j % 3], lo[j] );
+        hi[j % 3] = std::max( hi[j % 3], hi[j] );
+    }
+
+    ret.min = Abc::V3d( lo[0], lo[1], lo[2] );
+    ret.max = Abc::V3d( hi[0], hi[1], hi[2] );
+    return ret;
+}
+
+//-*****************************************************************************
+// Reads a stored bounds property, an empty box means there wasn't a usable
+// value (missing, unsampled, or written without volume).
+Abc::Box3d GetStoredBounds( const Abc::ICompoundProperty & iParent,
+                            const std::string & iName,
+                            const Abc::ISampleSelector & iSS )
+{
+    Abc::Box3d ret;
+    const AbcA::PropertyHeader * header = iParent.getPropertyHeader( iName );
+    if ( header && Abc::IBox3dProperty::matches( *header ) )
+    {
+        Abc::IBox3dProperty prop( iParent, iName );
+        if ( prop.getNumSamples() > 0 )
+        {
+            prop.get( ret, iSS );
+        }
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+Abc::Box3d ComputeBoundsFromP( const Abc::ICompoundProperty & iSchema,
+                               const Abc::ISampleSelector & iSS )
+{
+    const AbcA::PropertyHeader * header = iSchema.getPropertyHeader( "P" );
+    if ( !header || !Abc::IP3fArrayProperty::matches( *header ) )
+    {
+        return Abc::Box3d();
+    }
+
+    Abc::IP3fArrayProperty prop( iSchema, "P" );
+    if ( prop.getNumSamples() == 0 )
+    {
+        return Abc::Box3d();
+    }
+
+    Abc::P3fArraySamplePtr samp = prop.getValue( iSS );
+    if ( !samp || samp->size() == 0 )
+    {
+        return Abc::Box3d();
+    }
+
+    return ReducePositions( samp->get(), samp->size() );
+}
+
+//-*****************************************************************************
+Abc::Box3d VisitBounds( const Abc::IObject & iObj,
+                        const Abc::ISampleSelector & iSS,
+                        const Abc::M44d & iParentMatrix,
+                        HierarchyBoundsPolicy iPolicy )
+{
+    const AbcA::MetaData & md = iObj.getMetaData();
+
+    Abc::M44d matrix = iParentMatrix;
+    Abc::ICompoundProperty schemaProp;
+    bool isGeom = false;
+
+    if ( IXform::matches( md ) )
+    {
+        IXformSchema xform = IXform( iObj ).getSchema();
+        schemaProp = xform;
+
+        if ( !xform.isConstantIdentity() )
+        {
+            XformSample samp = xform.getValue( iSS );
+            if ( samp.getInheritsXforms() )
+            {
+                matrix = samp.getMatrix() * iParentMatrix;
+            }
+            else
+            {
+                matrix = samp.getMatrix();
+            }
+        }
+    }
+    else if ( IGeomBase::matches( md ) )
+    {
+        const AbcA::PropertyHeader * header =
+            iObj.getProperties().getPropertyHeader(
+                IGeomBase::getDefaultSchemaName() );
+        if ( header && header->isCompound() )
+        {
+            schemaProp = Abc::ICompoundProperty( iObj.getProperties(),
+                header->getName() );
+            isGeom = true;
+        }
+    }
+    else
+    {
+        // cameras and lights keep .childBnds in their schema, while the top
+        // of the archive keeps it directly on its properties
+        schemaProp = iObj.getProperties();
+        const AbcA::PropertyHeader * header =
+            schemaProp.getPropertyHeader( ".geom" );
+        if ( header && header->isCompound() )
+        {
+            schemaProp = Abc::ICompoundProperty( schemaProp, ".geom" );
+        }
+    }
+
+    Abc::Box3d bounds;
+
+    if ( isGeom )
+    {
+        Abc::Box3d self;
+        if ( iPolicy != kComputeFromPositions )
+        {
+            self = GetStoredBounds( schemaProp, ".selfBnds", iSS );
+        }
+
+        if ( self.isEmpty() )
+        {
+            self = ComputeBoundsFromP( schemaProp, iSS );
+        }
+
+        if ( !self.isEmpty() )
+        {
+            bounds.extendBy( Imath::transform( self, matrix ) );
+        }
+    }
+
+    if ( iPolicy == kUseStoredBounds && schemaProp.valid() )
+    {
+        Abc::Box3d childBounds = GetStoredBounds( schemaProp, ".childBnds",
+                                                  iSS );
+        if ( !childBounds.isEmpty() )
+        {
+            bounds.extendBy( Imath::transform( childBounds, matrix ) );
+            return bounds;
+        }
+    }
+
+    std::size_t numChildren = iObj.getNumChildren();
+    std::vector< Abc::Box3d > childBounds( numChildren );
+
+    Util::ParallelFor( 0, numChildren,
+        [&]( std::size_t i )
+        {
+            childBounds[i] = VisitBounds( iObj.getChild( i ), iSS, matrix,
+                                          iPolicy );
+        } );
+
+    for ( std::size_t i = 0; i < numChildren; ++i )
+    {
+        if ( !childBounds[i].isEmpty() )
+        {
+            bounds.extendBy( childBounds[i] );
+        }
+    }
+
+    return bounds;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+Abc::Box3d GetHierarchyBounds( const Abc::IObject & iObj,
+                               const Abc::ISampleSelector &iSS,
+                               const Abc::M44d & iParentMatrix,
+                               HierarchyBoundsPolicy iPolicy )
+{
+    if ( !iObj.valid() )
+    {
+        return Abc::Box3d();
+    }
+
+    return VisitBounds( iObj, iSS, iParentMatrix, iPolicy );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace AbcGeom
 } // End namespace Alembic
@@ -60,6 +60,34 @@ CreateOArchiveBounds( OArchive & iArchive,
                       const Argument &iArg1 = Argument(),
                       const Argument &iArg2 = Argument() );
 
+//! How GetHierarchyBounds should treat the bounds stored in the archive.
+enum HierarchyBoundsPolicy
+{
+    //! Use .childBnds to skip whole subtrees and .selfBnds for geometry,
+    //! only reading positions when no usable self bounds were written.
+    kUseStoredBounds,
+
+    //! Ignore .childBnds and visit every object, but still use .selfBnds.
+    kIgnoreChildBounds,
+
+    //! Ignore every stored bounds property and compute the bounds of all
+    //! geometry from its positions.
+    kComputeFromPositions
+};
+
+//! Computes the bounds of iObj and everything beneath it at iSS.
+//! Transforms are composed on top of iParentMatrix and the result is
+//! expressed in that space, so for world space bounds pass the world matrix
+//! of iObj's parent (identity when iObj is the top of the archive).
+//! Stored bounds are used according to iPolicy so that only the geometry
+//! without them has to be read, and sibling subtrees are visited in
+//! parallel on the default Util::TaskPool.
+ALEMBIC_EXPORT Abc::Box3d
+GetHierarchyBounds( const Abc::IObject & iObj,
+                    const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                    const Abc::M44d & iParentMatrix = Abc::M44d(),
+                    HierarchyBoundsPolicy iPolicy = kUseStoredBounds );
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
@@ -0,0 +1,462 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/ChildBounds.h>
+
+#include <ImathBoxAlgo.h>
+
+#include <algorithm>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! The nodes of one archive, owned by the handle EnableChildBoundsPropagation
+//! gives back for it, and found from the archive with getExtension.  The
+//! nodes themselves are owned by their schemas and children, this only keeps
+//! the top of the archive, which is written out when the handle is released.
+class ChildBoundsArchive
+    : Util::noncopyable
+    , public Util::enable_shared_from_this< ChildBoundsArchive >
+{
+public:
+    ChildBoundsArchive( AbcA::ArchiveWriterPtr iArchive )
+        : m_archive( iArchive ) {}
+
+    ~ChildBoundsArchive()
+    {
+        // write the top, if nothing under it is still open, and then let
+        // the archive be written out
+        m_top.reset();
+        m_archive.reset();
+    }
+
+    //! Returns the node for iObject, creating it if need be.
+    ChildBoundsNodePtr getNode( AbcA::ObjectWriterPtr iObject )
+    {
+        // declared first so it is let go of after the lock, a node that
+        // goes away takes the lock to be forgotten
+        ChildBoundsNodePtr node;
+        Util::scoped_lock l( m_lock );
+
+        node = lookup( iObject.get() );
+        if ( !node )
+        {
+            AbcA::ObjectWriterPtr parent = iObject->getParent();
+            if ( !parent )
+            {
+                return getAncestor( iObject );
+            }
+
+            node.reset( new ChildBoundsNode( getAncestor( parent ),
+                                             shared_from_this(),
+                                             iObject.get() ) );
+            m_nodes[iObject.get()] = node;
+        }
+
+        return node;
+    }
+
+    //! Called by a node as it goes away.
+    void forget( AbcA::ObjectWriter * iObject )
+    {
+        Util::scoped_lock l( m_lock );
+        NodeMap::iterator it = m_nodes.find( iObject );
+
+        // a new object at the same address may have a node already
+        if ( it != m_nodes.end() && it->second.expired() )
+        {
+            m_nodes.erase( it );
+        }
+    }
+
+    AbcA::ArchiveWriterPtr m_archive;
+
+private:
+    ChildBoundsNodePtr lookup( AbcA::ObjectWriter * iObject )
+    {
+        NodeMap::iterator it = m_nodes.find( iObject );
+        if ( it == m_nodes.end() )
+        {
+            return ChildBoundsNodePtr();
+        }
+        return it->second.lock();
+    }
+
+    // Plain objects, and schemas that don't take part (cameras, lights...)
+    // have no node of their own, so their children report straight to the
+    // nearest ancestor that does, or to the top of the archive.
+    ChildBoundsNodePtr getAncestor( AbcA::ObjectWriterPtr iObject )
+    {
+        ChildBoundsNodePtr node = lookup( iObject.get() );
+        if ( node )
+        {
+            return node;
+        }
+
+        AbcA::ObjectWriterPtr parent = iObject->getParent();
+        if ( parent )
+        {
+            return getAncestor( parent );
+        }
+
+        if ( !m_top )
+        {
+            m_top.reset( new ChildBoundsNode( ChildBoundsNodePtr(),
+                                              shared_from_this(),
+                                              iObject.get() ) );
+            m_top->m_schema = iObject->getProperties();
+            m_nodes[iObject.get()] = m_top;
+        }
+        return m_top;
+    }
+
+    typedef std::map< AbcA::ObjectWriter *,
+                      Util::weak_ptr< ChildBoundsNode > > NodeMap;
+
+    Util::mutex m_lock;
+    NodeMap m_nodes;
+    ChildBoundsNodePtr m_top;
+};
+
+namespace {
+
+//-*****************************************************************************
+// Forwards everything to the real .selfBnds writer, and records the bounds
+// on the node as they go by.
+class SelfBoundsWriter
+    : public AbcA::ScalarPropertyWriter
+    , public Util::enable_shared_from_this< SelfBoundsWriter >
+{
+public:
+    SelfBoundsWriter( AbcA::ScalarPropertyWriterPtr iProp,
+                      ChildBoundsNodePtr iNode )
+        : m_prop( iProp ), m_node( iNode ) {}
+
+    virtual void setSample( const void *iSamp )
+    {
+        m_prop->setSample( iSamp );
+        m_node->addSelfBoundsSample(
+            *reinterpret_cast< const Abc::Box3d * >( iSamp ) );
+    }
+
+    virtual void setFromPreviousSample()
+    {
+        m_prop->setFromPreviousSample();
+        m_node->setSelfBoundsFromPrevious();
+    }
+
+    virtual size_t getNumSamples() { return m_prop->getNumSamples(); }
+
+    virtual void setTimeSamplingIndex( uint32_t iIndex )
+    {
+        m_prop->setTimeSamplingIndex( iIndex );
+        m_node->setTimeSamplingIndex( iIndex );
+    }
+
+    virtual const AbcA::PropertyHeader & getHeader() const
+    { return m_prop->getHeader(); }
+
+    virtual AbcA::ObjectWriterPtr getObject() { return m_prop->getObject(); }
+
+    virtual AbcA::CompoundPropertyWriterPtr getParent()
+    { return m_prop->getParent(); }
+
+    virtual AbcA::ScalarPropertyWriterPtr asScalarPtr()
+    { return shared_from_this(); }
+
+private:
+    AbcA::ScalarPropertyWriterPtr m_prop;
+    ChildBoundsNodePtr m_node;
+};
+
+//-*****************************************************************************
+template < class T >
+const T & held( const std::vector< T > & iVec, std::size_t iIndex )
+{
+    return iVec[ std::min( iIndex, iVec.size() - 1 ) ];
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void EnableChildBoundsPropagation( Abc::OArchive & iArchive )
+{
+    ABCA_ASSERT( iArchive.valid(),
+        "EnableChildBoundsPropagation() passed an invalid archive" );
+
+    AbcA::ArchiveWriterPtr archive = iArchive.getPtr();
+    Util::shared_ptr< ChildBoundsArchive > entry =
+        Util::static_pointer_cast< ChildBoundsArchive >(
+            archive->getExtension() );
+    if ( !entry )
+    {
+        entry.reset( new ChildBoundsArchive( archive ) );
+        archive->setExtension( entry );
+    }
+
+    // points at the archive itself, but shares ownership with the entry
+    iArchive = Abc::OArchive(
+        AbcA::ArchiveWriterPtr( entry, entry->m_archive.get() ),
+        Abc::kWrapExisting, iArchive.getErrorHandlerPolicy() );
+}
+
+//-*****************************************************************************
+ChildBoundsNodePtr
+ChildBoundsNode::get( AbcA::CompoundPropertyWriterPtr iSchema,
+                      uint32_t iTimeSamplingIndex )
+{
+    if ( !iSchema )
+    {
+        return ChildBoundsNodePtr();
+    }
+
+    AbcA::ObjectWriterPtr object = iSchema->getObject();
+    Util::shared_ptr< ChildBoundsArchive > archive =
+        Util::static_pointer_cast< ChildBoundsArchive >(
+            object->getArchive()->getExtension() );
+    if ( !archive )
+    {
+        return ChildBoundsNodePtr();
+    }
+
+    ChildBoundsNodePtr node = archive->getNode( object );
+    node->m_schema = iSchema;
+    node->m_tsIdx = iTimeSamplingIndex;
+    return node;
+}
+
+//-*****************************************************************************
+ChildBoundsNode::ChildBoundsNode(
+    ChildBoundsNodePtr iParent,
+    Util::shared_ptr< ChildBoundsArchive > iArchive,
+    AbcA::ObjectWriter * iObject )
+    : m_object( iObject )
+    , m_archive( iArchive )
+    , m_parent( iParent )
+    , m_tsIdx( 0 )
+    , m_isXform( false )
+    , m_inheritsXforms( true )
+    , m_isGeom( false )
+    , m_childTsIdx( 0 )
+    , m_hasChildren( false )
+    , m_isUnknown( false )
+{
+}
+
+//-*****************************************************************************
+ChildBoundsNode::~ChildBoundsNode()
+{
+    // the last schema or child letting go of us can be during stack
+    // unwinding, so never let anything escape
+    try
+    {
+        close();
+    }
+    catch ( ... )
+    {
+    }
+
+    Util::shared_ptr< ChildBoundsArchive > archive = m_archive.lock();
+    if ( archive )
+    {
+        archive->forget( m_object );
+    }
+}
+
+//-*****************************************************************************
+void ChildBoundsNode::close()
+{
+    if ( m_isUnknown )
+    {
+        if ( m_parent )
+        {
+            m_parent->m_isUnknown = true;
+        }
+        return;
+    }
+
+    writeChildBounds();
+
+    if ( !m_parent )
+    {
+        return;
+    }
+
+    std::vector< Abc::Box3d > bounds;
+    uint32_t tsIdx = m_childTsIdx;
+
+    if ( m_isGeom && !m_selfBounds.empty() )
+    {
+        tsIdx = m_tsIdx;
+        bounds.resize( std::max( m_selfBounds.size(),
+                                 m_childBounds.size() ) );
+        for ( std::size_t i = 0; i < bounds.size(); ++i )
+        {
+            bounds[i] = held( m_selfBounds, i );
+            if ( m_hasChildren )
+            {
+                bounds[i].extendBy( held( m_childBounds, i ) );
+            }
+        }
+    }
+    else if ( m_isXform && m_hasChildren && !m_matrices.empty() )
+    {
+        // the matrix is in world space, and the parent's isn't known here
+        if ( !m_inheritsXforms )
+        {
+            m_parent->m_isUnknown = true;
+            return;
+        }
+
+        if ( m_matrices.size() > 1 )
+        {
+            tsIdx = m_tsIdx;
+        }
+
+        bounds.resize( std::max( m_matrices.size(),
+                                 m_childBounds.size() ) );
+        for ( std::size_t i = 0; i < bounds.size(); ++i )
+        {
+            bounds[i] = Imath::transform( held( m_childBounds, i ),
+                                          held( m_matrices, i ) );
+        }
+    }
+    else if ( m_hasChildren )
+    {
+        bounds = m_childBounds;
+    }
+
+    if ( !bounds.empty() )
+    {
+        m_parent->mergeChild( bounds, tsIdx );
+    }
+}
+
+//-*****************************************************************************
+void ChildBoundsNode::addXformSample( const Abc::M44d & iMatrix,
+                                      bool iInheritsXforms )
+{
+    m_isXform = true;
+    m_inheritsXforms = m_inheritsXforms && iInheritsXforms;
+    m_matrices.push_back( iMatrix );
+}
+
+//-*****************************************************************************
+void ChildBoundsNode::setXformFromPrevious()
+{
+    m_isXform = true;
+    m_matrices.push_back( m_matrices.empty() ?
+        Abc::M44d() : m_matrices.back() );
+}
+
+//-*****************************************************************************
+void ChildBoundsNode::addSelfBoundsSample( const Abc::Box3d & iBounds )
+{
+    m_isGeom = true;
+    m_selfBounds.push_back( iBounds );
+}
+
+//-*****************************************************************************
+void ChildBoundsNode::setSelfBoundsFromPrevious()
+{
+    m_isGeom = true;
+    m_selfBounds.push_back( m_selfBounds.empty() ?
+        Abc::Box3d() : m_selfBounds.back() );
+}
+
+//-*****************************************************************************
+AbcA::ScalarPropertyWriterPtr
+ChildBoundsNode::wrapSelfBounds( AbcA::ScalarPropertyWriterPtr iSelfBounds )
+{
+    m_isGeom = true;
+    return AbcA::ScalarPropertyWriterPtr(
+        new SelfBoundsWriter( iSelfBounds, shared_from_this() ) );
+}
+
+//-*****************************************************************************
+void ChildBoundsNode::mergeChild( const std::vector< Abc::Box3d > & iBounds,
+                                  uint32_t iTimeSamplingIndex )
+{
+    if ( !m_hasChildren )
+    {
+        m_hasChildren = true;
+        m_childTsIdx = iTimeSamplingIndex;
+    }
+
+    // samples past the end of the shorter of the two hold their last value
+    std::size_t numSamples = std::max( m_childBounds.size(), iBounds.size() );
+    if ( !m_childBounds.empty() )
+    {
+        m_childBounds.resize( numSamples, m_childBounds.back() );
+    }
+    else
+    {
+        m_childBounds.resize( numSamples );
+    }
+
+    for ( std::size_t i = 0; i < numSamples; ++i )
+    {
+        m_childBounds[i].extendBy( held( iBounds, i ) );
+    }
+}
+
+//-*****************************************************************************
+void ChildBoundsNode::writeChildBounds()
+{
+    if ( !m_hasChildren || !m_schema || m_childBounds.empty() ||
+         m_schema->getPropertyHeader( ".childBnds" ) != NULL )
+    {
+        return;
+    }
+
+    // an unanimated xform or geometry would squash animated children into
+    // its single sample, so use the children's sampling instead
+    std::size_t ownSamples = m_isXform ? m_matrices.size() :
+        m_selfBounds.size();
+    uint32_t tsIdx = ownSamples > 1 ? m_tsIdx : m_childTsIdx;
+
+    Abc::OBox3dProperty prop( m_schema, ".childBnds", tsIdx );
+    for ( std::size_t i = 0; i < m_childBounds.size(); ++i )
+    {
+        prop.set( m_childBounds[i] );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
@@ -0,0 +1,146 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_ChildBounds_h
+#define Alembic_AbcGeom_ChildBounds_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+class ChildBoundsNode;
+class ChildBoundsArchive;
+typedef Util::shared_ptr< ChildBoundsNode > ChildBoundsNodePtr;
+
+//! Turns on automatic .childBnds for everything written to iArchive from
+//! now on.  Each xform and geometry schema records the bounds and matrices
+//! it writes, and once an object's schema and everything under it have been
+//! released, its bounds are transformed and unioned into its nearest xform
+//! or geometry ancestor.  Xforms and geometry with children get a .childBnds
+//! property as that happens, and the top of the archive gets one when the
+//! archive is closed, unless one was already created by hand.  Samples are
+//! matched up by index, so the hierarchy is expected to share its sampling.
+//! An xform that doesn't inherit its parent's transform can't be put in its
+//! ancestors' space, so they don't get a .childBnds.
+//! iArchive is replaced with a handle on the same archive, and the archive is
+//! closed when the last copy of that handle is released.
+ALEMBIC_EXPORT void EnableChildBoundsPropagation( Abc::OArchive & iArchive );
+
+//-*****************************************************************************
+//! Writer side bookkeeping for EnableChildBoundsPropagation, one per object.
+//! It is held by the object's schema and by the nodes of the objects under
+//! it, and when the last of those lets go it writes .childBnds and passes its
+//! bounds on to its parent.
+//! This is used by the schemas and is not usually needed directly.
+class ALEMBIC_EXPORT ChildBoundsNode
+    : Util::noncopyable
+    , public Util::enable_shared_from_this< ChildBoundsNode >
+{
+public:
+    //! Returns the node of the object that owns iSchema, or an empty
+    //! pointer if propagation wasn't enabled for its archive.
+    //! iTimeSamplingIndex is what the samples recorded here are using.
+    static ChildBoundsNodePtr get( AbcA::CompoundPropertyWriterPtr iSchema,
+                                   uint32_t iTimeSamplingIndex );
+
+    ~ChildBoundsNode();
+
+    void addXformSample( const Abc::M44d & iMatrix,
+                         bool iInheritsXforms = true );
+    void setXformFromPrevious();
+
+    void addSelfBoundsSample( const Abc::Box3d & iBounds );
+    void setSelfBoundsFromPrevious();
+
+    //! Returns a writer that forwards everything to iSelfBounds and records
+    //! each sample set through it on this node.
+    AbcA::ScalarPropertyWriterPtr
+    wrapSelfBounds( AbcA::ScalarPropertyWriterPtr iSelfBounds );
+
+    void setTimeSamplingIndex( uint32_t iTimeSamplingIndex )
+    { m_tsIdx = iTimeSamplingIndex; }
+
+private:
+    friend class ChildBoundsArchive;
+
+    ChildBoundsNode( ChildBoundsNodePtr iParent,
+                     Util::shared_ptr< ChildBoundsArchive > iArchive,
+                     AbcA::ObjectWriter * iObject );
+
+    void mergeChild( const std::vector< Abc::Box3d > & iBounds,
+                     uint32_t iTimeSamplingIndex );
+
+    //! Called once every node under this one has been: writes .childBnds if
+    //! needed and merges into the parent node.
+    void close();
+
+    void writeChildBounds();
+
+    // kept so the node can be forgotten by the archive, never dereferenced
+    AbcA::ObjectWriter * m_object;
+    Util::weak_ptr< ChildBoundsArchive > m_archive;
+
+    AbcA::CompoundPropertyWriterPtr m_schema;
+    ChildBoundsNodePtr m_parent;
+
+    uint32_t m_tsIdx;
+
+    bool m_isXform;
+    bool m_inheritsXforms;
+    std::vector< Abc::M44d > m_matrices;
+
+    bool m_isGeom;
+    std::vector< Abc::Box3d > m_selfBounds;
+
+    uint32_t m_childTsIdx;
+    bool m_hasChildren;
+    std::vector< Abc::Box3d > m_childBounds;
+
+    // something under this node can't be put in its space
+    bool m_isUnknown;
+};
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
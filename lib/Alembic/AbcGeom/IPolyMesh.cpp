@@ -40,6 +40,92 @@ namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+namespace {
+
+//-*****************************************************************************
+// Topologies that are in use, by the keys of their indices and counts.
+// The keys are digests of all of the stored data (zstd compressed samples
+// are hashed in full, not keyed by their leading bytes), so the same
+// topology is shared no matter which mesh, sample or archive it was read
+// from, and different ones never are.
+class TopologyCache
+{
+public:
+    TopologyCache() : m_pruneSize( 64 ) {}
+
+    static TopologyCache & get()
+    {
+        static TopologyCache cache;
+        return cache;
+    }
+
+    MeshTopologyPtr find( const AbcA::ArraySampleKey & iIndicesKey,
+                          const AbcA::ArraySampleKey & iCountsKey )
+    {
+        Util::scoped_lock l( m_lock );
+        TopologyMap::iterator it =
+            m_topologies.find( std::make_pair( iIndicesKey, iCountsKey ) );
+        if ( it != m_topologies.end() )
+        {
+            return it->second.lock();
+        }
+        return MeshTopologyPtr();
+    }
+
+    // returns what's already in the cache if another thread got there first
+    MeshTopologyPtr store( MeshTopologyPtr iTopology )
+    {
+        Util::scoped_lock l( m_lock );
+
+        Util::weak_ptr< const MeshTopology > & entry = m_topologies[
+            std::make_pair( iTopology->getFaceIndicesKey(),
+                            iTopology->getFaceCountsKey() ) ];
+
+        MeshTopologyPtr existing = entry.lock();
+        if ( existing )
+        {
+            return existing;
+        }
+
+        entry = iTopology;
+
+        if ( m_topologies.size() >= m_pruneSize )
+        {
+            prune();
+        }
+
+        return iTopology;
+    }
+
+private:
+    typedef std::map< std::pair< AbcA::ArraySampleKey, AbcA::ArraySampleKey >,
+                      Util::weak_ptr< const MeshTopology > > TopologyMap;
+
+    void prune()
+    {
+        TopologyMap::iterator it = m_topologies.begin();
+        while ( it != m_topologies.end() )
+        {
+            if ( it->second.expired() )
+            {
+                m_topologies.erase( it++ );
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        m_pruneSize = std::max< std::size_t >( 64, m_topologies.size() * 2 );
+    }
+
+    Util::mutex m_lock;
+    TopologyMap m_topologies;
+    std::size_t m_pruneSize;
+};
+
+} // End anonymous namespace
+
 //-*****************************************************************************
 MeshTopologyVariance IPolyMeshSchema::getTopologyVariance() const
 {
@@ -67,6 +153,100 @@ MeshTopologyVariance IPolyMeshSchema::getTopologyVariance() const
     return kConstantTopology;
 }
 
+//-*****************************************************************************
+MeshTopologyPtr
+IPolyMeshSchema::getTopology( const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getTopology()" );
+
+    AbcA::ArraySampleKey indicesKey = AbcA::ArraySampleKey();
+    AbcA::ArraySampleKey countsKey = AbcA::ArraySampleKey();
+    bool haveKeys = m_indicesProperty.getKey( indicesKey, iSS ) &&
+                    m_countsProperty.getKey( countsKey, iSS );
+
+    if ( haveKeys )
+    {
+        MeshTopologyPtr found =
+            TopologyCache::get().find( indicesKey, countsKey );
+        if ( found )
+        {
+            return found;
+        }
+    }
+
+    Abc::Int32ArraySamplePtr indices;
+    Abc::Int32ArraySamplePtr counts;
+    m_indicesProperty.get( indices, iSS );
+    m_countsProperty.get( counts, iSS );
+
+    MeshTopologyPtr ret( new MeshTopology( indices, counts,
+                                           indicesKey, countsKey ) );
+
+    // without keys there is nothing to share it by
+    if ( !haveKeys )
+    {
+        return ret;
+    }
+
+    return TopologyCache::get().store( ret );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+
+    return MeshTopologyPtr();
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getWithSharedTopology( Sample &oSample,
+    const Abc::ISampleSelector &iSS ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getWithSharedTopology()" );
+
+    MeshTopologyPtr topology = getTopology( iSS );
+    if ( topology )
+    {
+        oSample.m_indices = topology->getFaceIndices();
+        oSample.m_counts = topology->getFaceCounts();
+    }
+
+    m_positionsProperty.get( oSample.m_positions, iSS );
+    m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        m_velocitiesProperty.get( oSample.m_velocities, iSS );
+    }
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void IPolyMeshSchema::getParallel( Sample &oSample,
+                                   const Abc::ISampleSelector &iSS,
+                                   Util::TaskPool &iPool ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "IPolyMeshSchema::getParallel()" );
+
+    Util::TaskGroup group( iPool );
+
+    // the arrays are spread out, each read fills in its own member
+    group.run( [&]() { m_indicesProperty.get( oSample.m_indices, iSS ); } );
+    group.run( [&]() { m_countsProperty.get( oSample.m_counts, iSS ); } );
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        group.run( [&]()
+            { m_velocitiesProperty.get( oSample.m_velocities, iSS ); } );
+    }
+
+    // and the calling thread reads the rest in the meantime
+    m_positionsProperty.get( oSample.m_positions, iSS );
+    m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
+
+    group.wait();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
 //-*****************************************************************************
 void IPolyMeshSchema::init( const Abc::Argument &iArg0,
                             const Abc::Argument &iArg1 )
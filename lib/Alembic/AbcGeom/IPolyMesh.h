@@ -43,11 +43,44 @@
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/Util/TaskPool.h>
 
 namespace Alembic {
 namespace AbcGeom {
 namespace ALEMBIC_VERSION_NS {
 
+//-*****************************************************************************
+//! The face indices and counts of a mesh sample.  Every sample, and every
+//! mesh, whose topology was stored with the same data shares one of these,
+//! so the arrays are only read and decompressed once.
+class MeshTopology
+{
+public:
+    MeshTopology( Abc::Int32ArraySamplePtr iIndices,
+                  Abc::Int32ArraySamplePtr iCounts,
+                  const AbcA::ArraySampleKey & iIndicesKey,
+                  const AbcA::ArraySampleKey & iCountsKey )
+      : m_indices( iIndices ), m_counts( iCounts ),
+        m_indicesKey( iIndicesKey ), m_countsKey( iCountsKey ) {}
+
+    Abc::Int32ArraySamplePtr getFaceIndices() const { return m_indices; }
+    Abc::Int32ArraySamplePtr getFaceCounts() const { return m_counts; }
+
+    //! The stored digests that identify this topology.
+    const AbcA::ArraySampleKey & getFaceIndicesKey() const
+    { return m_indicesKey; }
+    const AbcA::ArraySampleKey & getFaceCountsKey() const
+    { return m_countsKey; }
+
+private:
+    Abc::Int32ArraySamplePtr m_indices;
+    Abc::Int32ArraySamplePtr m_counts;
+    AbcA::ArraySampleKey m_indicesKey;
+    AbcA::ArraySampleKey m_countsKey;
+};
+
+typedef Util::shared_ptr< const MeshTopology > MeshTopologyPtr;
+
 //-*****************************************************************************
 class ALEMBIC_EXPORT IPolyMeshSchema
     : public IGeomBaseSchema<PolyMeshSchemaInfo>
@@ -197,6 +230,15 @@ public:
         ALEMBIC_ABC_SAFE_CALL_END();
     }
 
+    //! Same as get(), but the positions, face indices, face counts and
+    //! velocities are read and decompressed at the same time on iPool, and
+    //! have all been read when this returns.  Each read takes its own stream
+    //! from the archive, so how many streams it was opened with still limits
+    //! how many read the file at once.
+    void getParallel( Sample &oSample,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      Util::TaskPool &iPool = Util::TaskPool::getDefault() ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -204,6 +246,26 @@ public:
         return smp;
     }
 
+    //! Returns the face indices and counts at iSS.  Only the stored keys
+    //! are read when the same topology has already been fetched, by this
+    //! mesh or any other.
+    MeshTopologyPtr getTopology(
+        const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
+
+    //! Like get(), but the face indices and counts come from getTopology(),
+    //! so they are shared rather than read again for every sample.
+    void getWithSharedTopology( Sample &oSample,
+        const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
+
+    //! Reads just the positions, for when the topology is already known.
+    Abc::P3fArraySamplePtr getPositions(
+        const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
+    {
+        Abc::P3fArraySamplePtr ret;
+        m_positionsProperty.get( ret, iSS );
+        return ret;
+    }
+
     IV2fGeomParam getUVsParam() const
     {
         return m_uvsParam;
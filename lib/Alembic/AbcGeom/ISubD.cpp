@@ -94,15 +94,107 @@ size_t ISubDSchema::getNumSamples() const
     return max;
 }
 
+//-*****************************************************************************
+namespace {
+
+// Runs iRead on iGroup if there is one, otherwise right away.
+template < class FUNC >
+void RunRead( Util::TaskGroup * iGroup, const FUNC & iRead )
+{
+    if ( iGroup )
+    {
+        iGroup->run( iRead );
+    }
+    else
+    {
+        iRead();
+    }
+}
+
+}
+
 //-*****************************************************************************
 void ISubDSchema::get( ISubDSchema::Sample &oSample,
                        const Abc::ISampleSelector &iSS ) const
 {
     ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::get()" );
 
-    m_positionsProperty.get( oSample.m_positions, iSS );
-    m_faceIndicesProperty.get( oSample.m_faceIndices, iSS );
-    m_faceCountsProperty.get( oSample.m_faceCounts, iSS );
+    read( oSample, iSS, NULL );
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void ISubDSchema::getParallel( ISubDSchema::Sample &oSample,
+                               const Abc::ISampleSelector &iSS,
+                               Util::TaskPool &iPool ) const
+{
+    ALEMBIC_ABC_SAFE_CALL_BEGIN( "ISubDSchema::getParallel()" );
+
+    Util::TaskGroup group( iPool );
+    read( oSample, iSS, &group );
+    group.wait();
+
+    ALEMBIC_ABC_SAFE_CALL_END();
+}
+
+//-*****************************************************************************
+void ISubDSchema::read( ISubDSchema::Sample &oSample,
+                        const Abc::ISampleSelector &iSS,
+                        Util::TaskGroup * iGroup ) const
+{
+    // the arrays are what is worth spreading out, each read fills in its
+    // own member of oSample
+    RunRead( iGroup, [&]()
+        { m_positionsProperty.get( oSample.m_positions, iSS ); } );
+    RunRead( iGroup, [&]()
+        { m_faceIndicesProperty.get( oSample.m_faceIndices, iSS ); } );
+    RunRead( iGroup, [&]()
+        { m_faceCountsProperty.get( oSample.m_faceCounts, iSS ); } );
+
+    if ( m_creaseIndicesProperty )
+    {
+        RunRead( iGroup, [&]()
+            { m_creaseIndicesProperty.get( oSample.m_creaseIndices, iSS ); } );
+    }
+
+    if ( m_creaseLengthsProperty )
+    {
+        RunRead( iGroup, [&]()
+            { m_creaseLengthsProperty.get( oSample.m_creaseLengths, iSS ); } );
+    }
+
+    if ( m_creaseSharpnessesProperty )
+    {
+        RunRead( iGroup, [&]()
+            { m_creaseSharpnessesProperty.get( oSample.m_creaseSharpnesses,
+                                               iSS ); } );
+    }
+
+    if ( m_cornerIndicesProperty )
+    {
+        RunRead( iGroup, [&]()
+            { m_cornerIndicesProperty.get( oSample.m_cornerIndices, iSS ); } );
+    }
+
+    if ( m_cornerSharpnessesProperty )
+    {
+        RunRead( iGroup, [&]()
+            { m_cornerSharpnessesProperty.get( oSample.m_cornerSharpnesses,
+                                               iSS ); } );
+    }
+
+    if ( m_holesProperty )
+    {
+        RunRead( iGroup, [&]()
+            { m_holesProperty.get( oSample.m_holes, iSS ); } );
+    }
+
+    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
+    {
+        RunRead( iGroup, [&]()
+            { m_velocitiesProperty.get( oSample.m_velocities, iSS ); } );
+    }
 
     if ( m_faceVaryingInterpolateBoundaryProperty )
     {
@@ -135,24 +227,6 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
 
     m_selfBoundsProperty.get( oSample.m_selfBounds, iSS );
 
-    if ( m_creaseIndicesProperty )
-    { m_creaseIndicesProperty.get( oSample.m_creaseIndices, iSS ); }
-
-    if ( m_creaseLengthsProperty )
-    { m_creaseLengthsProperty.get( oSample.m_creaseLengths, iSS ); }
-
-    if ( m_creaseSharpnessesProperty )
-    { m_creaseSharpnessesProperty.get( oSample.m_creaseSharpnesses, iSS ); }
-
-    if ( m_cornerIndicesProperty )
-    { m_cornerIndicesProperty.get( oSample.m_cornerIndices, iSS ); }
-
-    if ( m_cornerSharpnessesProperty )
-    { m_cornerSharpnessesProperty.get( oSample.m_cornerSharpnesses, iSS ); }
-
-    if ( m_holesProperty )
-    { m_holesProperty.get( oSample.m_holes, iSS ); }
-
     if ( m_subdSchemeProperty )
     {
         m_subdSchemeProperty.get( oSample.m_subdScheme, iSS );
@@ -161,11 +235,6 @@ void ISubDSchema::get( ISubDSchema::Sample &oSample,
     {
         oSample.m_subdScheme = "catmull-clark";
     }
-
-    if ( m_velocitiesProperty && m_velocitiesProperty.getNumSamples() > 0 )
-    { m_velocitiesProperty.get( oSample.m_velocities, iSS ); }
-
-    ALEMBIC_ABC_SAFE_CALL_END();
 }
 
 //-*****************************************************************************
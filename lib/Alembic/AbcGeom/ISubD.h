@@ -43,6 +43,7 @@
 #include <Alembic/AbcGeom/IGeomParam.h>
 #include <Alembic/AbcGeom/IFaceSet.h>
 #include <Alembic/AbcGeom/IGeomBase.h>
+#include <Alembic/Util/TaskPool.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -254,6 +255,15 @@ public:
     void get( Sample &iSamp,
               const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const;
 
+    //! Same as get(), but the array properties are read and decompressed
+    //! at the same time on iPool, while the calling thread reads the rest,
+    //! and everything has been read when this returns.  Each read takes its
+    //! own stream from the archive, so how many streams it was opened with
+    //! still limits how many read the file at once.
+    void getParallel( Sample &oSample,
+                      const Abc::ISampleSelector &iSS = Abc::ISampleSelector(),
+                      Util::TaskPool &iPool = Util::TaskPool::getDefault() ) const;
+
     Sample getValue( const Abc::ISampleSelector &iSS = Abc::ISampleSelector() ) const
     {
         Sample smp;
@@ -368,6 +378,10 @@ public:
 protected:
     void init( const Abc::Argument &iArg0, const Abc::Argument &iArg1 );
 
+    // reads the array properties on iGroup if it is set
+    void read( Sample &oSample, const Abc::ISampleSelector &iSS,
+               Util::TaskGroup * iGroup ) const;
+
     Abc::IP3fArrayProperty   m_positionsProperty;
     Abc::IInt32ArrayProperty m_faceIndicesProperty;
     Abc::IInt32ArrayProperty m_faceCountsProperty;
@@ -0,0 +1,329 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/Interpolation.h>
+
+#include <ImathMatrixAlgo.h>
+#include <ImathQuat.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+namespace {
+
+//-*****************************************************************************
+// Plain element-wise loops with no branches or aliasing assumptions inside,
+// so the compiler can turn them into vector blends.
+template < class T >
+void LerpLoop( const T * iA, const T * iB, T iAlpha, T * oValues,
+               std::size_t iCount )
+{
+    for ( std::size_t i = 0; i < iCount; ++i )
+    {
+        oValues[i] = iA[i] + ( iB[i] - iA[i] ) * iAlpha;
+    }
+}
+
+//-*****************************************************************************
+void LerpHalves( const float16_t * iA, const float16_t * iB, float32_t iAlpha,
+                 float16_t * oValues, std::size_t iCount )
+{
+    for ( std::size_t i = 0; i < iCount; ++i )
+    {
+        float32_t a = iA[i];
+        float32_t b = iB[i];
+        oValues[i] = a + ( b - a ) * iAlpha;
+    }
+}
+
+//-*****************************************************************************
+template < class T >
+T lerp( const T & iA, const T & iB, chrono_t iAlpha )
+{
+    return iA + ( iB - iA ) * iAlpha;
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void LerpValues( const float32_t * iA, const float32_t * iB,
+                 float32_t iAlpha, float32_t * oValues, std::size_t iCount )
+{
+    LerpLoop( iA, iB, iAlpha, oValues, iCount );
+}
+
+//-*****************************************************************************
+void LerpValues( const float64_t * iA, const float64_t * iB,
+                 float64_t iAlpha, float64_t * oValues, std::size_t iCount )
+{
+    LerpLoop( iA, iB, iAlpha, oValues, iCount );
+}
+
+//-*****************************************************************************
+bool LerpArraySamples( const AbcA::ArraySample & iA,
+                       const AbcA::ArraySample & iB,
+                       chrono_t iAlpha,
+                       void * oValues )
+{
+    const AbcA::DataType & dataType = iA.getDataType();
+    if ( dataType != iB.getDataType() || iA.size() != iB.size() )
+    {
+        return false;
+    }
+
+    std::size_t count = iA.size() * dataType.getExtent();
+
+    switch ( dataType.getPod() )
+    {
+    case Util::kFloat16POD:
+        LerpHalves( static_cast< const float16_t * >( iA.getData() ),
+                    static_cast< const float16_t * >( iB.getData() ),
+                    static_cast< float32_t >( iAlpha ),
+                    static_cast< float16_t * >( oValues ), count );
+        return true;
+
+    case Util::kFloat32POD:
+        LerpValues( static_cast< const float32_t * >( iA.getData() ),
+                    static_cast< const float32_t * >( iB.getData() ),
+                    static_cast< float32_t >( iAlpha ),
+                    static_cast< float32_t * >( oValues ), count );
+        return true;
+
+    case Util::kFloat64POD:
+        LerpValues( static_cast< const float64_t * >( iA.getData() ),
+                    static_cast< const float64_t * >( iB.getData() ),
+                    iAlpha, static_cast< float64_t * >( oValues ), count );
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+//-*****************************************************************************
+bool SamplesCanBlend( Abc::IArrayProperty iProp,
+                      index_t iFloor, index_t iCeil )
+{
+    if ( iFloor == iCeil || iProp.isConstant() )
+    {
+        return false;
+    }
+
+    Util::PlainOldDataType pod = iProp.getDataType().getPod();
+    if ( pod != Util::kFloat16POD && pod != Util::kFloat32POD &&
+         pod != Util::kFloat64POD )
+    {
+        return false;
+    }
+
+    // the dimensions are much cheaper to get than the data
+    Util::Dimensions floorDims;
+    Util::Dimensions ceilDims;
+    iProp.getDimensions( floorDims, Abc::ISampleSelector( iFloor ) );
+    iProp.getDimensions( ceilDims, Abc::ISampleSelector( iCeil ) );
+    if ( floorDims != ceilDims )
+    {
+        return false;
+    }
+
+    // Samples that were written with the same data share a key, and blending
+    // them would only give back the same values.  The key is a digest of all
+    // of the stored data, compressed samples included, so matching keys with
+    // matching dimensions are the same sample.
+    AbcA::ArraySampleKey floorKey;
+    AbcA::ArraySampleKey ceilKey;
+    if ( iProp.getKey( floorKey, Abc::ISampleSelector( iFloor ) ) &&
+         iProp.getKey( ceilKey, Abc::ISampleSelector( iCeil ) ) &&
+         floorKey == ceilKey )
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//-*****************************************************************************
+Abc::M44d InterpolateMatrix( const Abc::M44d & iA, const Abc::M44d & iB,
+                             chrono_t iAlpha )
+{
+    Abc::M44d a = iA;
+    Abc::M44d b = iB;
+    Abc::V3d scaleA, shearA, scaleB, shearB;
+
+    if ( !Imath::extractAndRemoveScalingAndShear( a, scaleA, shearA, false ) ||
+         !Imath::extractAndRemoveScalingAndShear( b, scaleB, shearB, false ) )
+    {
+        Abc::M44d ret;
+        LerpValues( iA.getValue(), iB.getValue(), iAlpha, ret.getValue(), 16 );
+        return ret;
+    }
+
+    Imath::Quatd rot = Imath::slerpShortestArc( Imath::extractQuat( a ),
+                                                Imath::extractQuat( b ),
+                                                iAlpha );
+
+    // Imath composes these as scale * shear * rotation * translation
+    Abc::M44d ret;
+    ret.setScale( lerp( scaleA, scaleB, iAlpha ) );
+
+    Abc::M44d shear;
+    shear.setShear( lerp( shearA, shearB, iAlpha ) );
+
+    ret = ret * shear * rot.toMatrix44();
+
+    Abc::V3d trans = lerp( iA.translation(), iB.translation(), iAlpha );
+    ret[3][0] = trans.x;
+    ret[3][1] = trans.y;
+    ret[3][2] = trans.z;
+
+    return ret;
+}
+
+//-*****************************************************************************
+Abc::M44d GetInterpolatedMatrix( const IXformSchema & iSchema,
+                                 const Abc::ISampleSelector & iSS )
+{
+    if ( !iSchema.valid() || iSchema.isConstant() )
+    {
+        return iSchema.valid() ? iSchema.getValue().getMatrix() : Abc::M44d();
+    }
+
+    index_t floorIdx = 0;
+    index_t ceilIdx = 0;
+    chrono_t alpha = iSS.getInterpolationIndices( iSchema.getTimeSampling(),
+        iSchema.getNumSamples(), floorIdx, ceilIdx );
+
+    XformSample samp;
+    iSchema.get( samp, Abc::ISampleSelector( floorIdx ) );
+
+    if ( floorIdx == ceilIdx )
+    {
+        return samp.getMatrix();
+    }
+
+    XformSample ceilSamp;
+    iSchema.get( ceilSamp, Abc::ISampleSelector( ceilIdx ) );
+
+    return InterpolateMatrix( samp.getMatrix(), ceilSamp.getMatrix(), alpha );
+}
+
+//-*****************************************************************************
+void ExtrapolatePositions( const V3f * iPositions, const V3f * iVelocities,
+                           float32_t iDt, V3f * oPositions, std::size_t iCount )
+{
+    // V3f is three packed floats, so run over the floats directly
+    const float32_t * p = reinterpret_cast< const float32_t * >( iPositions );
+    const float32_t * v = reinterpret_cast< const float32_t * >( iVelocities );
+    float32_t * o = reinterpret_cast< float32_t * >( oPositions );
+
+    for ( std::size_t i = 0, n = iCount * 3; i < n; ++i )
+    {
+        o[i] = p[i] + v[i] * iDt;
+    }
+}
+
+//-*****************************************************************************
+bool GetMotionBlurPositions( Abc::IP3fArrayProperty iPositions,
+                             Abc::IV3fArrayProperty iVelocities,
+                             bool iTopologyMatches,
+                             chrono_t iFrameTime,
+                             const std::vector<chrono_t> & iSampleTimes,
+                             std::vector< std::vector<V3f> > & oPositions )
+{
+    oPositions.resize( iSampleTimes.size() );
+
+    if ( !iPositions.valid() || iPositions.getNumSamples() == 0 )
+    {
+        for ( std::size_t i = 0; i < oPositions.size(); ++i )
+        {
+            oPositions[i].clear();
+        }
+        return false;
+    }
+
+    AbcA::TimeSamplingPtr ts = iPositions.getTimeSampling();
+    index_t numSamples = iPositions.getNumSamples();
+    index_t idx = Abc::ISampleSelector( iFrameTime ).getIndex( ts,
+                                                               numSamples );
+    chrono_t sampleTime = ts->getSampleTime( idx );
+
+    P3fArraySamplePtr pos;
+    V3fArraySamplePtr vel;
+
+    if ( iVelocities.valid() && iVelocities.getNumSamples() > 0 )
+    {
+        Abc::ISampleSelector velSS( sampleTime );
+        Util::Dimensions velDims;
+        Util::Dimensions posDims;
+        iVelocities.getDimensions( velDims, velSS );
+        iPositions.getDimensions( posDims, Abc::ISampleSelector( idx ) );
+
+        if ( velDims.numPoints() == posDims.numPoints() )
+        {
+            pos = iPositions.getValue( Abc::ISampleSelector( idx ) );
+            vel = iVelocities.getValue( velSS );
+        }
+    }
+
+    if ( !pos || !vel )
+    {
+        for ( std::size_t i = 0; i < iSampleTimes.size(); ++i )
+        {
+            GetInterpolatedValues( iPositions,
+                Abc::ISampleSelector( iSampleTimes[i] ), oPositions[i],
+                iTopologyMatches );
+        }
+        return false;
+    }
+
+    for ( std::size_t i = 0; i < iSampleTimes.size(); ++i )
+    {
+        oPositions[i].resize( pos->size() );
+        if ( pos->size() > 0 )
+        {
+            ExtrapolatePositions( pos->get(), vel->get(),
+                static_cast< float32_t >( iSampleTimes[i] - sampleTime ),
+                &oPositions[i].front(), pos->size() );
+        }
+    }
+
+    return true;
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace AbcGeom
+} // End namespace Alembic
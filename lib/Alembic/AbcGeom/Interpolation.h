@@ -0,0 +1,239 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_AbcGeom_Interpolation_h
+#define Alembic_AbcGeom_Interpolation_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/AbcGeom/Foundation.h>
+#include <Alembic/AbcGeom/IGeomParam.h>
+#include <Alembic/AbcGeom/IPoints.h>
+#include <Alembic/AbcGeom/IXform.h>
+
+namespace Alembic {
+namespace AbcGeom {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! oValues[i] = iA[i] + ( iB[i] - iA[i] ) * iAlpha for iCount values.
+//! oValues may be the same buffer as iA or iB.
+ALEMBIC_EXPORT void LerpValues( const float32_t * iA, const float32_t * iB,
+                                float32_t iAlpha, float32_t * oValues,
+                                std::size_t iCount );
+
+ALEMBIC_EXPORT void LerpValues( const float64_t * iA, const float64_t * iB,
+                                float64_t iAlpha, float64_t * oValues,
+                                std::size_t iCount );
+
+//! Blends two floating point array samples of the same type and size into
+//! oValues, which needs room for the whole sample.  Returns false, and
+//! leaves oValues alone, if the samples can't be blended.
+ALEMBIC_EXPORT bool LerpArraySamples( const AbcA::ArraySample & iA,
+                                      const AbcA::ArraySample & iB,
+                                      chrono_t iAlpha,
+                                      void * oValues );
+
+//! Returns whether samples iFloor and iCeil of iProp can be blended: they
+//! have to be floating point, have the same dimensions, and not have the
+//! same data, as told by their keys.
+ALEMBIC_EXPORT bool SamplesCanBlend( Abc::IArrayProperty iProp,
+                                     index_t iFloor, index_t iCeil );
+
+//-*****************************************************************************
+//! Decomposes both matrices into scale, shear, rotation and translation,
+//! blends those (slerping the rotation along the shortest arc) and puts
+//! them back together.  Matrices that can't be decomposed are blended
+//! element by element.
+ALEMBIC_EXPORT Abc::M44d InterpolateMatrix( const Abc::M44d & iA,
+                                            const Abc::M44d & iB,
+                                            chrono_t iAlpha );
+
+//! Returns the local matrix of iSchema at the requested time, interpolated
+//! between the samples on either side of it.
+ALEMBIC_EXPORT Abc::M44d
+GetInterpolatedMatrix( const IXformSchema & iSchema,
+                       const Abc::ISampleSelector & iSS );
+
+//-*****************************************************************************
+//! Fills oValues with iProp at the requested time, blended between the
+//! samples on either side of it when they can be (see SamplesCanBlend) and
+//! iTopologyMatches, otherwise with the nearest sample.
+//! oValues is reused so its storage can be kept around between calls.
+//! Returns true if the values were blended.
+template <class TRAITS>
+bool GetInterpolatedValues( const Abc::ITypedArrayProperty<TRAITS> & iProp,
+                            const Abc::ISampleSelector & iSS,
+                            std::vector<typename TRAITS::value_type> & oValues,
+                            bool iTopologyMatches = true )
+{
+    typedef typename Abc::ITypedArrayProperty<TRAITS>::sample_ptr_type
+        sample_ptr_type;
+
+    oValues.clear();
+
+    if ( !iProp.valid() || iProp.getNumSamples() == 0 )
+    {
+        return false;
+    }
+
+    index_t floorIdx = 0;
+    index_t ceilIdx = 0;
+    chrono_t alpha = iSS.getInterpolationIndices( iProp.getTimeSampling(),
+        iProp.getNumSamples(), floorIdx, ceilIdx );
+
+    bool blend = floorIdx != ceilIdx && iTopologyMatches &&
+        SamplesCanBlend( iProp, floorIdx, ceilIdx );
+
+    if ( !blend && alpha >= 0.5 )
+    {
+        floorIdx = ceilIdx;
+    }
+
+    sample_ptr_type floorSamp =
+        iProp.getValue( Abc::ISampleSelector( floorIdx ) );
+    oValues.assign( floorSamp->get(), floorSamp->get() + floorSamp->size() );
+
+    if ( !blend || oValues.empty() )
+    {
+        return false;
+    }
+
+    sample_ptr_type ceilSamp = iProp.getValue( Abc::ISampleSelector( ceilIdx ) );
+    return LerpArraySamples( *floorSamp, *ceilSamp, alpha, &oValues.front() );
+}
+
+//! Interpolates the values of a geom param.  Indexed params are only
+//! blended when their indices don't change, since the values otherwise
+//! don't line up from one sample to the next.
+template <class TRAITS>
+bool GetInterpolatedValues( ITypedGeomParam<TRAITS> & iParam,
+                            const Abc::ISampleSelector & iSS,
+                            std::vector<typename TRAITS::value_type> & oValues,
+                            bool iTopologyMatches = true )
+{
+    if ( !iParam.valid() )
+    {
+        oValues.clear();
+        return false;
+    }
+
+    if ( iParam.isIndexed() && !iParam.getIndexProperty().isConstant() )
+    {
+        iTopologyMatches = false;
+    }
+
+    return GetInterpolatedValues( iParam.getValueProperty(), iSS, oValues,
+                                  iTopologyMatches );
+}
+
+//-*****************************************************************************
+//! Whether point i of one sample is point i of the next.
+template <class SCHEMA>
+bool TopologyCanBlend( SCHEMA & iSchema )
+{
+    return iSchema.getTopologyVariance() != kHeterogenousTopology;
+}
+
+//! Points have no topology, so only the point counts are compared.
+inline bool TopologyCanBlend( IPointsSchema & iSchema )
+{
+    return true;
+}
+
+//! Interpolated positions of a mesh, subd, curves, nurbs or points schema.
+template <class SCHEMA>
+bool GetInterpolatedPositions( SCHEMA & iSchema,
+                               const Abc::ISampleSelector & iSS,
+                               std::vector<V3f> & oPositions )
+{
+    return GetInterpolatedValues( iSchema.getPositionsProperty(), iSS,
+                                  oPositions, TopologyCanBlend( iSchema ) );
+}
+
+//! Interpolated velocities, empty if the schema doesn't have any.
+template <class SCHEMA>
+bool GetInterpolatedVelocities( SCHEMA & iSchema,
+                                const Abc::ISampleSelector & iSS,
+                                std::vector<V3f> & oVelocities )
+{
+    return GetInterpolatedValues( iSchema.getVelocitiesProperty(), iSS,
+                                  oVelocities, TopologyCanBlend( iSchema ) );
+}
+
+//-*****************************************************************************
+//! oPositions[i] = iPositions[i] + iVelocities[i] * iDt for iCount points.
+//! oPositions may be the same buffer as iPositions.
+ALEMBIC_EXPORT void ExtrapolatePositions( const V3f * iPositions,
+                                          const V3f * iVelocities,
+                                          float32_t iDt,
+                                          V3f * oPositions,
+                                          std::size_t iCount );
+
+//! Fills oPositions with the positions at each of iSampleTimes, which are
+//! usually the shutter times around iFrameTime.
+//! When iVelocities has a sample matching the positions, a single position
+//! sample (the one nearest iFrameTime) is read and moved along the
+//! velocities to each time, and true is returned.  Otherwise every time is
+//! read, and interpolated, with GetInterpolatedValues and false is returned.
+ALEMBIC_EXPORT bool
+GetMotionBlurPositions( Abc::IP3fArrayProperty iPositions,
+                        Abc::IV3fArrayProperty iVelocities,
+                        bool iTopologyMatches,
+                        chrono_t iFrameTime,
+                        const std::vector<chrono_t> & iSampleTimes,
+                        std::vector< std::vector<V3f> > & oPositions );
+
+//! GetMotionBlurPositions for a mesh, subd, curves, nurbs or points schema.
+template <class SCHEMA>
+bool GetMotionBlurPositions( SCHEMA & iSchema,
+                             chrono_t iFrameTime,
+                             const std::vector<chrono_t> & iSampleTimes,
+                             std::vector< std::vector<V3f> > & oPositions )
+{
+    return GetMotionBlurPositions( iSchema.getPositionsProperty(),
+                                   iSchema.getVelocitiesProperty(),
+                                   TopologyCanBlend( iSchema ),
+                                   iFrameTime, iSampleTimes, oPositions );
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace AbcGeom
+} // End namespace Alembic
+
+#endif
@@ -40,6 +40,7 @@
 #include <Alembic/Abc/OSchema.h>
 #include <Alembic/AbcGeom/Foundation.h>
 #include <Alembic/AbcGeom/OGeomParam.h>
+#include <Alembic/AbcGeom/ChildBounds.h>
 
 namespace Alembic {
 namespace AbcGeom {
@@ -203,6 +204,15 @@ protected:
         m_selfBoundsProperty = Abc::OBox3dProperty( this->getPtr(), ".selfBnds",
                                                     iTsIndex );
 
+        // record the bounds as they are set, for the ancestors .childBnds
+        ChildBoundsNodePtr node = ChildBoundsNode::get( this->getPtr(),
+                                                        iTsIndex );
+        if ( node )
+        {
+            m_selfBoundsProperty = Abc::OBox3dProperty(
+                node->wrapSelfBounds( m_selfBoundsProperty.getPtr() ) );
+        }
+
         Abc::Box3d bnds;
         for ( size_t i = 0; i < iNumSamples; ++i )
         {
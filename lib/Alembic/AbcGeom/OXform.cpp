@@ -36,6 +36,7 @@
 
 #include <Alembic/AbcGeom/OXform.h>
 #include <Alembic/AbcGeom/XformOp.h>
+#include <Alembic/AbcGeom/ChildBounds.h>
 #include <algorithm>
 #define MAX_SCALAR_CHANS 256
 
@@ -79,6 +80,9 @@ public:
     AbcCoreAbstract::CompoundPropertyWriterPtr parent;
     std::vector< bool > animChans;
     AbcA::index_t tsIdx;
+
+    // only set when EnableChildBoundsPropagation was called on the archive
+    ChildBoundsNodePtr childBounds;
 };
 
 //-*****************************************************************************
@@ -222,6 +226,12 @@ void OXformSchema::set( XformSample &ioSamp )
 
     m_inheritsProperty.set( ioSamp.getInheritsXforms() );
 
+    if ( m_data->childBounds )
+    {
+        m_data->childBounds->addXformSample( ioSamp.getMatrix(),
+                                             ioSamp.getInheritsXforms() );
+    }
+
     if ( ! m_opsPWPtr ) { return; }
 
     std::vector<double> chanvals;
@@ -289,6 +299,11 @@ void OXformSchema::setFromPrevious()
 
     m_inheritsProperty.setFromPrevious();
 
+    if ( m_data->childBounds )
+    {
+        m_data->childBounds->setXformFromPrevious();
+    }
+
     m_opsPWPtr->setFromPreviousSample();
 
     if ( m_valsPWPtr )
@@ -340,6 +355,7 @@ void OXformSchema::init( const AbcA::index_t iTsIdx )
     m_data = Alembic::Util::shared_ptr< Data >( new Data() );
     m_data->parent = this->getPtr();
     m_data->tsIdx = iTsIdx;
+    m_data->childBounds = ChildBoundsNode::get( m_data->parent, iTsIdx );
 
     m_isIdentity = true;
 
@@ -429,6 +445,11 @@ void OXformSchema::setTimeSampling( uint32_t iIndex )
     if ( m_data )
     {
         m_data->tsIdx = iIndex;
+
+        if ( m_data->childBounds )
+        {
+            m_data->childBounds->setTimeSamplingIndex( iIndex );
+        }
     }
 
     ALEMBIC_ABC_SAFE_CALL_END();
@@ -0,0 +1,248 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <ImathBoxAlgo.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+using namespace Alembic::AbcGeom;
+
+namespace {
+
+const int32_t g_indices[] = { 0, 1, 2 };
+const int32_t g_counts[] = { 3 };
+
+//-*****************************************************************************
+// a single triangle spanning iBounds
+void setTriangle( OPolyMeshSchema & iSchema, const Box3d & iBounds )
+{
+    V3f verts[3];
+    verts[0] = V3f( iBounds.min );
+    verts[1] = V3f( iBounds.max );
+    verts[2] = V3f( iBounds.min.x, iBounds.max.y, iBounds.min.z );
+
+    OPolyMeshSchema::Sample samp( V3fArraySample( verts, 3 ),
+                                  Int32ArraySample( g_indices, 3 ),
+                                  Int32ArraySample( g_counts, 1 ) );
+    iSchema.set( samp );
+}
+
+Box3d unitBox( double iOffset )
+{
+    return Box3d( V3d( iOffset ), V3d( iOffset + 1.0 ) );
+}
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    EnableChildBoundsPropagation( archive );
+
+    TimeSampling ts( 1.0 / 24.0, 0.0 );
+    uint32_t tsIdx = archive.addTimeSampling( ts );
+
+    // top -> xf (animated translate) -> group (plain) -> mesh (moving)
+    //                                -> nested (scale) -> still mesh
+    OXform xf( archive.getTop(), "xf", tsIdx );
+    OObject group( xf, "group" );
+    OPolyMesh mesh( group, "mesh", tsIdx );
+
+    OXform nested( xf, "nested", tsIdx );
+    OPolyMesh still( nested, "still", tsIdx );
+
+    for ( size_t i = 0; i < 2; ++i )
+    {
+        XformSample xfSamp;
+        xfSamp.setTranslation( V3d( 10.0 * i, 0.0, 0.0 ) );
+        xf.getSchema().set( xfSamp );
+
+        XformSample nestedSamp;
+        nestedSamp.setScale( V3d( 2.0 ) );
+        nested.getSchema().set( nestedSamp );
+
+        setTriangle( mesh.getSchema(), unitBox( i ) );
+        setTriangle( still.getSchema(), unitBox( 0.0 ) );
+    }
+
+    // a hand made .childBnds is left alone
+    OXform manual( archive.getTop(), "manual", tsIdx );
+    manual.getSchema().getChildBoundsProperty().set( unitBox( 100.0 ) );
+    manual.getSchema().getChildBoundsProperty().set( unitBox( 100.0 ) );
+
+    OPolyMesh manualMesh( manual, "mesh", tsIdx );
+    setTriangle( manualMesh.getSchema(), unitBox( 0.0 ) );
+    setTriangle( manualMesh.getSchema(), unitBox( 0.0 ) );
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+
+    IXform xf( archive.getTop(), "xf" );
+    IBox3dProperty xfBnds = xf.getSchema().getChildBoundsProperty();
+    TESTING_ASSERT( xfBnds.valid() );
+    TESTING_ASSERT( xfBnds.getNumSamples() == 2 );
+
+    IXform nested( xf, "nested" );
+    IBox3dProperty nestedBnds = nested.getSchema().getChildBoundsProperty();
+    TESTING_ASSERT( nestedBnds.valid() );
+    TESTING_ASSERT( nestedBnds.getValue() == unitBox( 0.0 ) );
+
+    // the plain group doesn't get any, its mesh goes straight to xf
+    IObject group( xf, "group" );
+    TESTING_ASSERT( !group.getProperties().getPropertyHeader( ".childBnds" ) );
+
+    Box3d scaled( V3d( 0.0 ), V3d( 2.0 ) );
+    M44d translate;
+
+    for ( size_t i = 0; i < 2; ++i )
+    {
+        Box3d expected = unitBox( i );
+        expected.extendBy( scaled );
+        TESTING_ASSERT( xfBnds.getValue( i ) == expected );
+
+        translate.setTranslation( V3d( 10.0 * i, 0.0, 0.0 ) );
+        Box3d top = Imath::transform( expected, translate );
+        top.extendBy( unitBox( 0.0 ) );
+
+        IBox3dProperty topBnds = GetIArchiveBounds( archive );
+        TESTING_ASSERT( topBnds.valid() );
+        TESTING_ASSERT( topBnds.getValue( i ) == top );
+    }
+
+    IXform manual( archive.getTop(), "manual" );
+    TESTING_ASSERT( manual.getSchema().getChildBoundsProperty().getValue() ==
+                    unitBox( 100.0 ) );
+
+    // the reader can now cull without descending
+    TESTING_ASSERT( GetHierarchyBounds( xf, ISampleSelector( 1.0 / 24.0 ) ) ==
+                    GetHierarchyBounds( xf, ISampleSelector( 1.0 / 24.0 ),
+                                        M44d(), kIgnoreChildBounds ) );
+}
+
+//-*****************************************************************************
+void releasedEarlyTest( const std::string & iName )
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        EnableChildBoundsPropagation( archive );
+
+        // each top level object is done with before the next one is made
+        const char * names[] = { "a", "b", "c" };
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            OPolyMesh mesh( archive.getTop(), names[i] );
+            setTriangle( mesh.getSchema(), unitBox( 10.0 * i ) );
+        }
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    IBox3dProperty topBnds = GetIArchiveBounds( archive );
+    TESTING_ASSERT( topBnds.valid() );
+    TESTING_ASSERT( topBnds.getNumSamples() == 1 );
+    TESTING_ASSERT( topBnds.getValue() ==
+                    Box3d( V3d( 0.0 ), V3d( 21.0 ) ) );
+}
+
+//-*****************************************************************************
+void notInheritedTest( const std::string & iName )
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        EnableChildBoundsPropagation( archive );
+
+        OXform xf( archive.getTop(), "xf" );
+        XformSample xfSamp;
+        xfSamp.setTranslation( V3d( 5.0, 0.0, 0.0 ) );
+        xf.getSchema().set( xfSamp );
+
+        OXform world( xf, "world" );
+        XformSample worldSamp;
+        worldSamp.setTranslation( V3d( 1.0, 0.0, 0.0 ) );
+        worldSamp.setInheritsXforms( false );
+        world.getSchema().set( worldSamp );
+
+        OPolyMesh mesh( world, "mesh" );
+        setTriangle( mesh.getSchema(), unitBox( 0.0 ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    IXform xf( archive.getTop(), "xf" );
+    IXform world( xf, "world" );
+
+    // its own children are in its space, but it can't be put in xf's
+    TESTING_ASSERT( world.getSchema().getChildBoundsProperty().getValue() ==
+                    unitBox( 0.0 ) );
+    TESTING_ASSERT( !xf.getSchema().getChildBoundsProperty().valid() );
+    TESTING_ASSERT( !GetIArchiveBounds( archive,
+        ErrorHandler::kQuietNoopPolicy ).valid() );
+}
+
+//-*****************************************************************************
+void disabledTest( const std::string & iName )
+{
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        OXform xf( archive.getTop(), "xf" );
+        OPolyMesh mesh( xf, "mesh" );
+        setTriangle( mesh.getSchema(), unitBox( 0.0 ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    IXform xf( archive.getTop(), "xf" );
+    TESTING_ASSERT( !xf.getSchema().getChildBoundsProperty().valid() );
+    TESTING_ASSERT( !GetIArchiveBounds( archive,
+        ErrorHandler::kQuietNoopPolicy ).valid() );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string name = "childBounds.abc";
+    writeArchive( name );
+    readArchive( name );
+
+    releasedEarlyTest( "childBoundsReleasedEarly.abc" );
+    notInheritedTest( "childBoundsNotInherited.abc" );
+    disabledTest( "childBoundsDisabled.abc" );
+    return 0;
+}
@@ -0,0 +1,137 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <ImathBoxAlgo.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <Alembic/AbcGeom/Tests/MeshData.h>
+
+using namespace Alembic::AbcGeom;
+
+//-*****************************************************************************
+Box3d meshBounds()
+{
+    Box3d ret;
+    for ( size_t i = 0; i < g_numVerts; ++i )
+    {
+        ret.extendBy( V3d( g_verts[i*3], g_verts[i*3+1], g_verts[i*3+2] ) );
+    }
+    return ret;
+}
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+
+    OPolyMeshSchema::Sample meshSamp(
+        V3fArraySample( ( const V3f * )g_verts, g_numVerts ),
+        Int32ArraySample( g_indices, g_numIndices ),
+        Int32ArraySample( g_counts, g_numCounts ) );
+
+    // a translated mesh that has self bounds
+    OXform xf( archive.getTop(), "xf" );
+    XformSample xfSamp;
+    xfSamp.setTranslation( V3d( 10.0, 0.0, 0.0 ) );
+    xf.getSchema().set( xfSamp );
+
+    OPolyMesh mesh( xf, "mesh" );
+    mesh.getSchema().set( meshSamp );
+
+    // a scaled mesh under an xform with stored (deliberately too large)
+    // child bounds, so we can tell whether they were used
+    OXform stored( archive.getTop(), "stored" );
+    XformSample storedSamp;
+    storedSamp.setScale( V3d( 2.0, 2.0, 2.0 ) );
+    stored.getSchema().set( storedSamp );
+    stored.getSchema().getChildBoundsProperty().set(
+        Box3d( V3d( -100.0 ), V3d( 100.0 ) ) );
+
+    OPolyMesh storedMesh( stored, "mesh" );
+    storedMesh.getSchema().set( meshSamp );
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+
+    Box3d mesh = meshBounds();
+
+    M44d translate;
+    translate.setTranslation( V3d( 10.0, 0.0, 0.0 ) );
+    M44d scale;
+    scale.setScale( V3d( 2.0, 2.0, 2.0 ) );
+
+    IObject xf( archive.getTop(), "xf" );
+    Box3d xfBounds = GetHierarchyBounds( xf );
+    TESTING_ASSERT( xfBounds == Imath::transform( mesh, translate ) );
+
+    // reading the positions has to agree with the stored self bounds
+    TESTING_ASSERT( xfBounds == GetHierarchyBounds( xf, ISampleSelector(),
+        M44d(), kComputeFromPositions ) );
+
+    // the parent matrix is applied on top of everything
+    Box3d shifted = GetHierarchyBounds( xf, ISampleSelector(), scale );
+    TESTING_ASSERT( shifted == Imath::transform( mesh, translate * scale ) );
+
+    IObject stored( archive.getTop(), "stored" );
+    Box3d storedBounds = GetHierarchyBounds( stored );
+    TESTING_ASSERT( storedBounds == Box3d( V3d( -200.0 ), V3d( 200.0 ) ) );
+
+    Box3d visitedBounds = GetHierarchyBounds( stored, ISampleSelector(),
+        M44d(), kIgnoreChildBounds );
+    TESTING_ASSERT( visitedBounds == Imath::transform( mesh, scale ) );
+
+    Box3d all = GetHierarchyBounds( archive.getTop(), ISampleSelector(),
+        M44d(), kIgnoreChildBounds );
+    Box3d expected = Imath::transform( mesh, translate );
+    expected.extendBy( Imath::transform( mesh, scale ) );
+    TESTING_ASSERT( all == expected );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string name = "hierarchyBounds.abc";
+    writeArchive( name );
+    readArchive( name );
+    return 0;
+}
@@ -0,0 +1,282 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/AbcGeom/All.h>
+#include <Alembic/AbcCoreOgawa/All.h>
+
+#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include <cstring>
+
+using namespace Alembic::AbcGeom;
+
+namespace {
+
+const int32_t g_indices[] = { 0, 1, 2, 0, 2, 3 };
+const int32_t g_counts[] = { 3, 3 };
+
+const chrono_t g_dt = 1.0 / 24.0;
+
+} // End anonymous namespace
+
+//-*****************************************************************************
+void writeArchive( const std::string & iName )
+{
+    OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+    uint32_t tsIdx = archive.addTimeSampling( TimeSampling( g_dt, 0.0 ) );
+
+    OXform xf( archive.getTop(), "xf", tsIdx );
+    OPolyMesh mesh( xf, "mesh", tsIdx );
+    OPolyMesh grown( xf, "grown", tsIdx );
+    OPolyMesh moving( xf, "moving", tsIdx );
+
+    OFloatGeomParam widths( mesh.getSchema().getArbGeomParams(), "widths",
+                            false, kVertexScope, 1, tsIdx );
+
+    for ( size_t i = 0; i < 2; ++i )
+    {
+        XformSample xfSamp;
+        xfSamp.setTranslation( V3d( 10.0 * i, 0.0, 0.0 ) );
+        xfSamp.setYRotation( 90.0 * i );
+        xf.getSchema().set( xfSamp );
+
+        float offset = 2.0f * i;
+        std::vector< V3f > verts;
+        verts.push_back( V3f( 0.0f, offset, 0.0f ) );
+        verts.push_back( V3f( 1.0f, offset, 0.0f ) );
+        verts.push_back( V3f( 1.0f, offset, 1.0f ) );
+        verts.push_back( V3f( 0.0f, offset, 1.0f ) );
+
+        OPolyMeshSchema::Sample meshSamp(
+            V3fArraySample( verts ),
+            Int32ArraySample( g_indices, 6 ),
+            Int32ArraySample( g_counts, 2 ) );
+        mesh.getSchema().set( meshSamp );
+
+        std::vector< float > widthVals( 4, 1.0f + i );
+        widths.set( OFloatGeomParam::Sample( FloatArraySample( widthVals ),
+                                             kVertexScope ) );
+
+        // the second sample adds a triangle, so it can't be blended
+        OPolyMeshSchema::Sample grownSamp(
+            V3fArraySample( verts ),
+            Int32ArraySample( g_indices, 3 + 3 * i ),
+            Int32ArraySample( g_counts, 1 + i ) );
+        grown.getSchema().set( grownSamp );
+
+        // moves 24 units a second along x, but the samples don't agree
+        // with that so we can tell which one was used
+        std::vector< V3f > vels( 4, V3f( 24.0f, 0.0f, 0.0f ) );
+        meshSamp.setVelocities( V3fArraySample( vels ) );
+        moving.getSchema().set( meshSamp );
+    }
+}
+
+//-*****************************************************************************
+void readArchive( const std::string & iName )
+{
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+
+    IXform xf( archive.getTop(), "xf" );
+    IPolyMesh mesh( xf, "mesh" );
+    IPolyMesh grown( xf, "grown" );
+
+    ISampleSelector quarter( 0.25 * g_dt );
+
+    index_t floorIdx = -1;
+    index_t ceilIdx = -1;
+    chrono_t alpha = quarter.getInterpolationIndices(
+        mesh.getSchema().getTimeSampling(), 2, floorIdx, ceilIdx );
+    TESTING_ASSERT( floorIdx == 0 && ceilIdx == 1 );
+    TESTING_ASSERT( Imath::equalWithAbsError( alpha, 0.25, 1e-9 ) );
+
+    // landing on a sample, or asking by index, doesn't blend
+    alpha = ISampleSelector( g_dt ).getInterpolationIndices(
+        mesh.getSchema().getTimeSampling(), 2, floorIdx, ceilIdx );
+    TESTING_ASSERT( floorIdx == 1 && ceilIdx == 1 && alpha == 0.0 );
+
+    alpha = ISampleSelector( ( index_t ) 0 ).getInterpolationIndices(
+        mesh.getSchema().getTimeSampling(), 2, floorIdx, ceilIdx );
+    TESTING_ASSERT( floorIdx == 0 && ceilIdx == 0 && alpha == 0.0 );
+
+    std::vector< V3f > pos;
+    TESTING_ASSERT( GetInterpolatedPositions( mesh.getSchema(), quarter,
+                                              pos ) );
+    TESTING_ASSERT( pos.size() == 4 );
+    TESTING_ASSERT( Imath::equalWithAbsError( pos[2].y, 0.5f, 1e-6f ) );
+    TESTING_ASSERT( pos[2].x == 1.0f && pos[2].z == 1.0f );
+
+    // no velocities were written
+    std::vector< V3f > vels;
+    TESTING_ASSERT( !GetInterpolatedVelocities( mesh.getSchema(), quarter,
+                                                vels ) );
+    TESTING_ASSERT( vels.empty() );
+
+    // heterogenous topology gives back the nearest sample untouched
+    TESTING_ASSERT( grown.getSchema().getTopologyVariance() ==
+                    kHeterogenousTopology );
+    TESTING_ASSERT( !GetInterpolatedPositions( grown.getSchema(), quarter,
+                                               pos ) );
+    TESTING_ASSERT( pos.size() == 4 && pos[0].y == 0.0f );
+    TESTING_ASSERT( !GetInterpolatedPositions( grown.getSchema(),
+        ISampleSelector( 0.75 * g_dt ), pos ) );
+    TESTING_ASSERT( pos[0].y == 2.0f );
+
+    IFloatGeomParam widths( mesh.getSchema().getArbGeomParams(), "widths" );
+    std::vector< float > widthVals;
+    TESTING_ASSERT( GetInterpolatedValues( widths, quarter, widthVals ) );
+    TESTING_ASSERT( widthVals.size() == 4 );
+    TESTING_ASSERT( Imath::equalWithAbsError( widthVals[3], 1.25f, 1e-6f ) );
+
+    // the rotation is slerped rather than the matrix being blended
+    M44d mtx = GetInterpolatedMatrix( xf.getSchema(),
+                                      ISampleSelector( 0.5 * g_dt ) );
+    V3d corner;
+    mtx.multVecMatrix( V3d( 1.0, 0.0, 0.0 ), corner );
+    double s = std::sqrt( 0.5 );
+    TESTING_ASSERT( corner.equalWithAbsError( V3d( 5.0 + s, 0.0, -s ),
+                                              1e-9 ) );
+
+    // the velocities are used when they exist, from the nearest sample only
+    std::vector< chrono_t > shutter;
+    shutter.push_back( 0.75 * g_dt );
+    shutter.push_back( 1.25 * g_dt );
+
+    std::vector< std::vector< V3f > > blurred;
+    IPolyMesh moving( xf, "moving" );
+    TESTING_ASSERT( GetMotionBlurPositions( moving.getSchema(), g_dt, shutter,
+                                            blurred ) );
+    TESTING_ASSERT( blurred.size() == 2 && blurred[0].size() == 4 );
+    TESTING_ASSERT( Imath::equalWithAbsError( blurred[0][0].x, -0.25f,
+                                              1e-5f ) );
+    TESTING_ASSERT( Imath::equalWithAbsError( blurred[1][0].x, 0.25f,
+                                              1e-5f ) );
+    TESTING_ASSERT( blurred[0][0].y == 2.0f && blurred[1][0].y == 2.0f );
+
+    // and without them each time is interpolated
+    TESTING_ASSERT( !GetMotionBlurPositions( mesh.getSchema(), g_dt, shutter,
+                                             blurred ) );
+    TESTING_ASSERT( Imath::equalWithAbsError( blurred[0][0].y, 1.5f, 1e-6f ) );
+    TESTING_ASSERT( blurred[1][0].y == 2.0f );
+
+    M44d start = GetInterpolatedMatrix( xf.getSchema(), ISampleSelector() );
+    TESTING_ASSERT( start == xf.getSchema().getValue().getMatrix() );
+}
+
+//-*****************************************************************************
+// [8-byte uncompressed size][zstd frame], as the compressing writers store
+// samples
+AbcA::RawArraySample compressedSample( const std::vector< float > & iVals )
+{
+    AbcA::RawArraySample raw;
+    Alembic::AbcCoreOgawa::CompressArraySample( AbcA::ArraySample(
+        &iVals.front(), AbcA::DataType( Alembic::Util::kFloat32POD ),
+        Dimensions( iVals.size() ) ), raw );
+    return raw;
+}
+
+//-*****************************************************************************
+void canBlendTest( const std::string & iName )
+{
+    // noise, and the same noise backwards, compress to the same size and
+    // so the stored bytes start the same way
+    std::vector< float > forward( 1000 );
+    uint32_t seed = 9;
+    for ( size_t i = 0; i < forward.size(); ++i )
+    {
+        seed = seed * 1664525 + 1013904223;
+        forward[i] = float( seed ) / 4294967296.0f;
+    }
+    std::vector< float > backward( forward.rbegin(), forward.rend() );
+
+    AbcA::RawArraySample rawForward = compressedSample( forward );
+    AbcA::RawArraySample rawBackward = compressedSample( backward );
+    TESTING_ASSERT( memcmp( &rawForward.data.front(),
+                            &rawBackward.data.front(), 16 ) == 0 );
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), iName );
+        uint32_t tsIdx = archive.addTimeSampling( TimeSampling( g_dt, 0.0 ) );
+        OCompoundProperty props = archive.getTop().getProperties();
+
+        AbcA::ArrayPropertyWriterPtr noise =
+            props.getPtr()->createArrayProperty( "noise", MetaData(),
+                AbcA::DataType( Alembic::Util::kFloat32POD ), tsIdx );
+        TESTING_ASSERT( noise->setRawSample( rawForward ) );
+        TESTING_ASSERT( noise->setRawSample( rawBackward ) );
+
+        // the same number of values in a different shape
+        std::vector< float > vals( 4, 1.0f );
+        Dimensions grid;
+        grid.setRank( 2 );
+        grid[0] = 2;
+        grid[1] = 2;
+        OFloatArrayProperty shaped( props, "shaped", tsIdx );
+        shaped.set( FloatArraySample( vals ) );
+        vals.assign( 4, 2.0f );
+        shaped.set( FloatArraySample( &vals.front(), grid ) );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), iName );
+    ICompoundProperty props = archive.getTop().getProperties();
+
+    IFloatArrayProperty noise( props, "noise" );
+    TESTING_ASSERT( SamplesCanBlend( noise, 0, 1 ) );
+
+    std::vector< float > blended;
+    TESTING_ASSERT( GetInterpolatedValues( noise,
+                                           ISampleSelector( 0.5 * g_dt ),
+                                           blended ) );
+    TESTING_ASSERT( blended.size() == forward.size() );
+    for ( size_t i = 0; i < blended.size(); ++i )
+    {
+        TESTING_ASSERT( Imath::equalWithAbsError( blended[i],
+            0.5f * ( forward[i] + backward[i] ), 1e-6f ) );
+    }
+
+    IFloatArrayProperty shaped( props, "shaped" );
+    TESTING_ASSERT( !SamplesCanBlend( shaped, 0, 1 ) );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    std::string name = "interpolation.abc";
+    writeArchive( name );
+    readArchive( name );
+    canBlendTest( "interpolationCanBlend.abc" );
+    return 0;
+}
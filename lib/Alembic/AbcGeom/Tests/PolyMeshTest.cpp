@@ -61,6 +61,7 @@
 #include <Alembic/AbcCoreOgawa/All.h>
 
 // Other includes
+#include <cstring>
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -188,6 +189,27 @@ void Example1_MeshIn()
     IGeomBase::Sample baseSamp;
     geomBase.getSchema().get( baseSamp );
 
+    // reading the arrays at the same time gives the same sample
+    IPolyMeshSchema::Sample par_samp;
+    mesh.getParallel( par_samp );
+    TESTING_ASSERT( par_samp.getSelfBounds() == mesh_samp.getSelfBounds() );
+    TESTING_ASSERT( par_samp.getPositions()->size() ==
+                    mesh_samp.getPositions()->size() );
+    TESTING_ASSERT( par_samp.getFaceIndices()->size() ==
+                    mesh_samp.getFaceIndices()->size() );
+    TESTING_ASSERT( par_samp.getFaceCounts()->size() ==
+                    mesh_samp.getFaceCounts()->size() );
+    for ( size_t i = 0 ; i < mesh_samp.getPositions()->size() ; ++i )
+    {
+        TESTING_ASSERT( (*(par_samp.getPositions()))[i] ==
+                        (*(mesh_samp.getPositions()))[i] );
+    }
+    for ( size_t i = 0 ; i < mesh_samp.getFaceIndices()->size() ; ++i )
+    {
+        TESTING_ASSERT( (*(par_samp.getFaceIndices()))[i] ==
+                        (*(mesh_samp.getFaceIndices()))[i] );
+    }
+
     TESTING_ASSERT( mesh_samp.getSelfBounds().min == V3d( -1.0, -1.0, -1.0 ) );
 
     TESTING_ASSERT( mesh_samp.getSelfBounds().max == V3d( 1.0, 1.0, 1.0 ) );
@@ -422,6 +444,134 @@ void sparseTest()
     }
 }
 
+//-*****************************************************************************
+void sharedTopologyTest()
+{
+    std::string name = "sharedTopologyTest.abc";
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        OPolyMesh meshA( OObject( archive, kTop ), "meshA" );
+        OPolyMesh meshB( OObject( archive, kTop ), "meshB" );
+
+        std::vector< V3f > verts( ( const V3f * )g_verts,
+                                  ( const V3f * )g_verts + g_numVerts );
+        for ( size_t i = 0; i < 3; ++i )
+        {
+            verts[0].x = i;
+            OPolyMeshSchema::Sample samp( V3fArraySample( verts ),
+                Int32ArraySample( g_indices, g_numIndices ),
+                Int32ArraySample( g_counts, g_numCounts ) );
+            meshA.getSchema().set( samp );
+            meshB.getSchema().set( samp );
+        }
+    }
+
+    {
+        IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+        IPolyMesh meshA( IObject( archive, kTop ), "meshA" );
+        IPolyMesh meshB( IObject( archive, kTop ), "meshB" );
+
+        TESTING_ASSERT( meshA.getSchema().getTopologyVariance() ==
+                        kHomogenousTopology );
+
+        // every sample of both meshes shares the one topology
+        MeshTopologyPtr topo = meshA.getSchema().getTopology();
+        TESTING_ASSERT( topo->getFaceIndices()->size() == g_numIndices );
+        TESTING_ASSERT( topo->getFaceCounts()->size() == g_numCounts );
+        TESTING_ASSERT( topo == meshA.getSchema().getTopology( 2 ) );
+        TESTING_ASSERT( topo == meshB.getSchema().getTopology( 1 ) );
+
+        IPolyMeshSchema::Sample samp;
+        meshB.getSchema().getWithSharedTopology( samp, 2 );
+        TESTING_ASSERT( samp.getFaceIndices() == topo->getFaceIndices() );
+        TESTING_ASSERT( samp.getFaceCounts() == topo->getFaceCounts() );
+        TESTING_ASSERT( samp.getPositions()->size() == g_numVerts );
+        TESTING_ASSERT( ( *samp.getPositions() )[0].x == 2.0f );
+
+        P3fArraySamplePtr pos = meshA.getSchema().getPositions( 1 );
+        TESTING_ASSERT( ( *pos )[0].x == 1.0f );
+    }
+}
+
+//-*****************************************************************************
+// A mesh written by hand, with its face indices stored zstd compressed
+// ([8-byte uncompressed size][zstd frame]) as the compressing writers do.
+void writeCompressedMesh( OObject iParent, const std::string & iName,
+                          const std::vector< int32_t > & iIndices )
+{
+    MetaData md;
+    md.set( "schema", OPolyMeshSchema::getSchemaTitle() );
+    md.set( "schemaObjTitle", OPolyMesh::getSchemaObjTitle() );
+    OObject obj( iParent, iName, md );
+
+    MetaData schemaMd;
+    schemaMd.set( "schema", OPolyMeshSchema::getSchemaTitle() );
+    OCompoundProperty geom( obj.getProperties(),
+        OPolyMeshSchema::getDefaultSchemaName(), schemaMd );
+
+    OP3fArrayProperty( geom, "P" ).set(
+        P3fArraySample( ( const V3f * )g_verts, g_numVerts ) );
+    OBox3dProperty( geom, ".selfBnds" ).set( Box3d( V3d( -1.0 ),
+                                                    V3d( 1.0 ) ) );
+
+    std::vector< int32_t > counts( iIndices.size() / 4, 4 );
+    OInt32ArrayProperty( geom, ".faceCounts" ).set(
+        Int32ArraySample( counts ) );
+
+    AbcA::RawArraySample raw;
+    Alembic::AbcCoreOgawa::CompressArraySample( AbcA::ArraySample(
+        &iIndices.front(), AbcA::DataType( Alembic::Util::kInt32POD ),
+        Dimensions( iIndices.size() ) ), raw );
+
+    TESTING_ASSERT( geom.getPtr()->createArrayProperty( ".faceIndices",
+        MetaData(), AbcA::DataType( Alembic::Util::kInt32POD ), 0 )->
+        setRawSample( raw ) );
+}
+
+//-*****************************************************************************
+void compressedTopologyTest()
+{
+    std::string name = "compressedTopologyTest.abc";
+
+    // Noise of the same size, so the stored bytes of the two meshes' face
+    // indices start the same way.
+    std::vector< int32_t > indicesA( 1000 );
+    std::vector< int32_t > indicesB( 1000 );
+    uint32_t seed = 5;
+    for ( size_t i = 0; i < indicesA.size(); ++i )
+    {
+        seed = seed * 1664525 + 1013904223;
+        indicesA[i] = seed;
+        seed = seed * 1664525 + 1013904223;
+        indicesB[i] = seed;
+    }
+
+    {
+        OArchive archive( Alembic::AbcCoreOgawa::WriteArchive(), name );
+        writeCompressedMesh( OObject( archive, kTop ), "meshA", indicesA );
+        writeCompressedMesh( OObject( archive, kTop ), "meshB", indicesB );
+    }
+
+    IArchive archive( Alembic::AbcCoreOgawa::ReadArchive(), name );
+    IPolyMesh meshA( IObject( archive, kTop ), "meshA" );
+    IPolyMesh meshB( IObject( archive, kTop ), "meshB" );
+
+    MeshTopologyPtr topoA = meshA.getSchema().getTopology();
+    MeshTopologyPtr topoB = meshB.getSchema().getTopology();
+    TESTING_ASSERT( topoA != topoB );
+    TESTING_ASSERT( memcmp( topoA->getFaceIndices()->get(),
+                            &indicesA.front(), indicesA.size() * 4 ) == 0 );
+    TESTING_ASSERT( memcmp( topoB->getFaceIndices()->get(),
+                            &indicesB.front(), indicesB.size() * 4 ) == 0 );
+
+    IPolyMeshSchema::Sample samp;
+    meshB.getSchema().getWithSharedTopology( samp );
+    TESTING_ASSERT( samp.getFaceIndices() == topoB->getFaceIndices() );
+
+    // still shared when it really is the same
+    TESTING_ASSERT( topoA == meshA.getSchema().getTopology() );
+}
+
 //-*****************************************************************************
 //-*****************************************************************************
 //-*****************************************************************************
@@ -444,5 +594,8 @@ int main( int argc, char *argv[] )
 
     sparseTest();
 
+    sharedTopologyTest();
+    compressedTopologyTest();
+
     return 0;
 }
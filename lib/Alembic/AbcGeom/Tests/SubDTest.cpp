@@ -202,6 +202,46 @@ void Example1_MeshIn()
     ISubDSchema::Sample samp1 = mesh.getValue( 1 );
     IGeomBase::Sample baseSamp = geomBase.getSchema().getValue( 1 );
 
+    // reading the arrays at the same time, or on a pool with no workers,
+    // gives the same sample
+    Alembic::Util::TaskPool serialPool( 1 );
+    for ( int p = 0; p < 2; ++p )
+    {
+        ISubDSchema::Sample parSamp;
+        if ( p == 0 )
+        {
+            mesh.getParallel( parSamp, 1 );
+        }
+        else
+        {
+            mesh.getParallel( parSamp, 1, serialPool );
+        }
+
+        TESTING_ASSERT( parSamp.getSelfBounds() == samp1.getSelfBounds() );
+        TESTING_ASSERT( parSamp.getInterpolateBoundary() ==
+                        samp1.getInterpolateBoundary() );
+        TESTING_ASSERT( parSamp.getSubdivisionScheme() ==
+                        samp1.getSubdivisionScheme() );
+        TESTING_ASSERT( parSamp.getPositions()->size() ==
+                        samp1.getPositions()->size() );
+        TESTING_ASSERT( parSamp.getFaceIndices()->size() ==
+                        samp1.getFaceIndices()->size() );
+        TESTING_ASSERT( parSamp.getCreaseSharpnesses()->size() ==
+                        samp1.getCreaseSharpnesses()->size() );
+        TESTING_ASSERT( parSamp.getCornerSharpnesses()->size() ==
+                        samp1.getCornerSharpnesses()->size() );
+        TESTING_ASSERT( parSamp.getVelocities()->size() ==
+                        samp1.getVelocities()->size() );
+        TESTING_ASSERT( parSamp.getHoles()->size() == 2 );
+        TESTING_ASSERT( (*(parSamp.getHoles()))[1] == 5 );
+
+        for ( size_t i = 0 ; i < samp1.getPositions()->size() ; ++i )
+        {
+            TESTING_ASSERT( (*(parSamp.getPositions()))[i] ==
+                            (*(samp1.getPositions()))[i] );
+        }
+    }
+
     std::cout << "bounds: " << samp1.getSelfBounds().min << ", "
               << samp1.getSelfBounds().max << std::endl;
 
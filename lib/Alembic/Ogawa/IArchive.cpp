@@ -84,7 +84,20 @@ Alembic::Util::uint16_t IArchive::getVersion() const
 
 IGroupPtr IArchive::getGroup() const
 {
-    return mGroup;
+    // refresh can swap it while other threads read
+    return std::atomic_load(&mGroup);
+}
+
+bool IArchive::refresh()
+{
+    if (!mStreams->refresh())
+    {
+        return false;
+    }
+
+    IGroupPtr group(new IGroup(mStreams, mStreams->getGroupPos(), false, 0));
+    std::atomic_store(&mGroup, group);
+    return true;
 }
 
 } // End namespace ALEMBIC_VERSION_NS
@@ -64,6 +64,11 @@ public:
 
     IGroupPtr getGroup() const;
 
+    // for an archive that is still being written, points getGroup at the
+    // latest root group and returns true if it moved, see IStreams::refresh.
+    // Groups gotten before stay valid, and other threads can keep reading.
+    bool refresh();
+
 private:
     void init();
     IStreamsPtr mStreams;
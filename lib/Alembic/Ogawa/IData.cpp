@@ -54,11 +54,22 @@ public:
 
     IStreamsPtr streams;
 
+    // set instead of streams for data that doesn't live in the archive
+    IBufferPtr buffer;
+
     // set after freeze
     Alembic::Util::uint64_t pos;
     Alembic::Util::uint64_t size;
 };
 
+IData::IData(IBufferPtr iBuffer) :
+    mData(new IData::PrivateData(IStreamsPtr()))
+{
+    mData->buffer = iBuffer;
+    mData->pos = 0;
+    mData->size = iBuffer ? iBuffer->size() : 0;
+}
+
 IData::~IData()
 {
 
@@ -100,6 +111,12 @@ void IData::read(Alembic::Util::uint64_t iSize, void * iData,
         return;
     }
 
+    if (mData->buffer)
+    {
+        memcpy(iData, &mData->buffer->front() + iOffset, iSize);
+        return;
+    }
+
     // +8 is to account for the size
     mData->streams->read(iThreadId, mData->pos + iOffset + 8, iSize, iData);
 }
@@ -40,14 +40,22 @@
 #include <Alembic/Ogawa/Foundation.h>
 #include <Alembic/Ogawa/IStreams.h>
 
+#include <vector>
+
 namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
+typedef Alembic::Util::shared_ptr< const std::vector< char > > IBufferPtr;
+
 class ALEMBIC_EXPORT IData
 {
 public:
 
+    // Wraps bytes that don't live in the archive, such as an externally
+    // stored sample, so that they can be read like any other data.
+    explicit IData(IBufferPtr iBuffer);
+
     ~IData();
 
     void read(Alembic::Util::uint64_t iSize, void * iData,
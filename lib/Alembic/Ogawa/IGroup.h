@@ -68,6 +68,10 @@ public:
 
     bool isLight() const;
 
+    // not really necessary for most workflows, it is used when appending
+    // to reference this group from a new parent
+    Alembic::Util::uint64_t getPos() const;
+
 private:
     friend class IArchive;
     IGroup(IStreamsPtr iStreams, Alembic::Util::uint64_t iPos, bool iLight,
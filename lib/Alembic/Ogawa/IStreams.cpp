@@ -34,8 +34,10 @@
 //-*****************************************************************************
 
 #include <Alembic/Ogawa/IStreams.h>
+#include <atomic>
 #include <fstream>
 #include <stdexcept>
+#include <algorithm>
 
 
 #if defined (__unix__) || defined (__HAIKU__) || \
@@ -85,6 +87,9 @@ public:
 
     // not all streams have a size
     virtual Alembic::Util::uint64_t size() {return 0xffffffffffffffff;};
+
+    // picks up what was written to the file since it was opened
+    virtual void refresh() {};
 };
 
 typedef Alembic::Util::shared_ptr<IStreamReader> IStreamReaderPtr;
@@ -142,6 +147,16 @@ public:
         return true;
     }
 
+    void refresh()
+    {
+        // a read past what was written so far leaves the stream failed
+        for (size_t i = 0; i < streams.size(); i++)
+        {
+            Alembic::Util::scoped_lock l(locks[i]);
+            streams[i]->clear();
+        }
+    }
+
 private:
     std::vector<std::istream*> streams;
     std::vector<Alembic::Util::uint64_t> offsets;
@@ -334,11 +349,12 @@ public:
 #else
         fid = openFile(iFileName.c_str(), O_RDONLY);
 #endif
-        fileLen = 0;
-        if (getFileLength(fid, fileLen) < 0)
+        Alembic::Util::uint64_t len = 0;
+        if (getFileLength(fid, len) < 0)
         {
-            fileLen = 0;
+            len = 0;
         }
+        fileLen = len;
         // don't check the return value here
         // IStream::init() will check isOpen
     }
@@ -363,13 +379,23 @@ public:
         return fileLen;
     }
 
+    void refresh()
+    {
+        Alembic::Util::uint64_t len = 0;
+        if (isOpen() && getFileLength(fid, len) >= 0)
+        {
+            fileLen = len;
+        }
+    }
+
     bool read(std::size_t /*iTheadId*/, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void* oBuf)
     {
         // Ignore the iThread. There's no need to lock.
         if (!isOpen()) return false;
 
-        if (fileLen < iSize && fileLen < iSize + iPos)
+        Alembic::Util::uint64_t len = fileLen;
+        if (len < iSize && len < iSize + iPos)
         {
             return false;
         }
@@ -380,7 +406,9 @@ public:
 private:
     FileDescriptor fid;
     size_t nstreams;
-    Alembic::Util::uint64_t fileLen;
+
+    // refresh can change it while other threads read
+    std::atomic<Alembic::Util::uint64_t> fileLen;
 };
 
 
@@ -565,11 +593,13 @@ private:
 #endif
 
 
+    typedef Alembic::Util::shared_ptr<MappedRegion> MappedRegionPtr;
+
 public:
     MemoryMappedIStreamReader(const std::string& iFileName,
                               std::size_t iNumStreams)
         : nstreams(iNumStreams), fileName(iFileName),
-          fileHandle(BAD_FILE_HANDLE)
+          fileHandle(BAD_FILE_HANDLE), mappedRegion(new MappedRegion())
     {
         fileHandle = openFile(iFileName);
         if (fileHandle == BAD_FILE_HANDLE) return;
@@ -578,18 +608,18 @@ public:
         int err = getFileLength(fileHandle, len);
         if (err < 0) return;
 
-        mappedRegion.map(fileHandle, len);
+        mappedRegion->map(fileHandle, len);
     }
 
     ~MemoryMappedIStreamReader()
     {
-        mappedRegion.close();
+        mappedRegion.reset();
         closeFile(fileHandle);
     }
 
     bool isOpen() const
     {
-        return mappedRegion.isMapped();
+        return std::atomic_load(&mappedRegion)->isMapped();
     }
 
     size_t numStreams() const
@@ -601,15 +631,36 @@ public:
 
     Alembic::Util::uint64_t size()
     {
-        return static_cast<Alembic::Util::uint64_t>(mappedRegion.len);
+        return static_cast<Alembic::Util::uint64_t>(
+            std::atomic_load(&mappedRegion)->len);
+    }
+
+    void refresh()
+    {
+        if (fileHandle == BAD_FILE_HANDLE) return;
+
+        size_t len = 0;
+        int err = getFileLength(fileHandle, len);
+        if (err < 0 || len == std::atomic_load(&mappedRegion)->len) return;
+
+        // keep the old mapping if the larger one can't be made, otherwise
+        // swap it in, the old one is unmapped once the reads using it finish
+        MappedRegionPtr region(new MappedRegion());
+        region->map(fileHandle, len);
+        if (region->isMapped())
+        {
+            std::atomic_store(&mappedRegion, region);
+        }
     }
 
     bool read(std::size_t iStream, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void* oBuf)
     {
-        if (iSize > mappedRegion.len || iPos > mappedRegion.len || iPos + iSize > mappedRegion.len) return false;
+        // held for the copy so refresh can't unmap it from under us
+        MappedRegionPtr region = std::atomic_load(&mappedRegion);
+        if (iSize > region->len || iPos > region->len || iPos + iSize > region->len) return false;
 
-        const char* p = static_cast<const char*>(mappedRegion.p) + iPos;
+        const char* p = static_cast<const char*>(region->p) + iPos;
         std::memcpy(oBuf, p, iSize);
 
         return true;
@@ -619,7 +670,9 @@ private:
     std::size_t nstreams;
     std::string fileName;
     FileHandle fileHandle;
-    MappedRegion mappedRegion;
+
+    // only ever loaded and stored atomically
+    MappedRegionPtr mappedRegion;
 };
 
 
@@ -660,6 +713,7 @@ public:
         frozen = false;
         version = 0;
         size = 0;
+        groupPos = 0;
     }
 
     void init(IStreamReaderPtr iReader, size_t iNumStreams)
@@ -724,14 +778,46 @@ public:
         {
             reader = iReader;        // preserve the reader
             valid = true;
+            groupPos = firstGroupPos;
         }
     }
 
+    bool refresh()
+    {
+        if (!valid) return false;
+
+        // the header is read before the size, so that everything the root
+        // group points at is within the size
+        char header[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        reader->refresh();
+        if (!reader->read(0, 0, 16, static_cast<void*>(header)))
+        {
+            return false;
+        }
+        reader->refresh();
+
+        bool filefrozen = (header[5] == char(0xff));
+        Alembic::Util::uint64_t pos = *((Alembic::Util::uint64_t*) (&(header[8])));
+        size = reader->size();
+
+        if (pos == groupPos && filefrozen == frozen)
+        {
+            return false;
+        }
+
+        groupPos = pos;
+        frozen = filefrozen;
+        return true;
+    }
+
 
     bool valid;
-    bool frozen;
     Alembic::Util::uint16_t version;
-    Alembic::Util::uint64_t size;
+
+    // refresh can change these while other threads read
+    std::atomic<bool> frozen;
+    std::atomic<Alembic::Util::uint64_t> size;
+    std::atomic<Alembic::Util::uint64_t> groupPos;
 
     IStreamReaderPtr reader;
 };
@@ -776,6 +862,16 @@ Alembic::Util::uint64_t IStreams::getSize()
     return mData->size;
 }
 
+Alembic::Util::uint64_t IStreams::getGroupPos()
+{
+    return mData->groupPos;
+}
+
+bool IStreams::refresh()
+{
+    return mData->refresh();
+}
+
 void IStreams::read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
                     Alembic::Util::uint64_t iSize, void * oBuf)
 {
@@ -60,6 +60,15 @@ public:
 
     Alembic::Util::uint64_t getSize();
 
+    // where the header says the root group is
+    Alembic::Util::uint64_t getGroupPos();
+
+    // for a file that is still being written to, re-reads the header and
+    // the size, and returns true if the root group moved or the file was
+    // frozen since the last time.  Other threads can keep reading meanwhile,
+    // a memory mapped file is only unmapped once the reads using it finish.
+    bool refresh();
+
     // locks on the threadId, seeks to iPos, and reads iSize bytes into oBuf
     void read(std::size_t iThreadId, Alembic::Util::uint64_t iPos,
               Alembic::Util::uint64_t iSize, void * oBuf);
@@ -41,8 +41,8 @@ namespace Alembic {
 namespace Ogawa {
 namespace ALEMBIC_VERSION_NS {
 
-OArchive::OArchive(const std::string & iFileName) :
-    mStream(new OStream(iFileName))
+OArchive::OArchive(const std::string & iFileName, bool iAppend) :
+    mStream(new OStream(iFileName, iAppend))
 {
     mGroup.reset(new OGroup(mStream));
 }
@@ -66,6 +66,21 @@ OGroupPtr OArchive::getGroup()
     return mGroup;
 }
 
+void OArchive::checkpoint(Alembic::Util::uint64_t iPos)
+{
+    // the same spot the root group writes itself into when frozen
+    if (isValid() && !mGroup->isFrozen())
+    {
+        mStream->seek(8);
+        mStream->write(&iPos, 8);
+    }
+}
+
+Alembic::Util::uint64_t OArchive::getSize()
+{
+    return mStream->getSize();
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
@@ -48,7 +48,10 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT OArchive
 {
 public:
-    OArchive(const std::string & iFileName);
+    // when iAppend is true, the archive at iFileName is reopened and
+    // everything written is added after its end, the old groups and data
+    // can be referenced by position from the new root group
+    OArchive(const std::string & iFileName, bool iAppend = false);
     OArchive(std::ostream * iStream);
     ~OArchive();
 
@@ -56,6 +59,16 @@ public:
 
     bool isValid();
 
+    // point the header at iPos, a root group written with
+    // OGroup::writeDetachedGroup, until the next checkpoint or until the
+    // real root group is frozen.  Everything iPos refers to has to be
+    // written already, a reader opening the archive after a crash gets this
+    // root group instead of nothing.
+    void checkpoint(Alembic::Util::uint64_t iPos);
+
+    // how many bytes have been written to the stream so far
+    Alembic::Util::uint64_t getSize();
+
 private:
     OStreamPtr mStream;
     OGroupPtr mGroup;
@@ -212,6 +212,39 @@ void OGroup::addGroup(OGroupPtr iGroup)
     }
 }
 
+void OGroup::addExistingGroup(Alembic::Util::uint64_t iPos)
+{
+    if (!isFrozen())
+    {
+        mData->childVec.push_back(iPos);
+    }
+}
+
+ODataPtr OGroup::getExistingData(Alembic::Util::uint64_t iPos,
+                                 Alembic::Util::uint64_t iSize)
+{
+    ODataPtr child;
+    if (iPos == 0 || iSize == 0)
+    {
+        child.reset(new OData());
+    }
+    else
+    {
+        child.reset(new OData(mData->stream, iPos, iSize));
+    }
+    return child;
+}
+
+OGroupPtr OGroup::rewriteGroup(Alembic::Util::uint64_t iIndex)
+{
+    OGroupPtr child;
+    if (isChildGroup(iIndex))
+    {
+        child.reset(new OGroup(shared_from_this(), iIndex));
+    }
+    return child;
+}
+
 void OGroup::addEmptyGroup()
 {
     if (!isFrozen())
@@ -324,6 +357,41 @@ void OGroup::replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData)
     mData->childVec[iIndex] = pos;
 }
 
+std::vector< Alembic::Util::uint64_t > OGroup::getChildPositions() const
+{
+    return mData->childVec;
+}
+
+Alembic::Util::uint64_t OGroup::writeDetachedGroup(
+    const std::vector< Alembic::Util::uint64_t > & iChildren)
+{
+    // just like freeze, no children means the empty group
+    if (iChildren.empty())
+    {
+        return EMPTY_GROUP;
+    }
+
+    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
+    Alembic::Util::uint64_t size = iChildren.size();
+    mData->stream->write(&size, 8);
+    mData->stream->write(&iChildren.front(), size*8);
+    return pos;
+}
+
+Alembic::Util::uint64_t OGroup::writeDetachedData(
+    Alembic::Util::uint64_t iSize, const void * iData)
+{
+    if (iSize == 0)
+    {
+        return EMPTY_DATA;
+    }
+
+    Alembic::Util::uint64_t pos = mData->stream->getAndSeekEndPos();
+    mData->stream->write(&iSize, 8);
+    mData->stream->write(iData, iSize);
+    return pos | EMPTY_DATA;
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Ogawa
 } // End namespace Alembic
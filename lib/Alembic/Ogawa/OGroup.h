@@ -85,6 +85,21 @@ public:
     // reference an existing group
     void addGroup(OGroupPtr iGroup);
 
+    // reference a group that was already in the stream when it was
+    // reopened for appending, iPos is as returned by IGroup::getPos
+    void addExistingGroup(Alembic::Util::uint64_t iPos);
+
+    // wrap data that was already in the stream when it was reopened for
+    // appending, iPos and iSize are as returned by IData::getPos and
+    // IData::getSize.  Like createData it is NOT added as a child.
+    ODataPtr getExistingData(Alembic::Util::uint64_t iPos,
+                             Alembic::Util::uint64_t iSize);
+
+    // create a group which takes the place of the child group at iIndex
+    // once it is frozen, this is how a group referenced via
+    // addExistingGroup gets rewritten with more children
+    OGroupPtr rewriteGroup(Alembic::Util::uint64_t iIndex);
+
     // convenience function for adding a default NULL group
     void addEmptyGroup();
 
@@ -109,6 +124,23 @@ public:
 
     void replaceData(Alembic::Util::uint64_t iIndex, ODataPtr iData);
 
+    // the children as they would be written if this group was frozen right
+    // now, data has the top bit set and groups that aren't frozen yet are 0
+    std::vector< Alembic::Util::uint64_t > getChildPositions() const;
+
+    // write a frozen group with iChildren, in the form returned by
+    // getChildPositions, at the end of the stream WITHOUT adding it as a
+    // child of anything, and return its position.  This is how a snapshot of
+    // groups that are still being written is made for OArchive::checkpoint.
+    Alembic::Util::uint64_t writeDetachedGroup(
+        const std::vector< Alembic::Util::uint64_t > & iChildren);
+
+    // write a data stream WITHOUT adding it as a child, and return its
+    // position in the form writeDetachedGroup takes.  Unlike createData, no
+    // EMPTY_DATA child is added when iSize is 0.
+    Alembic::Util::uint64_t writeDetachedData(Alembic::Util::uint64_t iSize,
+                                              const void * iData);
+
     // currently I'm going to leave this out, because a bad implementation
     // could cause all sorts of subtle race conditions when unfrozen children
     // are suddenly frozen.  It may also not be necessary (you can still
@@ -49,9 +49,15 @@ namespace ALEMBIC_VERSION_NS {
 class OStream::PrivateData
 {
 public:
-    PrivateData(const std::string & iFileName) :
+    PrivateData(const std::string & iFileName, bool iAppend) :
         stream(NULL), fileName(iFileName), startPos(0), curPos(0), maxPos(0)
     {
+        if (iAppend)
+        {
+            openForAppend();
+            return;
+        }
+
 #ifdef _WIN32
         // to wchar_t
         // get the size of the UTF8 string
@@ -90,6 +96,53 @@ public:
         }
     }
 
+    // reopen an existing, frozen archive without truncating it, new data
+    // is only ever written after its current end
+    void openForAppend()
+    {
+        std::ios_base::openmode mode = std::ios_base::in | std::ios_base::out |
+            std::ios_base::binary;
+#ifdef _WIN32
+        int wLength = MultiByteToWideChar(CP_UTF8, 0, fileName.c_str(), -1, NULL, 0);
+        wchar_t* wFileName = (wchar_t*)malloc(wLength * sizeof(wchar_t));
+        if (!wFileName)
+          throw std::runtime_error("Unable to convert to wchar_t file name");
+        MultiByteToWideChar(CP_UTF8, 0, fileName.c_str(), -1, wFileName, wLength);
+        std::fstream * filestream = new std::fstream(wFileName, mode);
+        free(wFileName);
+#else
+        std::fstream * filestream = new std::fstream(fileName.c_str(), mode);
+#endif
+        char header[16] = {0};
+        if (filestream->is_open())
+        {
+            filestream->read(header, sizeof(header));
+        }
+
+        // only a finished archive is safe to append to, anything else may
+        // have children that point past the end of the file
+        if (!filestream->is_open() || filestream->gcount() != sizeof(header) ||
+            header[0] != 'O' || header[1] != 'g' || header[2] != 'a' ||
+            header[3] != 'w' || header[4] != 'a' || header[5] != char(0xff))
+        {
+            filestream->close();
+            delete filestream;
+            return;
+        }
+
+        filestream->clear();
+        filestream->seekp(0, std::ios_base::end);
+        maxPos = filestream->tellp();
+        curPos = maxPos;
+
+        stream = filestream;
+#if defined _WIN32 || defined _WIN64
+        filestream->rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+#endif
+        stream->exceptions ( std::ostream::failbit |
+                             std::ostream::badbit );
+    }
+
     PrivateData(std::ostream * iStream) :
         stream(iStream), startPos(0), curPos(0), maxPos(0)
     {
@@ -112,11 +165,17 @@ public:
         if (!fileName.empty() && stream)
         {
             std::ofstream * filestream = dynamic_cast<std::ofstream *>(stream);
+            std::fstream * appendstream = dynamic_cast<std::fstream *>(stream);
             if (filestream)
             {
                 filestream->close();
                 delete filestream;
             }
+            else if (appendstream)
+            {
+                appendstream->close();
+                delete appendstream;
+            }
         }
     }
 
@@ -131,10 +190,15 @@ public:
     Alembic::Util::mutex lock;
 };
 
-OStream::OStream(const std::string & iFileName) :
-    mData(new PrivateData(iFileName))
+OStream::OStream(const std::string & iFileName, bool iAppend) :
+    mData(new PrivateData(iFileName, iAppend))
 {
-    init();
+    // an appended stream keeps its header, including the position of the
+    // old root group, until the new root group is frozen
+    if (!iAppend)
+    {
+        init();
+    }
 }
 
 // we'll be writing from this already open stream which we don't own
@@ -203,6 +267,12 @@ Alembic::Util::uint64_t OStream::getAndSeekEndPos()
     return 0;
 }
 
+Alembic::Util::uint64_t OStream::getSize()
+{
+    Alembic::Util::scoped_lock l(mData->lock);
+    return mData->maxPos;
+}
+
 void OStream::seek(Alembic::Util::uint64_t iPos)
 {
     if (isValid())
@@ -52,13 +52,16 @@ namespace ALEMBIC_VERSION_NS {
 class ALEMBIC_EXPORT OStream
 {
 public:
-    OStream(const std::string & iFileName);
+    // when iAppend is true, iFileName must be a finished Ogawa archive, the
+    // stream will then write after the end of it instead of truncating it
+    OStream(const std::string & iFileName, bool iAppend = false);
     OStream(std::ostream * iStream);
     ~OStream();
 
     bool isValid();
 
     Alembic::Util::uint64_t getAndSeekEndPos();
+    Alembic::Util::uint64_t getSize();
     void write(const void * iBuf, Alembic::Util::uint64_t iSize);
     void seek(Alembic::Util::uint64_t iPos);
 
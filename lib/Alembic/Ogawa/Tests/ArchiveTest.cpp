@@ -37,6 +37,10 @@
 #include <Alembic/Ogawa/All.h>
 #include <Alembic/AbcCoreAbstract/Tests/Assert.h>
 
+#include <atomic>
+#include <fstream>
+#include <thread>
+
 void test(bool iUseMMap)
 {
     {
@@ -78,11 +82,93 @@ void stringStreamTest()
 }
 
 
+// the byte at iPos of a file appendBlock wrote
+char fileByte(Alembic::Util::uint64_t iPos)
+{
+    return static_cast<char>(iPos % 251);
+}
+
+void appendBlock(std::ofstream & ioFile, Alembic::Util::uint64_t iPos)
+{
+    std::vector<char> block(4096);
+    for (std::size_t i = 0; i < block.size(); ++i)
+    {
+        block[i] = fileByte(iPos + i);
+    }
+    ioFile.write(&block.front(), block.size());
+    ioFile.flush();
+}
+
+// refresh remaps a growing file while other threads keep reading it
+void refreshWhileReadingTest()
+{
+    const char * name = "refreshWhileReading.ogawa";
+    std::ofstream out(name, std::ios::binary | std::ios::trunc);
+
+    // not frozen, version 1, no root group yet
+    char header[16] = {'O', 'g', 'a', 'w', 'a', 0, 0, 1,
+                       0, 0, 0, 0, 0, 0, 0, 0};
+    out.write(header, 16);
+    Alembic::Util::uint64_t fileSize = 16;
+    appendBlock(out, fileSize);
+    fileSize += 4096;
+
+    Alembic::Ogawa::IStreams streams(name, 4, true);
+    TESTING_ASSERT(streams.isValid());
+    TESTING_ASSERT(streams.getSize() == fileSize);
+
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> mismatches(0);
+    std::vector<std::thread> readers;
+    for (std::size_t t = 0; t < 4; ++t)
+    {
+        readers.push_back(std::thread([&, t]()
+        {
+            Alembic::Util::uint64_t seed = t + 1;
+            char buf[64];
+            while (!done)
+            {
+                Alembic::Util::uint64_t size = streams.getSize();
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                Alembic::Util::uint64_t pos = 16 + (seed >> 33) %
+                    (size - 16 - sizeof(buf));
+
+                streams.read(t, pos, sizeof(buf), buf);
+                for (std::size_t i = 0; i < sizeof(buf); ++i)
+                {
+                    if (buf[i] != fileByte(pos + i))
+                    {
+                        ++mismatches;
+                        break;
+                    }
+                }
+            }
+        }));
+    }
+
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+        appendBlock(out, fileSize);
+        fileSize += 4096;
+        streams.refresh();
+    }
+
+    done = true;
+    for (std::size_t t = 0; t < readers.size(); ++t)
+    {
+        readers[t].join();
+    }
+
+    TESTING_ASSERT(mismatches == 0);
+    TESTING_ASSERT(streams.getSize() == fileSize);
+}
+
 int main ( int argc, char *argv[] )
 {
     test(true);     // Use mmap
     test(false);    // Use streams
 
     stringStreamTest();
+    refreshWhileReadingTest();
     return 0;
 }
\ No newline at end of file
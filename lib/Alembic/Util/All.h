@@ -44,7 +44,9 @@
 #include <Alembic/Util/Murmur3.h>
 #include <Alembic/Util/Naming.h>
 #include <Alembic/Util/OperatorBool.h>
+#include <Alembic/Util/PackedStrings.h>
 #include <Alembic/Util/PlainOldDataType.h>
+#include <Alembic/Util/TaskPool.h>
 #include <Alembic/Util/TokenMap.h>
 #include <Alembic/Util/SpookyV2.h>
 
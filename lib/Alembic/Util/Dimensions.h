@@ -44,88 +44,131 @@ namespace Util {
 namespace ALEMBIC_VERSION_NS {
 
 //-*****************************************************************************
+//! Dimensions are made for every sample read and written, and are almost
+//! always rank 1, so up to MAX_INLINE_RANK ranks are stored inline and only
+//! higher ranks go on the heap.
 template <class T>
 class BaseDimensions
 {
+public:
+    static const size_t MAX_INLINE_RANK = 4;
+
 private:
-    typedef std::vector<T> SizeVec;
-    SizeVec m_vector;
+    T m_inline[MAX_INLINE_RANK];
+    std::vector<T> m_heap;
+    size_t m_rank;
+
+    T *data()
+    { return m_rank > MAX_INLINE_RANK ? &( m_heap.front() ) : m_inline; }
+
+    const T *data() const
+    { return m_rank > MAX_INLINE_RANK ? &( m_heap.front() ) : m_inline; }
+
+    // Sets the rank without initializing any new ranks.
+    void resize( size_t r )
+    {
+        if ( r > MAX_INLINE_RANK )
+        {
+            if ( m_rank <= MAX_INLINE_RANK )
+            {
+                m_heap.assign( m_inline, m_inline + m_rank );
+            }
+            m_heap.resize( r );
+        }
+        else if ( m_rank > MAX_INLINE_RANK )
+        {
+            std::copy( m_heap.begin(), m_heap.begin() + r, m_inline );
+            std::vector<T>().swap( m_heap );
+        }
+        m_rank = r;
+    }
+
+    template <class Y>
+    void assign( const BaseDimensions<Y> &copy )
+    {
+        resize( copy.rank() );
+        T *ptr = data();
+        for ( size_t i = 0; i < m_rank; ++i )
+        {
+            Y val = copy[i];
+            ptr[i] = static_cast<T>( val );
+        }
+    }
 
 public:
     // Default is for a rank-0 dimension.
     BaseDimensions()
-      : m_vector()
+      : m_rank( 0 )
     {}
 
     // When you specify a single thing, you're specifying a rank-1
     // dimension of a certain size.
     explicit BaseDimensions( const T& t )
-      : m_vector( 1, t )
-    {}
+      : m_rank( 1 )
+    {
+        m_inline[0] = t;
+    }
 
     BaseDimensions( const BaseDimensions &copy )
-      : m_vector( copy.m_vector )
-    {}
+      : m_rank( 0 )
+    {
+        assign( copy );
+    }
 
     template <class Y>
     BaseDimensions( const BaseDimensions<Y> &copy )
+      : m_rank( 0 )
     {
-        m_vector.resize( copy.rank() );
-        for ( size_t i = 0; i < copy.rank(); ++i )
-        {
-            Y val = copy[i];
-            m_vector[i] = static_cast<T>( val );
-        }
+        assign( copy );
     }
 
     BaseDimensions& operator=( const BaseDimensions &copy )
     {
-        m_vector = copy.m_vector;
+        if ( this != &copy )
+        {
+            assign( copy );
+        }
         return *this;
     }
 
     template <class Y>
     BaseDimensions& operator=( const BaseDimensions<Y> &copy )
     {
-        m_vector.resize( copy.rank() );
-        for ( size_t i = 0; i < copy.rank(); ++i )
-        {
-            Y val = copy[i];
-            m_vector[i] = static_cast<T>( val );
-        }
+        assign( copy );
         return *this;
     }
 
-    size_t rank() const { return m_vector.size(); }
+    size_t rank() const { return m_rank; }
     void setRank( size_t r )
     {
-        size_t oldSize = m_vector.size();
-        m_vector.resize( r );
+        size_t oldSize = m_rank;
+        resize( r );
+        T *ptr = data();
         for ( size_t s = oldSize; s < r; ++s )
         {
-            m_vector[s] = ( T )0;
+            ptr[s] = ( T )0;
         }
     }
 
     T &operator[]( size_t i )
-    { return m_vector[i]; }
+    { return data()[i]; }
 
     const T &operator[]( size_t i ) const
-    { return m_vector[i]; }
+    { return data()[i]; }
 
-    T *rootPtr() { return ( T * )( &( m_vector.front() ) ); }
-    const T *rootPtr() const
-    { return ( const T * )( &( m_vector.front() ) ); }
+    T *rootPtr() { return data(); }
+    const T *rootPtr() const { return data(); }
 
     size_t numPoints() const
     {
-        if ( m_vector.size() == 0 ) { return 0; }
+        if ( m_rank == 0 ) { return 0; }
         else
         {
+            const T *ptr = data();
             size_t npoints = 1;
-            for ( size_t i = 0 ; i < m_vector.size() ; i++ )
+            for ( size_t i = 0 ; i < m_rank ; i++ )
             {
-                npoints *= (size_t)m_vector[i];
+                npoints *= (size_t)ptr[i];
             }
             return npoints;
         }
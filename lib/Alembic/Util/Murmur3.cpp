@@ -49,124 +49,99 @@ namespace Alembic {
 namespace Util {
 namespace ALEMBIC_VERSION_NS {
 
-//-*****************************************************************************
-void MurmurHash3_x64_128 ( const void * key, const size_t len,
-                           const size_t podSize, void * out )
-{
-    const uint8_t * data = (const uint8_t*)key;
-    const size_t nblocks = len / 16;
-
-    uint64_t h1 = 0;
-    uint64_t h2 = 0;
+#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
+#define ALEMBIC_MURMUR3_BIG_ENDIAN 1
+#endif
 
+namespace {
 
 #ifdef _MSC_VER
-    uint64_t c1 = 0x87c37b91114253d5LL;
-    uint64_t c2 = 0x4cf5ad432745937fLL;
+const uint64_t c1 = 0x87c37b91114253d5LL;
+const uint64_t c2 = 0x4cf5ad432745937fLL;
 #else
-    uint64_t c1 = 0x87c37b91114253d5ULL;
-    uint64_t c2 = 0x4cf5ad432745937fULL;
+const uint64_t c1 = 0x87c37b91114253d5ULL;
+const uint64_t c2 = 0x4cf5ad432745937fULL;
 #endif
 
-    //----------
-    // body
-
-    const uint64_t * blocks = (const uint64_t *)(data);
-
-    for(size_t i = 0; i < nblocks; i++)
+//-*****************************************************************************
+// Swaps the PODs in k to little endian on big endian platforms.
+inline uint64_t SwapBlock( uint64_t k, size_t podSize )
+{
+#ifdef ALEMBIC_MURMUR3_BIG_ENDIAN
+    if (podSize == 8)
     {
-
-        uint64_t k1 = blocks[i*2];
-        uint64_t k2 = blocks[i*2+1];
-
-
-#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
-        if (podSize == 8)
-        {
-            k1 = (k1>>56) |
-                ((k1<<40) & 0x00FF000000000000ULL) |
-                ((k1<<24) & 0x0000FF0000000000ULL) |
-                ((k1<<8)  & 0x000000FF00000000ULL) |
-                ((k1>>8)  & 0x00000000FF000000ULL) |
-                ((k1>>24) & 0x0000000000FF0000ULL) |
-                ((k1>>40) & 0x000000000000FF00ULL) |
-                (k1<<56);
-
-            k2 = (k2>>56) |
-                ((k2<<40) & 0x00FF000000000000ULL) |
-                ((k2<<24) & 0x0000FF0000000000ULL) |
-                ((k2<<8)  & 0x000000FF00000000ULL) |
-                ((k2>>8)  & 0x00000000FF000000ULL) |
-                ((k2>>24) & 0x0000000000FF0000ULL) |
-                ((k2>>40) & 0x000000000000FF00ULL) |
-                 (k2<<56);
-        }
-        else if (podSize == 4)
-        {
-            k1 =((k1<<24) & 0xFF00000000000000ULL) |
-                ((k1<<8)  & 0x00FF000000000000ULL) |
-                ((k1>>8)  & 0x0000FF0000000000ULL) |
-                ((k1>>24) & 0x000000FF00000000ULL) |
-                ((k1<<24) & 0x00000000FF000000ULL) |
-                ((k1<<8)  & 0x0000000000FF0000ULL) |
-                ((k1>>8)  & 0x000000000000FF00ULL) |
-                ((k1>>24) & 0x00000000000000FFULL);
-
-            k2 =((k2<<24) & 0xFF00000000000000ULL) |
-                ((k2<<8)  & 0x00FF000000000000ULL) |
-                ((k2>>8)  & 0x0000FF0000000000ULL) |
-                ((k2>>24) & 0x000000FF00000000ULL) |
-                ((k2<<24) & 0x00000000FF000000ULL) |
-                ((k2<<8)  & 0x0000000000FF0000ULL) |
-                ((k2>>8)  & 0x000000000000FF00ULL) |
-                ((k2>>24) & 0x00000000000000FFULL);
-        }
-        else if (podSize == 2)
-        {
-            k1 =((k1<<8) & 0xFF00000000000000ULL) |
-                ((k1>>8) & 0x00FF000000000000ULL) |
-                ((k1<<8) & 0x0000FF0000000000ULL) |
-                ((k1>>8) & 0x000000FF00000000ULL) |
-                ((k1<<8) & 0x00000000FF000000ULL) |
-                ((k1>>8) & 0x0000000000FF0000ULL) |
-                ((k1<<8) & 0x000000000000FF00ULL) |
-                ((k1>>8) & 0x00000000000000FFULL);
-
-            k2 =((k2<<8) & 0xFF00000000000000ULL) |
-                ((k2>>8) & 0x00FF000000000000ULL) |
-                ((k2<<8) & 0x0000FF0000000000ULL) |
-                ((k2>>8) & 0x000000FF00000000ULL) |
-                ((k2<<8) & 0x00000000FF000000ULL) |
-                ((k2>>8) & 0x0000000000FF0000ULL) |
-                ((k2<<8) & 0x000000000000FF00ULL) |
-                ((k2>>8) & 0x00000000000000FFULL);
-        }
+        k = (k>>56) |
+            ((k<<40) & 0x00FF000000000000ULL) |
+            ((k<<24) & 0x0000FF0000000000ULL) |
+            ((k<<8)  & 0x000000FF00000000ULL) |
+            ((k>>8)  & 0x00000000FF000000ULL) |
+            ((k>>24) & 0x0000000000FF0000ULL) |
+            ((k>>40) & 0x000000000000FF00ULL) |
+            (k<<56);
+    }
+    else if (podSize == 4)
+    {
+        k = ((k<<24) & 0xFF00000000000000ULL) |
+            ((k<<8)  & 0x00FF000000000000ULL) |
+            ((k>>8)  & 0x0000FF0000000000ULL) |
+            ((k>>24) & 0x000000FF00000000ULL) |
+            ((k<<24) & 0x00000000FF000000ULL) |
+            ((k<<8)  & 0x0000000000FF0000ULL) |
+            ((k>>8)  & 0x000000000000FF00ULL) |
+            ((k>>24) & 0x00000000000000FFULL);
+    }
+    else if (podSize == 2)
+    {
+        k = ((k<<8) & 0xFF00000000000000ULL) |
+            ((k>>8) & 0x00FF000000000000ULL) |
+            ((k<<8) & 0x0000FF0000000000ULL) |
+            ((k>>8) & 0x000000FF00000000ULL) |
+            ((k<<8) & 0x00000000FF000000ULL) |
+            ((k>>8) & 0x0000000000FF0000ULL) |
+            ((k<<8) & 0x000000000000FF00ULL) |
+            ((k>>8) & 0x00000000000000FFULL);
+    }
 #endif
+    return k;
+}
 
-        k1 *= c1;
-        k1  = (k1 << 31) | (k1 >> 33);
-        k1 *= c2;
-        h1 ^= k1;
+//-*****************************************************************************
+inline void MixBlock( const uint8_t * block, size_t podSize,
+                      uint64_t & h1, uint64_t & h2 )
+{
+    uint64_t k1;
+    uint64_t k2;
+    memcpy( &k1, block, 8 );
+    memcpy( &k2, block + 8, 8 );
 
-        h1 = (h1 << 27) | (h1 >> 37);
-        h1 += h2;
-        h1 = h1*5+0x52dce729;
+    k1 = SwapBlock( k1, podSize );
+    k2 = SwapBlock( k2, podSize );
 
-        k2 *= c2;
-        k2  = (k2 << 33) | (k2 >> 31);
-        k2 *= c1;
-        h2 ^= k2;
+    k1 *= c1;
+    k1  = (k1 << 31) | (k1 >> 33);
+    k1 *= c2;
+    h1 ^= k1;
 
-        h2 = (h2 << 31) | (h2 >> 33);
-        h2 += h1;
-        h2 = h2*5+0x38495ab5;
-    }
+    h1 = (h1 << 27) | (h1 >> 37);
+    h1 += h2;
+    h1 = h1*5+0x52dce729;
 
-    //----------
-    // tail
+    k2 *= c2;
+    k2  = (k2 << 33) | (k2 >> 31);
+    k2 *= c1;
+    h2 ^= k2;
 
-#if (defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN) || (defined(BYTE_ORDER) && defined(BIG_ENDIAN) && BYTE_ORDER == BIG_ENDIAN)
-    const uint8_t * unswappedTail = (const uint8_t*)(data + nblocks*16);
+    h2 = (h2 << 31) | (h2 >> 33);
+    h2 += h1;
+    h2 = h2*5+0x38495ab5;
+}
+
+//-*****************************************************************************
+// Mixes in the last len & 15 bytes and finalizes the hash into out.
+void Finish( const uint8_t * unswappedTail, size_t podSize, size_t len,
+             uint64_t h1, uint64_t h2, void * out )
+{
+#ifdef ALEMBIC_MURMUR3_BIG_ENDIAN
     uint8_t tail[16];
     size_t tailSize = len & 15;
 
@@ -183,7 +158,7 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
         }
     }
 #else
-    const uint8_t * tail = (const uint8_t*)(data + nblocks*16);
+    const uint8_t * tail = unswappedTail;
 #endif
 
     uint64_t k1 = 0;
@@ -262,6 +237,79 @@ void MurmurHash3_x64_128 ( const void * key, const size_t len,
     ((uint64_t*)out)[1] = h2;
 }
 
+} // End anonymous namespace
+
+//-*****************************************************************************
+void MurmurHash3_x64_128 ( const void * key, const size_t len,
+                           const size_t podSize, void * out )
+{
+    const uint8_t * data = (const uint8_t*)key;
+    const size_t nblocks = len / 16;
+
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+
+    for(size_t i = 0; i < nblocks; i++)
+    {
+        MixBlock( data + i*16, podSize, h1, h2 );
+    }
+
+    Finish( data + nblocks*16, podSize, len, h1, h2, out );
+}
+
+//-*****************************************************************************
+MurmurHash3::MurmurHash3( size_t iPodSize )
+  : m_h1( 0 )
+  , m_h2( 0 )
+  , m_len( 0 )
+  , m_podSize( iPodSize )
+  , m_bufLen( 0 )
+{
+}
+
+//-*****************************************************************************
+void MurmurHash3::Update( const void * iData, size_t iLen )
+{
+    const uint8_t * data = (const uint8_t*)iData;
+    m_len += iLen;
+
+    // finish the block that was started by the last update
+    if ( m_bufLen > 0 )
+    {
+        size_t numCopy = std::min( iLen, sizeof( m_buf ) - m_bufLen );
+        memcpy( m_buf + m_bufLen, data, numCopy );
+        m_bufLen += numCopy;
+        data += numCopy;
+        iLen -= numCopy;
+
+        if ( m_bufLen < sizeof( m_buf ) )
+        {
+            return;
+        }
+
+        MixBlock( m_buf, m_podSize, m_h1, m_h2 );
+        m_bufLen = 0;
+    }
+
+    const size_t nblocks = iLen / 16;
+    for ( size_t i = 0; i < nblocks; ++i )
+    {
+        MixBlock( data + i*16, m_podSize, m_h1, m_h2 );
+    }
+
+    m_bufLen = iLen - nblocks*16;
+    if ( m_bufLen > 0 )
+    {
+        memcpy( m_buf, data + nblocks*16, m_bufLen );
+    }
+}
+
+//-*****************************************************************************
+void MurmurHash3::Final( void * oOut ) const
+{
+    Finish( m_buf, m_podSize, m_len, m_h1, m_h2, oOut );
+}
+
 } // End namespace ALEMBIC_VERSION_NS
 } // End namespace Util
 } // End namespace Alembic
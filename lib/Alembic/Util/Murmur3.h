@@ -50,6 +50,32 @@ ALEMBIC_EXPORT void
 MurmurHash3_x64_128 ( const void * key, const size_t len,
                       const size_t podSize, void * out );
 
+//-*****************************************************************************
+//! Incremental MurmurHash3_x64_128, hashing data a piece at a time gives the
+//! same 128 bit hash as hashing all of the pieces put together, so samples
+//! made of many pieces, like strings, can be hashed without copying them.
+//! iPodSize is the podSize given to MurmurHash3_x64_128.
+class ALEMBIC_EXPORT MurmurHash3
+{
+public:
+    explicit MurmurHash3( size_t iPodSize = 1 );
+
+    void Update( const void * iData, size_t iLen );
+
+    //! Writes the 128 bit hash of everything updated so far to oOut.
+    void Final( void * oOut ) const;
+
+private:
+    uint64_t m_h1;
+    uint64_t m_h2;
+    size_t m_len;
+    size_t m_podSize;
+
+    // the start of a block that Update didn't have all of yet
+    uint8_t m_buf[16];
+    size_t m_bufLen;
+};
+
 } // End namespace ALEMBIC_VERSION_NS
 
 using namespace ALEMBIC_VERSION_NS;
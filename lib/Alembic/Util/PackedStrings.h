@@ -0,0 +1,153 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_Util_PackedStrings_h
+#define Alembic_Util_PackedStrings_h
+
+#include <Alembic/Util/Foundation.h>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! \brief An array of strings kept in one buffer, each followed by a NULL,
+//!     plus where each of them starts.
+//!
+//! This is how string array samples are stored, so a sample can be read or
+//! written as one block instead of allocating a std::basic_string per
+//! element.  A std::basic_string is only made when asked for via get().
+template <class CHAR>
+class TPackedStrings
+{
+public:
+    typedef CHAR char_type;
+    typedef std::basic_string< CHAR > string_type;
+
+    TPackedStrings() : m_offsets( 1, 0 ) {}
+
+    //! The number of strings.
+    size_t size() const { return m_offsets.size() - 1; }
+
+    bool empty() const { return m_offsets.size() == 1; }
+
+    //! The NULL terminated string at iIndex.
+    const CHAR * c_str( size_t iIndex ) const
+    { return &m_chars[m_offsets[iIndex]]; }
+
+    //! The length of the string at iIndex, without its NULL.
+    size_t length( size_t iIndex ) const
+    { return m_offsets[iIndex + 1] - m_offsets[iIndex] - 1; }
+
+    string_type get( size_t iIndex ) const
+    { return string_type( c_str( iIndex ), length( iIndex ) ); }
+
+    string_type operator[]( size_t iIndex ) const { return get( iIndex ); }
+
+    //! Every string, each followed by its NULL.
+    const CHAR * data() const
+    { return m_chars.empty() ? NULL : &m_chars.front(); }
+
+    //! The number of characters in data(), including the NULLs.
+    size_t numChars() const { return m_chars.size(); }
+
+    void reserve( size_t iNumStrings, size_t iNumChars )
+    {
+        m_offsets.reserve( iNumStrings + 1 );
+        m_chars.reserve( iNumChars );
+    }
+
+    void clear()
+    {
+        m_chars.clear();
+        m_offsets.resize( 1 );
+    }
+
+    //! Appends iLength characters of iStr and a NULL, iStr itself should
+    //! not have any NULLs since they would split it when read back.
+    void push_back( const CHAR * iStr, size_t iLength )
+    {
+        m_chars.insert( m_chars.end(), iStr, iStr + iLength );
+        m_chars.push_back( 0 );
+        m_offsets.push_back( m_chars.size() );
+    }
+
+    void push_back( const string_type & iStr )
+    { push_back( iStr.data(), iStr.length() ); }
+
+    //! Takes the characters of ioChars, which are strings that are each
+    //! followed by a NULL, and finds where they start.  ioChars is left
+    //! with what this held before.
+    void swapChars( std::vector< CHAR > & ioChars )
+    {
+        m_chars.swap( ioChars );
+        m_offsets.resize( 1 );
+
+        for ( size_t i = 0; i < m_chars.size(); ++i )
+        {
+            if ( m_chars[i] == 0 )
+            {
+                m_offsets.push_back( i + 1 );
+            }
+        }
+    }
+
+    //! Copies every string out as a std::basic_string.
+    void getStrings( std::vector< string_type > & oStrings ) const
+    {
+        oStrings.resize( size() );
+        for ( size_t i = 0; i < oStrings.size(); ++i )
+        {
+            oStrings[i].assign( c_str( i ), length( i ) );
+        }
+    }
+
+private:
+    std::vector< CHAR > m_chars;
+    std::vector< size_t > m_offsets;
+};
+
+typedef TPackedStrings< char > PackedStrings;
+typedef TPackedStrings< wchar_t > PackedWstrings;
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
@@ -0,0 +1,241 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/TaskPool.h>
+
+#include <chrono>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+TaskPool::TaskPool( std::size_t iNumThreads )
+    : m_stop( false )
+{
+    if ( iNumThreads == 0 )
+    {
+        iNumThreads = std::thread::hardware_concurrency();
+    }
+
+    // the thread that waits on a group does work too, so it counts as one
+    for ( std::size_t i = 1; i < iNumThreads; ++i )
+    {
+        m_workers.push_back( std::thread( &TaskPool::workerLoop, this ) );
+    }
+}
+
+//-*****************************************************************************
+TaskPool::~TaskPool()
+{
+    {
+        std::lock_guard< std::mutex > l( m_mutex );
+        m_stop = true;
+    }
+    m_cond.notify_all();
+
+    for ( std::size_t i = 0; i < m_workers.size(); ++i )
+    {
+        m_workers[i].join();
+    }
+}
+
+//-*****************************************************************************
+void TaskPool::enqueue( const Task & iTask )
+{
+    {
+        std::lock_guard< std::mutex > l( m_mutex );
+        m_tasks.push_back( iTask );
+    }
+    m_cond.notify_one();
+}
+
+//-*****************************************************************************
+bool TaskPool::runOne()
+{
+    Task task;
+    {
+        std::lock_guard< std::mutex > l( m_mutex );
+        if ( m_tasks.empty() )
+        {
+            return false;
+        }
+
+        // the most recently queued work is the most likely to still be warm
+        // in cache and deepest in any recursion, so take from the back
+        task = m_tasks.back();
+        m_tasks.pop_back();
+    }
+
+    task();
+    return true;
+}
+
+//-*****************************************************************************
+void TaskPool::workerLoop()
+{
+    for ( ;; )
+    {
+        Task task;
+        {
+            std::unique_lock< std::mutex > l( m_mutex );
+            while ( !m_stop && m_tasks.empty() )
+            {
+                m_cond.wait( l );
+            }
+
+            if ( m_tasks.empty() )
+            {
+                return;
+            }
+
+            // workers take the oldest work which tends to be the biggest
+            task = m_tasks.front();
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+//-*****************************************************************************
+TaskPool & TaskPool::getDefault()
+{
+    static TaskPool pool;
+    return pool;
+}
+
+//-*****************************************************************************
+TaskGroup::TaskGroup( TaskPool & iPool )
+    : m_pool( iPool )
+    , m_pending( 0 )
+{
+}
+
+//-*****************************************************************************
+TaskGroup::~TaskGroup()
+{
+    try
+    {
+        wait();
+    }
+    catch ( ... )
+    {
+    }
+}
+
+//-*****************************************************************************
+void TaskGroup::run( const TaskPool::Task & iTask )
+{
+    if ( m_pool.getNumThreads() < 2 )
+    {
+        try
+        {
+            iTask();
+        }
+        catch ( ... )
+        {
+            std::lock_guard< std::mutex > l( m_mutex );
+            if ( !m_error )
+            {
+                m_error = std::current_exception();
+            }
+        }
+        return;
+    }
+
+    ++m_pending;
+    m_pool.enqueue( [this, iTask]()
+    {
+        std::exception_ptr error;
+        try
+        {
+            iTask();
+        }
+        catch ( ... )
+        {
+            error = std::current_exception();
+        }
+        finish( error );
+    } );
+}
+
+//-*****************************************************************************
+void TaskGroup::finish( std::exception_ptr iError )
+{
+    std::lock_guard< std::mutex > l( m_mutex );
+    if ( iError && !m_error )
+    {
+        m_error = iError;
+    }
+    --m_pending;
+    m_cond.notify_all();
+}
+
+//-*****************************************************************************
+void TaskGroup::wait()
+{
+    while ( m_pending > 0 )
+    {
+        // help out rather than sit idle, this is what keeps nested groups
+        // from starving the pool
+        if ( m_pool.runOne() )
+        {
+            continue;
+        }
+
+        std::unique_lock< std::mutex > l( m_mutex );
+        if ( m_pending > 0 )
+        {
+            m_cond.wait_for( l, std::chrono::milliseconds( 1 ) );
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard< std::mutex > l( m_mutex );
+        std::swap( error, m_error );
+    }
+
+    if ( error )
+    {
+        std::rethrow_exception( error );
+    }
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+} // End namespace Util
+} // End namespace Alembic
@@ -0,0 +1,167 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef Alembic_Util_TaskPool_h
+#define Alembic_Util_TaskPool_h
+
+#include <Alembic/Util/Export.h>
+#include <Alembic/Util/Foundation.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Alembic {
+namespace Util {
+namespace ALEMBIC_VERSION_NS {
+
+//-*****************************************************************************
+//! \brief A small fixed size pool of worker threads that pulls tasks off of a
+//!     single shared queue.
+//!
+//! Tasks are usually submitted via a TaskGroup so that the caller can wait
+//! on just the work it cares about.  Threads waiting on a TaskGroup help
+//! execute queued tasks instead of blocking, so it is safe for a task to
+//! create and wait on its own nested TaskGroup (e.g. when recursing down an
+//! object hierarchy).
+class ALEMBIC_EXPORT TaskPool : noncopyable
+{
+public:
+    typedef std::function< void() > Task;
+
+    //! Creates a pool with iNumThreads workers.  0 means use the number of
+    //! hardware threads, and 1 means every task runs on the thread that
+    //! waits on it.
+    explicit TaskPool( std::size_t iNumThreads = 0 );
+
+    ~TaskPool();
+
+    //! The number of threads that can be working at once, including the
+    //! thread that is waiting on the results.
+    std::size_t getNumThreads() const { return m_workers.size() + 1; }
+
+    //! Queue up a task to be run by the next available thread.
+    void enqueue( const Task & iTask );
+
+    //! Pops one pending task and runs it on the calling thread.
+    //! Returns false if there was nothing to run.
+    bool runOne();
+
+    //! The process wide pool shared by the library.
+    static TaskPool & getDefault();
+
+private:
+    void workerLoop();
+
+    std::vector< std::thread > m_workers;
+    std::deque< Task > m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    bool m_stop;
+};
+
+//-*****************************************************************************
+//! \brief A set of tasks run on a TaskPool that can be waited on together.
+//!
+//! The first exception thrown by any of the tasks is rethrown from wait().
+class ALEMBIC_EXPORT TaskGroup : noncopyable
+{
+public:
+    explicit TaskGroup( TaskPool & iPool = TaskPool::getDefault() );
+
+    //! Waits for any outstanding tasks, exceptions are swallowed here so
+    //! call wait() explicitly if you care about them.
+    ~TaskGroup();
+
+    void run( const TaskPool::Task & iTask );
+
+    //! Blocks until every task handed to run() has finished, helping the
+    //! pool while it waits.
+    void wait();
+
+    TaskPool & getPool() { return m_pool; }
+
+private:
+    void finish( std::exception_ptr iError );
+
+    TaskPool & m_pool;
+    std::atomic< std::size_t > m_pending;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::exception_ptr m_error;
+};
+
+//-*****************************************************************************
+//! Calls iFunc( i ) for every i in [iBegin, iEnd) spread across the pool,
+//! and waits for them all to finish.
+template < class FUNC >
+void ParallelFor( std::size_t iBegin, std::size_t iEnd, FUNC iFunc,
+                  TaskPool & iPool = TaskPool::getDefault() )
+{
+    if ( iEnd <= iBegin )
+    {
+        return;
+    }
+
+    if ( iEnd - iBegin == 1 || iPool.getNumThreads() < 2 )
+    {
+        for ( std::size_t i = iBegin; i < iEnd; ++i )
+        {
+            iFunc( i );
+        }
+        return;
+    }
+
+    TaskGroup group( iPool );
+    for ( std::size_t i = iBegin; i < iEnd; ++i )
+    {
+        group.run( [&iFunc, i]() { iFunc( i ); } );
+    }
+    group.wait();
+}
+
+} // End namespace ALEMBIC_VERSION_NS
+
+using namespace ALEMBIC_VERSION_NS;
+
+} // End namespace Util
+} // End namespace Alembic
+
+#endif
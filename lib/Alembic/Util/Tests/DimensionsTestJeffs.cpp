@@ -94,6 +94,56 @@ int main( int, char** )
         assert( rank2_copy == rank3 );
     }
 
+    //
+    // Test ranks past what is stored inline
+    //
+    {
+        Dimensions rank6;
+        rank6.setRank( 6 );
+        assert( rank6.rank() == 6 );
+        for ( size_t i = 0; i < 6; ++i )
+        {
+            assert( rank6[i] == 0 );
+            rank6[i] = i + 1;
+        }
+        assert( rank6.numPoints() == 720 );
+        assert( rank6.rootPtr()[5] == 6 );
+
+        Dimensions rank6_copy( rank6 );
+        assert( rank6_copy == rank6 );
+
+        BaseDimensions<int> rank6_int( rank6 );
+        assert( rank6_int.rank() == 6 );
+        assert( rank6_int[5] == 6 );
+        assert( rank6_int == rank6 );
+
+        // back down to inline storage keeps the first ranks
+        rank6.setRank( 2 );
+        assert( rank6.rank() == 2 );
+        assert( rank6[0] == 1 );
+        assert( rank6[1] == 2 );
+        assert( rank6.numPoints() == 2 );
+
+        // and growing again zeroes the new ones
+        rank6.setRank( 5 );
+        assert( rank6[1] == 2 );
+        assert( rank6[2] == 0 );
+        assert( rank6[4] == 0 );
+
+        rank6_copy = Dimensions( 7 );
+        assert( rank6_copy.rank() == 1 );
+        assert( rank6_copy.numPoints() == 7 );
+
+        rank6_copy = rank6_int;
+        assert( rank6_copy.rank() == 6 );
+        assert( rank6_copy.numPoints() == 720 );
+
+        Dimensions rank0;
+        assert( rank0.numPoints() == 0 );
+        rank6_copy = rank0;
+        assert( rank6_copy.rank() == 0 );
+    }
+
     std::cout << "Success!" << std::endl;
 
     return 0;
@@ -0,0 +1,110 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Alembic/Util/TaskPool.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <assert.h>
+
+namespace AU = Alembic::Util;
+
+//-*****************************************************************************
+void recurse( AU::TaskPool & iPool, std::size_t iDepth,
+              std::atomic< std::size_t > & oCount )
+{
+    ++oCount;
+    if ( iDepth == 0 )
+    {
+        return;
+    }
+
+    // nested groups must not deadlock even with more tasks than threads
+    AU::TaskGroup group( iPool );
+    for ( std::size_t i = 0; i < 4; ++i )
+    {
+        group.run( [&iPool, iDepth, &oCount]()
+            { recurse( iPool, iDepth - 1, oCount ); } );
+    }
+    group.wait();
+}
+
+//-*****************************************************************************
+void testPool( std::size_t iNumThreads )
+{
+    AU::TaskPool pool( iNumThreads );
+    assert( iNumThreads == 0 || pool.getNumThreads() == iNumThreads );
+
+    std::atomic< std::size_t > count( 0 );
+    recurse( pool, 5, count );
+
+    // 1 + 4 + 16 + 64 + 256 + 1024
+    assert( count == 1365 );
+
+    std::vector< std::size_t > vals( 1000, 0 );
+    AU::ParallelFor( 0, vals.size(),
+                     [&vals]( std::size_t i ) { vals[i] = i * 2; }, pool );
+    for ( std::size_t i = 0; i < vals.size(); ++i )
+    {
+        assert( vals[i] == i * 2 );
+    }
+
+    bool caught = false;
+    AU::TaskGroup group( pool );
+    group.run( []() { throw std::runtime_error( "task failed" ); } );
+    group.run( []() {} );
+    try
+    {
+        group.wait();
+    }
+    catch ( std::runtime_error & )
+    {
+        caught = true;
+    }
+    assert( caught );
+}
+
+//-*****************************************************************************
+int main( int argc, char *argv[] )
+{
+    testPool( 1 );
+    testPool( 2 );
+    testPool( 8 );
+    testPool( 0 );
+
+    std::cout << "Success!" << std::endl;
+    return 0;
+}
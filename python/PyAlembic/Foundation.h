@@ -107,4 +107,55 @@ inline void throwPythonIndexException( const char* iMessage )
     throw boost::python::error_already_set();
 }
 
+//-*****************************************************************************
+// Releases the GIL for as long as it is in scope, so other Python threads
+// can run while we are blocked reading and decompressing.  Nothing may touch
+// a Python object while one of these is alive.
+class ScopedReleaseGIL : boost::noncopyable
+{
+public:
+    ScopedReleaseGIL() : m_state( PyEval_SaveThread() ) {}
+    ~ScopedReleaseGIL() { PyEval_RestoreThread( m_state ); }
+
+private:
+    PyThreadState *m_state;
+};
+
+//-*****************************************************************************
+// Schema and geom param readers to bind in place of getValue, get,
+// getIndexedValue and getExpandedValue, releasing the GIL around the read.
+template <class SCHEMA>
+auto getValueWithoutGIL( SCHEMA &iSchema, const Abc::ISampleSelector &iSS )
+    -> decltype( iSchema.getValue( iSS ) )
+{
+    ScopedReleaseGIL release;
+    return iSchema.getValue( iSS );
+}
+
+template <class SCHEMA, class SAMPLE>
+void getWithoutGIL( SCHEMA &iSchema, SAMPLE &oSample,
+                    const Abc::ISampleSelector &iSS )
+{
+    ScopedReleaseGIL release;
+    iSchema.get( oSample, iSS );
+}
+
+template <class GEOMPARAM>
+typename GEOMPARAM::Sample
+getIndexedValueWithoutGIL( GEOMPARAM &iParam,
+                           const Abc::ISampleSelector &iSS )
+{
+    ScopedReleaseGIL release;
+    return iParam.getIndexedValue( iSS );
+}
+
+template <class GEOMPARAM>
+typename GEOMPARAM::Sample
+getExpandedValueWithoutGIL( GEOMPARAM &iParam,
+                            const Abc::ISampleSelector &iSS )
+{
+    ScopedReleaseGIL release;
+    return iParam.getExpandedValue( iSS );
+}
+
 #endif
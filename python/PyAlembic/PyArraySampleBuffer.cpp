@@ -0,0 +1,288 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Foundation.h>
+#include <PyArraySampleBuffer.h>
+
+using namespace boost::python;
+
+#if PY_MAJOR_VERSION < 3
+#define ALEMBIC_PYTHON_BUFFER_FLAGS Py_TPFLAGS_HAVE_NEWBUFFER
+#else
+#define ALEMBIC_PYTHON_BUFFER_FLAGS 0
+#endif
+
+namespace {
+
+//-*****************************************************************************
+struct ArraySampleBufferObject
+{
+    PyObject_HEAD
+
+    // allocated with new since Python doesn't run our constructors
+    AbcA::ArraySamplePtr *samp;
+
+    int ndim;
+    Py_ssize_t itemsize;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+    char format[2];
+};
+
+//-*****************************************************************************
+// struct module format characters, which is what numpy expects
+char PODFormat( AbcU::PlainOldDataType iPod )
+{
+    switch ( iPod )
+    {
+        case AbcU::kBooleanPOD: return '?';
+        case AbcU::kUint8POD:   return 'B';
+        case AbcU::kInt8POD:    return 'b';
+        case AbcU::kUint16POD:  return 'H';
+        case AbcU::kInt16POD:   return 'h';
+        case AbcU::kUint32POD:  return 'I';
+        case AbcU::kInt32POD:   return 'i';
+        case AbcU::kUint64POD:  return 'Q';
+        case AbcU::kInt64POD:   return 'q';
+        case AbcU::kFloat16POD: return 'e';
+        case AbcU::kFloat32POD: return 'f';
+        case AbcU::kFloat64POD: return 'd';
+        default: return 0;
+    }
+}
+
+//-*****************************************************************************
+// 'i' and 'l' (and 'l' and 'q') can both be 4 (or 8) bytes depending on the
+// platform, so formats are matched on their kind and the itemsize instead
+int FormatKind( char iFormat )
+{
+    switch ( iFormat )
+    {
+        case '?':
+            return 0;
+        case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+            return 1;
+        case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+            return 2;
+        case 'e': case 'f': case 'd':
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+//-*****************************************************************************
+bool IsNativeByteOrder( char iOrder )
+{
+    if ( iOrder == '@' || iOrder == '=' )
+    {
+        return true;
+    }
+
+    const AbcU::uint16_t one = 1;
+    bool littleEndian = *reinterpret_cast< const AbcU::uint8_t * >( &one ) == 1;
+    return littleEndian ? iOrder == '<' : ( iOrder == '>' || iOrder == '!' );
+}
+
+//-*****************************************************************************
+void bufferDealloc( PyObject *iSelf )
+{
+    ArraySampleBufferObject *self =
+        reinterpret_cast< ArraySampleBufferObject * >( iSelf );
+    delete self->samp;
+    Py_TYPE( iSelf )->tp_free( iSelf );
+}
+
+//-*****************************************************************************
+int bufferGet( PyObject *iSelf, Py_buffer *oView, int iFlags )
+{
+    if ( ( iFlags & PyBUF_WRITABLE ) == PyBUF_WRITABLE )
+    {
+        PyErr_SetString( PyExc_BufferError,
+                         "ArraySample buffers are read only" );
+        oView->obj = NULL;
+        return -1;
+    }
+
+    ArraySampleBufferObject *self =
+        reinterpret_cast< ArraySampleBufferObject * >( iSelf );
+
+    oView->buf = const_cast< void * >( ( *self->samp )->getData() );
+    oView->obj = iSelf;
+    Py_INCREF( iSelf );
+    oView->len = self->itemsize * self->shape[0] *
+        ( self->ndim == 2 ? self->shape[1] : 1 );
+    oView->readonly = 1;
+    oView->itemsize = self->itemsize;
+    oView->format = ( iFlags & PyBUF_FORMAT ) ? self->format : NULL;
+    oView->ndim = self->ndim;
+    oView->shape = ( iFlags & PyBUF_ND ) == PyBUF_ND ? self->shape : NULL;
+    oView->strides =
+        ( iFlags & PyBUF_STRIDES ) == PyBUF_STRIDES ? self->strides : NULL;
+    oView->suboffsets = NULL;
+    oView->internal = NULL;
+
+    return 0;
+}
+
+PyBufferProcs bufferProcs;
+PyTypeObject bufferType = { PyVarObject_HEAD_INIT( NULL, 0 ) };
+
+//-*****************************************************************************
+bool initBufferType()
+{
+    if ( bufferType.tp_flags & Py_TPFLAGS_READY )
+    {
+        return true;
+    }
+
+    bufferProcs.bf_getbuffer = &bufferGet;
+    bufferProcs.bf_releasebuffer = NULL;
+
+    bufferType.tp_name = "alembic.Abc.ArraySampleBuffer";
+    bufferType.tp_basicsize = sizeof( ArraySampleBufferObject );
+    bufferType.tp_dealloc = &bufferDealloc;
+    bufferType.tp_flags = Py_TPFLAGS_DEFAULT | ALEMBIC_PYTHON_BUFFER_FLAGS;
+    bufferType.tp_doc = "A read only buffer over the data of an ArraySample";
+    bufferType.tp_as_buffer = &bufferProcs;
+
+    return PyType_Ready( &bufferType ) == 0;
+}
+
+} // namespace
+
+//-*****************************************************************************
+object ArraySampleToBuffer( AbcA::ArraySamplePtr iSamp )
+{
+    if ( !iSamp )
+    {
+        return object();
+    }
+
+    const AbcA::DataType &dataType = iSamp->getDataType();
+    char format = PODFormat( dataType.getPod() );
+    if ( !format )
+    {
+        PyErr_SetString( PyExc_TypeError,
+                         "Only numeric ArraySamples can be used as buffers" );
+        throw_error_already_set();
+    }
+
+    if ( !initBufferType() )
+    {
+        throw_error_already_set();
+    }
+
+    ArraySampleBufferObject *self =
+        PyObject_New( ArraySampleBufferObject, &bufferType );
+    if ( !self )
+    {
+        throw_error_already_set();
+    }
+
+    self->samp = new AbcA::ArraySamplePtr( iSamp );
+    self->itemsize = AbcU::PODNumBytes( dataType.getPod() );
+    self->format[0] = format;
+    self->format[1] = 0;
+
+    Py_ssize_t extent = dataType.getExtent();
+    self->shape[0] = iSamp->getDimensions().numPoints();
+    self->shape[1] = extent;
+    self->strides[0] = self->itemsize * extent;
+    self->strides[1] = self->itemsize;
+    self->ndim = extent > 1 ? 2 : 1;
+
+    return object( handle<>( reinterpret_cast< PyObject * >( self ) ) );
+}
+
+//-*****************************************************************************
+bool BufferToData( PyObject *iObj, AbcU::PlainOldDataType iPod,
+                   AbcU::uint8_t iExtent, const void *&oData,
+                   std::size_t &oNumElements )
+{
+    char podFormat = PODFormat( iPod );
+    if ( !podFormat || !PyObject_CheckBuffer( iObj ) )
+    {
+        return false;
+    }
+
+    Py_buffer view;
+    if ( PyObject_GetBuffer( iObj, &view,
+                             PyBUF_C_CONTIGUOUS | PyBUF_FORMAT ) != 0 )
+    {
+        PyErr_Clear();
+        return false;
+    }
+
+    const char *format = view.format ? view.format : "B";
+    if ( *format && strchr( "@=<>!", *format ) )
+    {
+        if ( !IsNativeByteOrder( *format ) )
+        {
+            PyBuffer_Release( &view );
+            return false;
+        }
+        ++format;
+    }
+
+    std::size_t elementBytes = AbcU::PODNumBytes( iPod ) * iExtent;
+    bool matches = format[0] && !format[1] &&
+        FormatKind( format[0] ) == FormatKind( podFormat ) &&
+        view.itemsize == static_cast< Py_ssize_t >(
+            AbcU::PODNumBytes( iPod ) ) &&
+        view.len % elementBytes == 0;
+
+    if ( matches )
+    {
+        oData = view.buf;
+        oNumElements = view.len / elementBytes;
+    }
+
+    PyBuffer_Release( &view );
+    return matches;
+}
+
+//-*****************************************************************************
+void register_arraysamplebuffer()
+{
+    if ( !initBufferType() )
+    {
+        throw_error_already_set();
+    }
+
+    scope().attr( "ArraySampleBuffer" ) = object( handle<>(
+        borrowed( reinterpret_cast< PyObject * >( &bufferType ) ) ) );
+}
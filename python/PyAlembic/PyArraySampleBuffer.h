@@ -0,0 +1,59 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#ifndef PyAlembic_PyArraySampleBuffer_h
+#define PyAlembic_PyArraySampleBuffer_h
+
+#include <Foundation.h>
+
+//-*****************************************************************************
+//! Returns a read only Python buffer over the data of iSamp which keeps
+//! iSamp alive for as long as the buffer, or any view made from it, is.
+//! numpy.asarray() and memoryview() of the result therefore don't copy.
+//! Samples with an extent greater than 1 are exposed as 2 dimensional,
+//! string samples can't be exposed and raise a TypeError.
+boost::python::object ArraySampleToBuffer( AbcA::ArraySamplePtr iSamp );
+
+//-*****************************************************************************
+//! Returns true if iObj exports a C contiguous buffer whose items are iPod
+//! and whose size is a whole number of iExtent sized elements, in which
+//! case oData and oNumElements describe it.  The data stays valid for as
+//! long as iObj does, provided iObj isn't resized.
+bool BufferToData( PyObject *iObj, AbcU::PlainOldDataType iPod,
+                   AbcU::uint8_t iExtent, const void *&oData,
+                   std::size_t &oNumElements );
+
+#endif
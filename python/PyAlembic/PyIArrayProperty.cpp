@@ -38,6 +38,7 @@
 #include <PyIBaseProperty.h>
 #include <PyIPropertyUtil.h>
 #include <PyTypeBindingUtil.h>
+#include <PyArraySampleBuffer.h>
 
 using namespace boost::python;
 
@@ -68,13 +69,23 @@ template<>
 object getValue ( Abc::IArrayProperty &p,
                          const Abc::ISampleSelector &iSS,
                          const ReturnTypeEnum returnType )
+{
+    AbcA::ArraySamplePtr ptr;
+    {
+        ScopedReleaseGIL release;
+        p.get( ptr, iSS );
+    }
+
+    return getArrayValue( p, ptr );
+}
+
+//-*****************************************************************************
+object getArrayValue( Abc::IArrayProperty &p, AbcA::ArraySamplePtr ptr )
 {
     // Determine the type & extent of the array property and return its value.
     const AbcA::DataType &dt = p.getDataType();
     AbcU::PlainOldDataType pod = dt.getPod();
     const AbcU::uint8_t extent = dt.getExtent();
-    AbcU::Dimensions dims;
-    p.getDimensions( dims, iSS );
 
     // POD data types
     if( pod < 0 || pod >= AbcU::kNumPlainOldDataTypes )
@@ -86,9 +97,6 @@ object getValue ( Abc::IArrayProperty &p,
         return object(); // Returns None object
     }
 
-    AbcA::ArraySamplePtr ptr;
-    p.get( ptr, iSS );
-
     if (extent == 1)
     {
         switch ( pod )
@@ -241,6 +249,19 @@ static std::string getKey( Abc::IArrayProperty &p,
     return std::string();
 }
 
+//-*****************************************************************************
+static object getBuffer( Abc::IArrayProperty &p,
+                         const Abc::ISampleSelector &iSS )
+{
+    AbcA::ArraySamplePtr ptr;
+    {
+        ScopedReleaseGIL release;
+        p.get( ptr, iSS );
+    }
+
+    return ArraySampleToBuffer( ptr );
+}
+
 //-*****************************************************************************
 void register_iarrayproperty()
 {
@@ -312,6 +333,12 @@ void register_iarrayproperty()
               Overloads::getAllValue,
               ( arg( "iSS" ) = Abc::ISampleSelector() ),
               "Return the sample with the given ISampleSelector" )
+        .def( "getBuffer",
+              &getBuffer,
+              ( arg( "iSS" ) = Abc::ISampleSelector() ),
+              "Return the sample with the given ISampleSelector as a read "
+              "only buffer which numpy.asarray() or memoryview() can view "
+              "without copying" )
         .def( "getDimension", &getDimension )
         .def( "getParent",
               &Abc::IArrayProperty::getParent,
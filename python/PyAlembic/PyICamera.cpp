@@ -82,7 +82,7 @@ void register_icamera()
         .def( "getChildBoundsProperty",
               &AbcG::ICameraSchema::getChildBoundsProperty )
         .def( "getValue",
-              &AbcG::ICameraSchema::getValue,
+              &getValueWithoutGIL<AbcG::ICameraSchema>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "valid", &AbcG::ICameraSchema::valid )
         .def( "reset", &AbcG::ICameraSchema::reset )
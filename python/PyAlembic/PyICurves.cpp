@@ -83,10 +83,11 @@ void register_icurves()
         .def( "getTimeSampling",
               &AbcG::ICurvesSchema::getTimeSampling )
         .def( "get",
-              &AbcG::ICurvesSchema::get,
+              &getWithoutGIL<AbcG::ICurvesSchema,
+                             AbcG::ICurvesSchema::Sample>,
               ( arg( "sample" ), arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getValue",
-              &AbcG::ICurvesSchema::getValue,
+              &getValueWithoutGIL<AbcG::ICurvesSchema>,
               ( arg( "iSampSelector" ) = Abc::ISampleSelector() ) )
         .def( "getVelocitiesProperty",
               &AbcG::ICurvesSchema::getVelocitiesProperty )
@@ -78,7 +78,7 @@ void register_ifaceset()
         .def( "getNumSamples",
               &AbcG::IFaceSetSchema::getNumSamples )
         .def( "getValue",
-              &AbcG::IFaceSetSchema::getValue,
+              &getValueWithoutGIL<AbcG::IFaceSetSchema>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getFaceExclusivity",
               &AbcG::IFaceSetSchema::getFaceExclusivity )
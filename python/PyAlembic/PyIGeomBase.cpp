@@ -94,10 +94,11 @@ void register_igeombase()
         .def( "getTimeSampling",
               &AbcG::IGeomBase::getTimeSampling )
         .def( "get",
-              &AbcG::IGeomBase::get,
+              &getWithoutGIL<AbcG::IGeomBase,
+                             AbcG::IGeomBase::Sample>,
               ( arg( "oSample" ), arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getValue",
-              &AbcG::IGeomBase::getValue,
+              &getValueWithoutGIL<AbcG::IGeomBase>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getArbGeomParams",
               &AbcG::IGeomBase::getArbGeomParams )
@@ -67,10 +67,10 @@ static void register_( const char* iName )
                      arg( "argument" ), arg( "argument" ) ),
                    "doc") )
         .def( "getIndexedValue",
-              &IGEOMPARAM::getIndexedValue,
+              &getIndexedValueWithoutGIL<IGEOMPARAM>,
               ( arg( "iSampleSelector" ) = Abc::ISampleSelector() ) )
         .def( "getExpandedValue",
-              &IGEOMPARAM::getExpandedValue,
+              &getExpandedValueWithoutGIL<IGEOMPARAM>,
               ( arg( "iSampleSelector" ) = Abc::ISampleSelector() ) )
         .def( "getNumSamples",
               &IGEOMPARAM::getNumSamples )
@@ -83,10 +83,11 @@ void register_inupatch()
         .def( "getTimeSampling",
               &AbcG::INuPatchSchema::getTimeSampling )
         .def( "get",
-              &AbcG::INuPatchSchema::get,
+              &getWithoutGIL<AbcG::INuPatchSchema,
+                             AbcG::INuPatchSchema::Sample>,
               ( arg( "sample" ), arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getValue",
-              &AbcG::INuPatchSchema::getValue,
+              &getValueWithoutGIL<AbcG::INuPatchSchema>,
               ( arg( "iSampSelector" ) = Abc::ISampleSelector() ) )
         .def( "getPositionsProperty",
               &AbcG::INuPatchSchema::getPositionsProperty )
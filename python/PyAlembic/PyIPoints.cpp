@@ -85,7 +85,7 @@ void register_ipoints()
         .def( "getWidthsParam",
               &AbcG::IPointsSchema::getWidthsParam )
         .def( "getValue",
-              &AbcG::IPointsSchema::getValue,
+              &getValueWithoutGIL<AbcG::IPointsSchema>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getTimeSampling",
               &AbcG::IPointsSchema::getTimeSampling )
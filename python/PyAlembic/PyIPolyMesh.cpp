@@ -104,7 +104,7 @@ void register_ipolymesh()
         .def( "getTimeSampling",
               &AbcG::IPolyMeshSchema::getTimeSampling )
         .def( "getValue",
-              &AbcG::IPolyMeshSchema::getValue,
+              &getValueWithoutGIL<AbcG::IPolyMeshSchema>,
               ( arg( "iSampSelector" ) = Abc::ISampleSelector() ) )
         .def( "getUVsParam",
               &AbcG::IPolyMeshSchema::getUVsParam )
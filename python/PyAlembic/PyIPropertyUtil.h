@@ -53,6 +53,15 @@ boost::python::object
 getValue( PROP &p, const Abc::ISampleSelector &iSS,
           const ReturnTypeEnum iReturnType = kReturnAll );
 
+//-*****************************************************************************
+// Conversions for samples which have already been read from p, as
+// ReadSamples does.  iData holds p's extent worth of PODs.
+boost::python::object
+getArrayValue( Abc::IArrayProperty &p, AbcA::ArraySamplePtr iSamp );
+
+boost::python::object
+getScalarValue( Abc::IScalarProperty &p, const void *iData );
+
 //-*****************************************************************************
 //
 // SampleList and SampleIterator
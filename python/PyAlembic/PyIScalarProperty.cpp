@@ -42,9 +42,11 @@
 using namespace boost::python;
 
 //-*****************************************************************************
+// When iData isn't NULL the sample was already read and is copied from it.
 template<class TPTraits>
 static object getPODValue( Abc::IScalarProperty &p,
-                           const Abc::ISampleSelector &iSS )
+                           const Abc::ISampleSelector &iSS,
+                           const void *iData )
 {
     typedef TypeBindingTraits<TPTraits> binding_traits;
     typedef typename binding_traits::python_value_type T;
@@ -52,7 +54,15 @@ static object getPODValue( Abc::IScalarProperty &p,
 
     // Return the scalar property's value of type T.
     U val;
-    p.get( reinterpret_cast<void*>( &val ), iSS );
+    if ( iData )
+    {
+        val = *reinterpret_cast<const U*>( iData );
+    }
+    else
+    {
+        ScopedReleaseGIL release;
+        p.get( reinterpret_cast<void*>( &val ), iSS );
+    }
 
     typename return_by_value::apply<T>::type converter;
 
@@ -63,16 +73,29 @@ static object getPODValue( Abc::IScalarProperty &p,
 template<class TPTraits>
 static object getSmallArrayValue( Abc::IScalarProperty &p,
                                   const Abc::ISampleSelector &iSS,
-                                  size_t iExtent )
+                                  size_t iExtent,
+                                  const void *iData )
 {
     typedef Abc::TypedArraySample<TPTraits> samp_type;
     typedef AbcU::shared_ptr<samp_type>     samp_ptr_type;
+    typedef typename TPTraits::value_type   value_type;
 
     // Get the scalar property's array value of type U as an ArraySample.
     AbcU::Dimensions dims( iExtent );
     AbcA::ArraySamplePtr sampPtr =
         AbcA::AllocateArraySample( TPTraits::dataType(), dims );
-    p.get( const_cast<void*>( sampPtr->getData() ), iSS );
+    value_type *sampData =
+        reinterpret_cast<value_type*>( const_cast<void*>( sampPtr->getData() ) );
+    if ( iData )
+    {
+        const value_type *src = reinterpret_cast<const value_type*>( iData );
+        std::copy( src, src + iExtent, sampData );
+    }
+    else
+    {
+        ScopedReleaseGIL release;
+        p.get( sampData, iSS );
+    }
 
     samp_ptr_type typedSampPtr =
         AbcU::static_pointer_cast<samp_type>( sampPtr );
@@ -85,20 +108,21 @@ static object getSmallArrayValue( Abc::IScalarProperty &p,
 //-*****************************************************************************
 #define CASE_RETURN_POD_VALUE( TPTraits, PROP, SELECTOR ) \
 case TPTraits::pod_enum:                                  \
-    return getPODValue<TPTraits>( PROP, SELECTOR );       \
+    return getPODValue<TPTraits>( PROP, SELECTOR, iData );\
 break;
 
 //-*****************************************************************************
 #define CASE_RETURN_ARRAY_VALUE( TPTraits, PROP, SELECTOR, EXTENT ) \
 case TPTraits::pod_enum:                                            \
-    return getSmallArrayValue<TPTraits>( PROP, SELECTOR, EXTENT );  \
+    return getSmallArrayValue<TPTraits>( PROP, SELECTOR, EXTENT,    \
+                                         iData );                   \
 break;
 
 //-*****************************************************************************
-template<>
-object getValue<>( Abc::IScalarProperty &p,
-                   const Abc::ISampleSelector &iSS,
-                   const ReturnTypeEnum iReturnType )
+static object getValueOrConvert( Abc::IScalarProperty &p,
+                                 const Abc::ISampleSelector &iSS,
+                                 const ReturnTypeEnum iReturnType,
+                                 const void *iData )
 {
     // Determine the type & extent of the scalar property and return its value.
     const AbcA::DataType &dt = p.getDataType();
@@ -165,9 +189,9 @@ object getValue<>( Abc::IScalarProperty &p,
             {
                 std::string interp (p.getMetaData().get ("interpretation"));
                 if (!interp.compare (Abc::C3fTPTraits::interpretation()))
-                    return getPODValue< Abc::C3fTPTraits >( p, iSS );
+                    return getPODValue< Abc::C3fTPTraits >( p, iSS, iData );
                 else
-                    return getPODValue< Abc::V3fTPTraits >( p, iSS );
+                    return getPODValue< Abc::V3fTPTraits >( p, iSS, iData );
             }
             default:
             break;
@@ -185,20 +209,20 @@ object getValue<>( Abc::IScalarProperty &p,
             {
                 std::string interp (p.getMetaData().get ("interpretation"));
                 if (!interp.compare (Abc::C4fTPTraits::interpretation()))
-                    return getPODValue< Abc::C4fTPTraits >( p, iSS );
+                    return getPODValue< Abc::C4fTPTraits >( p, iSS, iData );
                 else if (!interp.compare (Abc::QuatfTPTraits::interpretation()))
-                    return getPODValue< Abc::QuatfTPTraits >( p, iSS );
+                    return getPODValue< Abc::QuatfTPTraits >( p, iSS, iData );
                 else if (!interp.compare (Abc::Box2fTPTraits::interpretation()))
-                    return getPODValue< Abc::Box2fTPTraits >( p, iSS );
+                    return getPODValue< Abc::Box2fTPTraits >( p, iSS, iData );
             }
             break;
             case AbcU::kFloat64POD:
             {
                 std::string interp (p.getMetaData().get ("interpretation"));
                 if (!interp.compare (Abc::QuatdTPTraits::interpretation()))
-                    return getPODValue< Abc::QuatdTPTraits >( p, iSS );
+                    return getPODValue< Abc::QuatdTPTraits >( p, iSS, iData );
                 else if (!interp.compare (Abc::Box2dTPTraits::interpretation()))
-                    return getPODValue< Abc::Box2dTPTraits >( p, iSS );
+                    return getPODValue< Abc::Box2dTPTraits >( p, iSS, iData );
             }
             default:
             break;
@@ -272,6 +296,21 @@ object getValue<>( Abc::IScalarProperty &p,
     return object(); // Returns None object
 }
 
+//-*****************************************************************************
+template<>
+object getValue<>( Abc::IScalarProperty &p,
+                   const Abc::ISampleSelector &iSS,
+                   const ReturnTypeEnum iReturnType )
+{
+    return getValueOrConvert( p, iSS, iReturnType, NULL );
+}
+
+//-*****************************************************************************
+object getScalarValue( Abc::IScalarProperty &p, const void *iData )
+{
+    return getValueOrConvert( p, Abc::ISampleSelector(), kReturnAll, iData );
+}
+
 //-*****************************************************************************
 void register_iscalarproperty()
 {
@@ -102,7 +102,7 @@ void register_isubd()
         .def( "getTimeSampling",
               &AbcG::ISubDSchema::getTimeSampling )
         .def( "getValue",
-              &AbcG::ISubDSchema::getValue,
+              &getValueWithoutGIL<AbcG::ISubDSchema>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getFaceCountsProperty",
               &AbcG::ISubDSchema::getFaceCountsProperty )
@@ -81,7 +81,7 @@ void register_ixform()
         .def( "getNumSamples",
               &AbcG::IXformSchema::getNumSamples )
         .def( "getValue",
-              &AbcG::IXformSchema::getValue,
+              &getValueWithoutGIL<AbcG::IXformSchema>,
               ( arg( "iSS" ) = Abc::ISampleSelector() ) )
         .def( "getChildBoundsProperty",
               &AbcG::IXformSchema::getChildBoundsProperty )
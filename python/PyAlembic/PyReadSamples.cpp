@@ -0,0 +1,209 @@
+//-*****************************************************************************
+//
+// Copyright (c) 2026,
+//  Sony Pictures Imageworks Inc. and
+//  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+// *       Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// *       Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+// *       Neither the name of Sony Pictures Imageworks, nor
+// Industrial Light & Magic nor the names of their contributors may be used
+// to endorse or promote products derived from this software without specific
+// prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//-*****************************************************************************
+
+#include <Foundation.h>
+#include <PyIPropertyUtil.h>
+
+using namespace boost::python;
+
+namespace {
+
+//-*****************************************************************************
+struct SampleRequest
+{
+    std::string objectPath;
+    std::string propertyPath;
+    Abc::ISampleSelector selector;
+
+    // filled in without the GIL
+    Abc::IArrayProperty arrayProp;
+    Abc::IScalarProperty scalarProp;
+    AbcA::ArraySamplePtr sample;
+    std::string error;
+};
+
+//-*****************************************************************************
+std::vector< std::string > splitPath( const std::string &iPath )
+{
+    std::vector< std::string > names;
+    std::string::size_type start = 0;
+    while ( start <= iPath.size() )
+    {
+        std::string::size_type end = iPath.find( '/', start );
+        if ( end == std::string::npos )
+        {
+            end = iPath.size();
+        }
+
+        if ( end > start )
+        {
+            names.push_back( iPath.substr( start, end - start ) );
+        }
+        start = end + 1;
+    }
+    return names;
+}
+
+//-*****************************************************************************
+// Called from the task pool without the GIL, so this mustn't touch Python.
+void readRequest( Abc::IArchive &iArchive, SampleRequest &ioRequest )
+{
+    Abc::IObject obj = iArchive.getTop();
+    std::vector< std::string > names = splitPath( ioRequest.objectPath );
+    for ( std::size_t i = 0; i < names.size(); ++i )
+    {
+        if ( !obj.getChildHeader( names[i] ) )
+        {
+            ioRequest.error = "Object not found: " + ioRequest.objectPath;
+            return;
+        }
+        obj = obj.getChild( names[i] );
+    }
+
+    Abc::ICompoundProperty parent = obj.getProperties();
+    names = splitPath( ioRequest.propertyPath );
+    for ( std::size_t i = 0; i < names.size(); ++i )
+    {
+        const AbcA::PropertyHeader *header =
+            parent.getPropertyHeader( names[i] );
+
+        bool isLast = ( i + 1 == names.size() );
+        if ( !header || ( !isLast && !header->isCompound() ) ||
+             ( isLast && header->isCompound() ) )
+        {
+            ioRequest.error = "Property not found: " + ioRequest.objectPath +
+                " " + ioRequest.propertyPath;
+            return;
+        }
+
+        if ( !isLast )
+        {
+            parent = Abc::ICompoundProperty( parent, names[i] );
+        }
+        else if ( header->isArray() )
+        {
+            ioRequest.arrayProp = Abc::IArrayProperty( parent, names[i] );
+            ioRequest.arrayProp.get( ioRequest.sample, ioRequest.selector );
+        }
+        else
+        {
+            ioRequest.scalarProp = Abc::IScalarProperty( parent, names[i] );
+            ioRequest.sample = AbcA::AllocateArraySample(
+                header->getDataType(), AbcU::Dimensions( 1 ) );
+            ioRequest.scalarProp.get(
+                const_cast< void * >( ioRequest.sample->getData() ),
+                ioRequest.selector );
+        }
+    }
+
+    if ( names.empty() )
+    {
+        ioRequest.error = "No property given for: " + ioRequest.objectPath;
+    }
+}
+
+} // namespace
+
+//-*****************************************************************************
+static list ReadSamples( Abc::IArchive &iArchive, object iRequests )
+{
+    std::vector< SampleRequest > requests( len( iRequests ) );
+    for ( std::size_t i = 0; i < requests.size(); ++i )
+    {
+        object item = iRequests[i];
+        if ( len( item ) != 3 )
+        {
+            throwPythonException( "ReadSamples expects (object path, "
+                                  "property path, sample selector) tuples" );
+        }
+
+        requests[i].objectPath = extract< std::string >( item[0] );
+        requests[i].propertyPath = extract< std::string >( item[1] );
+        requests[i].selector = extract< Abc::ISampleSelector >( item[2] );
+    }
+
+    {
+        ScopedReleaseGIL release;
+        AbcU::ParallelFor( 0, requests.size(),
+            [&]( std::size_t i )
+            {
+                try
+                {
+                    readRequest( iArchive, requests[i] );
+                }
+                catch ( std::exception &e )
+                {
+                    requests[i].error = e.what();
+                }
+            } );
+    }
+
+    list values;
+    for ( std::size_t i = 0; i < requests.size(); ++i )
+    {
+        SampleRequest &request = requests[i];
+        if ( !request.error.empty() )
+        {
+            throwPythonException( request.error.c_str() );
+        }
+
+        if ( request.arrayProp.valid() )
+        {
+            values.append( getArrayValue( request.arrayProp,
+                                          request.sample ) );
+        }
+        else
+        {
+            values.append( getScalarValue( request.scalarProp,
+                                           request.sample->getData() ) );
+        }
+    }
+
+    return values;
+}
+
+//-*****************************************************************************
+void register_readsamples()
+{
+    def( "ReadSamples",
+         ReadSamples,
+         ( arg( "IArchive" ), arg( "requests" ) ),
+         "Return a list with the value of each (object path, property path, "
+         "sample selector) in requests, which are read and decompressed in "
+         "parallel without holding the GIL.  Property paths are relative to "
+         "the object's properties, with / between compound property names, "
+         "for example .geom/P" );
+}
@@ -37,6 +37,7 @@
 #include <Foundation.h>
 #include <PyTypedArraySampleConverter.h>
 #include <PyTypeBindingTraits.h>
+#include <PyArraySampleBuffer.h>
 
 using namespace boost::python;
 
@@ -127,6 +128,53 @@ struct FixedArrayToTypedArraySamplePtr
     }
 };
 
+//-*****************************************************************************
+// Wraps the memory of a C contiguous buffer (numpy array, array.array, etc)
+// whose items match the sample type exactly, without copying it.  Like the
+// FixedArray conversion, the sample only borrows the memory, so the schema
+// sample bindings keep the Python object alive via with_custodian_and_ward.
+template<class TPTraits>
+struct BufferToTypedArraySample
+{
+    typedef Abc::TypedArraySample<TPTraits>             samp_type;
+    typedef typename samp_type::value_type              value_type;
+
+    BufferToTypedArraySample()
+    {
+        converter::registry::push_back( &convertible,
+                                        &construct,
+                                        type_id<samp_type>() );
+    }
+
+    static void * convertible( PyObject* obj_ptr )
+    {
+        const void *data = NULL;
+        std::size_t numElements = 0;
+
+        return BufferToData( obj_ptr, TPTraits::pod_enum,
+                             TPTraits::extent, data, numElements ) ?
+            obj_ptr : 0;
+    }
+
+    static void construct( PyObject* obj_ptr,
+                           converter::rvalue_from_python_stage1_data *data )
+    {
+        const void *bufferData = NULL;
+        std::size_t numElements = 0;
+
+        BufferToData( obj_ptr, TPTraits::pod_enum, TPTraits::extent,
+                      bufferData, numElements );
+
+        void *storage = ( (converter::rvalue_from_python_storage<samp_type>*)
+                           data)->storage.bytes;
+
+        new ( storage ) samp_type(
+            reinterpret_cast<const value_type *>( bufferData ), numElements );
+
+        data->convertible = storage;
+    }
+};
+
 //-*****************************************************************************
 template<class TPTraits>
 struct TypedArraySampleToFixedArray
@@ -230,6 +278,10 @@ static void register_()
     typename if_<bool_<binding_traits::memCopyable>,
                        FixedArrayToTypedArraySample<TPTraits>,
                        FixedArrayToTypedArraySamplePtr<TPTraits> >::type from_pyton_converter;
+
+    // from-python converter
+    // contiguous buffer (numpy array, etc) to ArraySample, without a copy
+    BufferToTypedArraySample<TPTraits> from_buffer_converter;
 }
 
 //-*****************************************************************************
@@ -0,0 +1,94 @@
+#-******************************************************************************
+#
+# Copyright (c) 2026,
+#  Sony Pictures Imageworks Inc. and
+#  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met:
+# *       Redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer.
+# *       Redistributions in binary form must reproduce the above
+# copyright notice, this list of conditions and the following disclaimer
+# in the documentation and/or other materials provided with the
+# distribution.
+# *       Neither the name of Sony Pictures Imageworks, nor
+# Industrial Light & Magic, nor the names of their contributors may be used
+# to endorse or promote products derived from this software without specific
+# prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#-******************************************************************************
+
+import array
+import unittest
+from imath import *
+from alembic.Abc import *
+from alembic.AbcGeom import *
+
+verts = array.array('f', [ -1.0, -1.0, 0.0,
+                            1.0, -1.0, 0.0,
+                            1.0,  1.0, 0.0,
+                           -1.0,  1.0, 0.0 ])
+indices = array.array('i', [ 0, 1, 2, 3 ])
+counts = array.array('i', [ 4 ])
+
+def writeQuad( name ):
+    """write a quad mesh from plain buffers"""
+
+    meshObj = OPolyMesh( OArchive( name ).getTop(), 'quad' )
+    mesh = meshObj.getSchema()
+    mesh.set( OPolyMeshSchemaSample( verts, indices, counts ) )
+
+class BufferTest(unittest.TestCase):
+    def testBufferImport(self):
+        """take plain buffers in as a mesh sample"""
+
+        writeQuad( 'bufferImport.abc' )
+
+        meshObj = IPolyMesh( IArchive( 'bufferImport.abc' ).getTop(), 'quad' )
+        positions = meshObj.getSchema().getValue().getPositions()
+        self.assertEqual( len( positions ), 4 )
+        self.assertEqual( positions[2], V3f( 1.0, 1.0, 0.0 ) )
+
+        # the wrong item type or a partial element isn't converted
+        with self.assertRaises( Exception ):
+            OPolyMeshSchemaSample( array.array('d', verts ), indices, counts )
+        with self.assertRaises( Exception ):
+            OPolyMeshSchemaSample( verts[:-1], indices, counts )
+
+    def testBufferExport(self):
+        """hand samples out as read only buffers"""
+
+        writeQuad( 'bufferExport.abc' )
+
+        meshObj = IPolyMesh( IArchive( 'bufferExport.abc' ).getTop(), 'quad' )
+        mesh = meshObj.getSchema()
+
+        view = memoryview( mesh.getPositionsProperty().getBuffer() )
+        self.assertTrue( view.readonly )
+        self.assertEqual( view.format, 'f' )
+        self.assertEqual( view.shape, ( 4, 3 ) )
+        self.assertEqual( view.tolist()[2], [ 1.0, 1.0, 0.0 ] )
+
+        view = memoryview( mesh.getFaceIndicesProperty().getBuffer() )
+        self.assertEqual( view.shape, ( 4, ) )
+        self.assertEqual( view.tolist(), [ 0, 1, 2, 3 ] )
+
+        # the view keeps the sample alive after everything else is gone
+        del meshObj, mesh
+        self.assertEqual( view[3], 3 )
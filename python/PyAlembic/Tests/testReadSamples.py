@@ -0,0 +1,93 @@
+#-******************************************************************************
+#
+# Copyright (c) 2026,
+#  Sony Pictures Imageworks Inc. and
+#  Industrial Light & Magic, a division of Lucasfilm Entertainment Company Ltd.
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met:
+# *       Redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer.
+# *       Redistributions in binary form must reproduce the above
+# copyright notice, this list of conditions and the following disclaimer
+# in the documentation and/or other materials provided with the
+# distribution.
+# *       Neither the name of Sony Pictures Imageworks, nor
+# Industrial Light & Magic, nor the names of their contributors may be used
+# to endorse or promote products derived from this software without specific
+# prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#-******************************************************************************
+
+import threading
+import unittest
+from imath import *
+from alembic.Abc import *
+from alembic.AbcGeom import *
+from meshData import *
+
+class ReadSamplesTest(unittest.TestCase):
+    def testReadSamplesExport(self):
+        """write a few animated meshes to read back in batches"""
+
+        top = OArchive( 'readSamples.abc' ).getTop()
+        for i in range( 4 ):
+            xform = OXform( top, 'xform%d' % i )
+            mesh = OPolyMesh( xform, 'mesh' ).getSchema()
+            for j in range( 3 ):
+                mesh.set( OPolyMeshSchemaSample( verts, indices, counts ) )
+
+    def testReadSamplesImport(self):
+        """read the meshes back in one batch and from several threads"""
+
+        archive = IArchive( 'readSamples.abc' )
+        requests = []
+        for i in range( 4 ):
+            path = '/xform%d/mesh' % i
+            requests.append( ( path, '.geom/P', 2 ) )
+            requests.append( ( path, '.geom/.faceIndices', 0 ) )
+            requests.append( ( path, '.geom/.selfBnds', 1 ) )
+
+        values = ReadSamples( archive, requests )
+        self.assertEqual( len( values ), len( requests ) )
+        for i in range( 4 ):
+            self.assertEqual( len( values[i * 3] ), len( verts ) )
+            self.assertEqual( values[i * 3][1], verts[1] )
+            self.assertEqual( len( values[i * 3 + 1] ), len( indices ) )
+            self.assertEqual( values[i * 3 + 2].min(), V3d( -1.0, -1.0, -1.0 ) )
+
+        with self.assertRaises( RuntimeError ):
+            ReadSamples( archive, [ ( '/nope', '.geom/P', 0 ) ] )
+        with self.assertRaises( RuntimeError ):
+            ReadSamples( archive, [ ( '/xform0/mesh', '.geom/nope', 0 ) ] )
+
+        results = {}
+        def readMesh( i ):
+            obj = IPolyMesh( archive.getTop().getChild( 'xform%d' % i )
+                             .getChild( 'mesh' ) )
+            results[i] = obj.getSchema().getValue( 1 ).getPositions()
+
+        threads = [ threading.Thread( target=readMesh, args=( i, ) )
+                    for i in range( 4 ) ]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        for i in range( 4 ):
+            self.assertEqual( len( results[i] ), len( verts ) )
@@ -57,6 +57,8 @@ void register_ocompoundproperty();
 void register_isampleselector();
 void register_iscalarproperty();
 void register_iarrayproperty();
+void register_arraysamplebuffer();
+void register_readsamples();
 void register_oscalarproperty();
 void register_oarrayproperty();
 void register_itypedscalarproperty();
@@ -171,6 +173,8 @@ BOOST_PYTHON_MODULE( alembic )
         register_isampleselector();
         register_iscalarproperty();
         register_iarrayproperty();
+        register_arraysamplebuffer();
+        register_readsamples();
         register_oscalarproperty();
         register_oarrayproperty();
         register_itypedscalarproperty();